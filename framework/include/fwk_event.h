@@ -33,6 +33,40 @@
  */
 #define FWK_EVENT_PARAMETERS_SIZE 16
 
+/*!
+ * \brief Maximum number of bytes of an out-of-line event parameter block.
+ *
+ * \details Events whose parameters do not fit in \ref FWK_EVENT_PARAMETERS_SIZE
+ *      bytes may carry an additional, out-of-line, parameter block of up to
+ *      this number of bytes. See fwk_thread_alloc_ext_params().
+ */
+#define FWK_EVENT_EXT_PARAMETERS_SIZE 128
+
+/*!
+ * \brief Event priorities.
+ *
+ * \details In the single-thread configuration, the framework maintains one
+ *      event queue per priority and always processes the events of the highest
+ *      priority non-empty queue first. Events with the same priority are
+ *      processed in the order they were put.
+ *
+ * \note The normal priority is the default priority of zero-initialized
+ *      events.
+ */
+enum fwk_event_priority {
+    /*! Normal priority */
+    FWK_EVENT_PRIORITY_NORMAL,
+
+    /*! High priority, e.g. for latency-critical requests */
+    FWK_EVENT_PRIORITY_HIGH,
+
+    /*! Low priority, e.g. for background processing */
+    FWK_EVENT_PRIORITY_LOW,
+
+    /*! Number of event priorities */
+    FWK_EVENT_PRIORITY_COUNT
+};
+
 /*!
  * \brief Event.
  *
@@ -74,6 +108,24 @@ struct fwk_event {
      */
     bool is_delayed_response;
 
+    /*!
+     * \brief Flag indicating whether the event may be coalesced with a pending
+     *      event.
+     *
+     * \details When an event with this flag set is put while an event with
+     *      the same target and identifier, also with this flag set, is still
+     *      awaiting processing, the framework does not queue the new event.
+     *      Instead, the source and parameters of the pending event are
+     *      replaced by the ones of the new event, which is thus processed
+     *      once, at the position of the pending event. Only the last
+     *      parameters are processed.
+     *
+     *      The flag is ignored for responses, notifications and events
+     *      requesting a response. The events put by ISRs are coalesced when
+     *      they are moved to the event queues.
+     */
+    bool coalesce;
+
     /*!
      * \internal
      * \brief Flag indicating whether the event is a response event that a
@@ -90,8 +142,39 @@ struct fwk_event {
      */
     fwk_id_t id;
 
+    /*!
+     * \brief Event priority.
+     *
+     * \details The response to an event and the notifications sent by the
+     *      framework inherit the priority of the event they originate from.
+     */
+    enum fwk_event_priority priority;
+
     /*! Table of event parameters */
     alignas(uintmax_t) uint8_t params[FWK_EVENT_PARAMETERS_SIZE];
+
+    /*!
+     * \brief Out-of-line event parameter block, \c NULL if the event has none.
+     *
+     * \details The block is allocated with fwk_thread_alloc_ext_params() and
+     *      released by the framework once the event has been processed.
+     */
+    void *ext_params;
+
+    #ifdef BUILD_HAS_EVENT_PROFILING
+    /*!
+     * \internal
+     * \brief Value of the profiling counter when the event was put.
+     */
+    uint32_t put_timestamp;
+
+    /*!
+     * \internal
+     * \brief Flag indicating whether the event was put while a profiling
+     *      counter was set.
+     */
+    bool is_timestamped;
+    #endif
 };
 
 /*!
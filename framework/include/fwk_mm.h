@@ -83,6 +83,134 @@ void *fwk_mm_calloc(size_t num, size_t size);
  */
 void *fwk_mm_calloc_aligned(size_t num, size_t size, unsigned int alignment);
 
+/*!
+ * \brief Memory usage of the heap, or of the part of the heap allocated by
+ *      a given entity.
+ */
+struct fwk_mm_usage {
+    /*! Number of bytes allocated */
+    size_t allocated_size;
+
+    /*! Number of bytes lost to the alignment of the allocated blocks */
+    size_t padding_size;
+
+    /*! Number of successful allocation requests */
+    unsigned int alloc_count;
+};
+
+/*!
+ * \brief Heap usage statistics.
+ */
+struct fwk_mm_stats {
+    /*! Size of the heap in bytes */
+    size_t heap_size;
+
+    /*! Number of bytes remaining in the heap */
+    size_t free_size;
+
+    /*! Number of allocation requests that failed */
+    unsigned int failed_alloc_count;
+
+    /*! Usage of the heap by all the entities */
+    struct fwk_mm_usage usage;
+};
+
+/*!
+ * \brief Get the heap usage statistics.
+ *
+ * \param [out] stats Heap usage statistics.
+ *
+ * \retval FWK_SUCCESS The statistics were returned.
+ * \retval FWK_E_PARAM The pointer \p stats is \c NULL.
+ * \retval FWK_E_STATE The memory management component is not initialized.
+ */
+int fwk_mm_get_stats(struct fwk_mm_stats *stats);
+
+/*!
+ * \brief Pool of fixed-size memory blocks.
+ *
+ * \details The pool is opaque to its users. Blocks are allocated from and
+ *      returned to the pool in constant time.
+ */
+struct fwk_mm_pool;
+
+/*!
+ * \brief Pool usage statistics.
+ */
+struct fwk_mm_pool_stats {
+    /*! Size in bytes of the blocks, as requested at the creation of the pool */
+    size_t block_size;
+
+    /*! Number of blocks of the pool */
+    unsigned int block_count;
+
+    /*! Number of blocks currently allocated */
+    unsigned int used_count;
+
+    /*! Maximum number of blocks allocated at the same time (high-water mark) */
+    unsigned int used_count_max;
+
+    /*! Number of allocation requests that failed as the pool was empty */
+    unsigned int failed_alloc_count;
+};
+
+/*!
+ * \brief Create a pool of fixed-size memory blocks.
+ *
+ * \details The memory for the pool and its blocks is taken from the heap when
+ *      the pool is created. Pools must thus be created before the memory
+ *      management component is locked, typically during the pre-runtime
+ *      phase. The blocks can then be allocated and freed at any time, from
+ *      threads and interrupt handlers.
+ *
+ * \note Blocks are aligned on \ref FWK_MM_DEFAULT_ALIGNMENT.
+ *
+ * \param block_size Size of the blocks in bytes.
+ * \param block_count Number of blocks.
+ *
+ * \retval NULL The pool creation failed.
+ * \return Pointer to the newly-created pool.
+ */
+struct fwk_mm_pool *fwk_mm_pool_create(size_t block_size,
+                                       unsigned int block_count);
+
+/*!
+ * \brief Allocate a block from a pool.
+ *
+ * \param pool Pointer to the pool. Must not be \c NULL.
+ *
+ * \retval NULL All the blocks of the pool are allocated.
+ * \return Pointer to the allocated block.
+ */
+void *fwk_mm_pool_alloc(struct fwk_mm_pool *pool);
+
+/*!
+ * \brief Return a block to the pool it was allocated from.
+ *
+ * \param pool Pointer to the pool. Must not be \c NULL.
+ * \param block Pointer to the block.
+ *
+ * \retval FWK_SUCCESS The block was returned to the pool.
+ * \retval FWK_E_PARAM The pointer \p block does not point to a block of the
+ *      pool.
+ * \retval FWK_E_STATE The block is not allocated. Freeing a block while no
+ *      block of the pool is allocated is always detected, other double frees
+ *      are only detected in debug builds.
+ */
+int fwk_mm_pool_free(struct fwk_mm_pool *pool, void *block);
+
+/*!
+ * \brief Get the usage statistics of a pool.
+ *
+ * \param pool Pointer to the pool.
+ * \param [out] stats Pool usage statistics.
+ *
+ * \retval FWK_SUCCESS The statistics were returned.
+ * \retval FWK_E_PARAM One or more parameters were invalid.
+ */
+int fwk_mm_pool_get_stats(const struct fwk_mm_pool *pool,
+                          struct fwk_mm_pool_stats *stats);
+
 /*!
  * @}
  */
@@ -15,8 +15,10 @@
 #include <stdint.h>
 #include <stdlib.h>
 #include <fwk_element.h>
+#include <fwk_errno.h>
 #include <fwk_event.h>
 #include <fwk_id.h>
+#include <fwk_mm.h>
 
 /*!
  * \addtogroup GroupLibFramework Framework
@@ -202,6 +204,9 @@ struct fwk_module {
      *      possible example of this would be a driver module that must enable
      *      an interrupt after it has completed initialization.
      *
+     *      A module is started once all the modules its start depends on, see
+     *      \ref fwk_module_config::start_dependency_table, have started.
+     *
      * \note This function is \b optional.
      *
      * \param id Identifier of the module or element to start.
@@ -211,6 +216,36 @@ struct fwk_module {
      */
     int (*start)(fwk_id_t id);
 
+    /*!
+     * \brief The start of the module completes asynchronously.
+     *
+     * \details When set, the module is not considered started when its start
+     *      function and the start functions of its elements return. The start
+     *      may for instance trigger a long hardware sequence and complete
+     *      through the processing of the related events or notifications. The
+     *      module then reports the completion of its start with
+     *      fwk_module_start_complete(), which starts the modules waiting for
+     *      it. In the meantime, the other modules are started and the runtime
+     *      phase may begin.
+     */
+    bool async_start;
+
+    /*!
+     * \brief The event and notification handlers of the module may run
+     *      concurrently.
+     *
+     * \details Only used by the host builds processing the events with a pool
+     *      of worker threads (BUILD_HAS_WORKER_POOL). When set, the handlers of
+     *      the module may run at the same time as other handlers of the module
+     *      and of the other modules that set the flag. The events targeting one
+     *      module, element or sub-element and its parent element are still
+     *      processed one at a time and in order. The handlers call into the
+     *      modules that do not set the flag within an exclusive section (see
+     *      fwk_thread_begin_exclusive()). When not set, the handlers of the
+     *      module run alone.
+     */
+    bool concurrent_event_processing;
+
     /*!
      * \brief Pointer to the bind request processing function.
      *
@@ -310,8 +345,69 @@ struct fwk_module_config {
 
     /*! Pointer to the module-specific configuration data */
     const void *data;
+
+    /*! Number of modules the start of the module depends on */
+    unsigned int start_dependency_count;
+
+    /*!
+     * \brief Table of the identifiers of the modules the start of the module
+     *      depends on.
+     *
+     * \details The module is started once all these modules have started. The
+     *      modules whose dependencies are met are started in the order of the
+     *      module table.
+     */
+    const fwk_id_t *start_dependency_table;
+
+    /*!
+     * \brief The elements of the module are initialized lazily.
+     *
+     * \details When set, the framework does not initialize the elements of the
+     *      module during the initialization stage. An element is initialized,
+     *      and taken through the bind and start stages the module has already
+     *      gone through, the first time it is the target of a binding request
+     *      or an event, the source of a notification subscription, or when it
+     *      is activated with fwk_module_activate_element(). The elements that
+     *      are never used thus cost no time and no memory beyond their
+     *      framework context.
+     *
+     *      The module must be able to initialize, bind and start its elements
+     *      at runtime, in any order, and must not rely on all of its elements
+     *      being initialized when its post-initialization, bind or start
+     *      function is called for the module itself.
+     */
+    bool lazy_element_init;
 };
 
+/*!
+ * \brief Get a pointer to the context of an element in a table of element
+ *      contexts indexed by element index.
+ *
+ * \details Example usage:
+ *      \code{.c}
+ *      struct dev_ctx *get_dev_ctx(fwk_id_t element_id)
+ *      {
+ *          return FWK_MODULE_ELEMENT_CTX(dev_ctx_table, element_id);
+ *      }
+ *      \endcode
+ *
+ * \note In release builds the element index is read directly from the
+ *      identifier. In debug builds the type of the identifier is checked first.
+ *
+ * \param TABLE Table of element contexts.
+ * \param ELEMENT_ID Element or sub-element identifier.
+ *
+ * \return Pointer to the entry of \p TABLE of the element, with the type of the
+ *      entries of \p TABLE.
+ */
+#ifdef NDEBUG
+#define FWK_MODULE_ELEMENT_CTX(TABLE, ELEMENT_ID) \
+    (&(TABLE)[(ELEMENT_ID).element.element_idx])
+#else
+#define FWK_MODULE_ELEMENT_CTX(TABLE, ELEMENT_ID) \
+    (&(TABLE)[fwk_id_get_element_idx(ELEMENT_ID)])
+#endif
+
 /*!
  * \brief Check if an identifier refers to a valid module.
  *
@@ -425,10 +521,65 @@ const char *fwk_module_get_name(fwk_id_t id);
  */
 const void *fwk_module_get_data(fwk_id_t id);
 
+/*!
+ * \internal
+ *
+ * \brief Number of bits per word of the bitmap of callable entities.
+ */
+#define __FWK_MODULE_CALLABLE_WORD_BITS 32
+
+/*!
+ * \internal
+ *
+ * \brief Map of the modules and elements in a state where they can accept
+ *      calls to their APIs, maintained by the framework as their state changes.
+ */
+struct __fwk_module_callable_map {
+    /*!
+     * \brief Bitmap of the callable modules and elements. The bit of a module
+     *      is followed by the bits of its elements, in order. \c NULL until
+     *      all the modules have been initialized.
+     */
+    uint32_t *bitmap;
+
+    /*!
+     * \brief Index of the bit of each module in the bitmap, followed by the
+     *      number of bits of the bitmap.
+     */
+    const unsigned int *bit_idx_table;
+
+    /*! Number of modules */
+    unsigned int module_count;
+};
+
+/*!
+ * \internal
+ *
+ * \brief Map of the callable modules and elements.
+ */
+extern struct __fwk_module_callable_map __fwk_module_callable_map;
+
+/*!
+ * \internal
+ *
+ * \brief Check whether a module or element can accept API calls, without the
+ *      fast path of fwk_module_check_call().
+ *
+ * \param id Identifier of a module or element.
+ *
+ * \return See fwk_module_check_call().
+ */
+int __fwk_module_check_call(fwk_id_t id);
+
 /*!
  * \brief Check whether a module or element is in a state where it can accept
  *      calls to one of its APIs.
  *
+ * \details The check is inlined as a lookup in the bitmap of callable
+ *      entities for the module and element identifiers. The other
+ *      identifiers, and the entities that cannot accept calls, are handled by
+ *      an out-of-line call that reports the error.
+ *
  * \param id Identifier of a module or element.
  *
  * \retval FWK_SUCCESS The module or element can service API calls.
@@ -437,7 +588,28 @@ const void *fwk_module_get_data(fwk_id_t id);
  * \retval FWK_E_STATE The module or element is suspended.
  *
  */
-int fwk_module_check_call(fwk_id_t id);
+static inline int fwk_module_check_call(fwk_id_t id)
+{
+    const struct __fwk_module_callable_map *map = &__fwk_module_callable_map;
+    unsigned int module_idx = id.common.module_idx;
+    unsigned int bit_idx;
+
+    if ((map->bitmap == NULL) || (module_idx >= map->module_count))
+        return __fwk_module_check_call(id);
+
+    bit_idx = map->bit_idx_table[module_idx];
+    if (id.common.type == FWK_ID_TYPE_ELEMENT)
+        bit_idx += 1 + id.element.element_idx;
+    else if (id.common.type != FWK_ID_TYPE_MODULE)
+        return __fwk_module_check_call(id);
+
+    if ((bit_idx < map->bit_idx_table[module_idx + 1]) &&
+        ((map->bitmap[bit_idx / __FWK_MODULE_CALLABLE_WORD_BITS] &
+          (UINT32_C(1) << (bit_idx % __FWK_MODULE_CALLABLE_WORD_BITS))) != 0))
+        return FWK_SUCCESS;
+
+    return __fwk_module_check_call(id);
+}
 
 /*!
  * \brief Bind to an API of a module or an element.
@@ -460,6 +632,68 @@ int fwk_module_check_call(fwk_id_t id);
  */
 int fwk_module_bind(fwk_id_t target_id, fwk_id_t api_id, const void *api);
 
+/*!
+ * \brief Report the completion of the asynchronous start of a module.
+ *
+ * \details The modules waiting for the module to start, and whose other start
+ *      dependencies are met, are started before the function returns.
+ *
+ * \note This function must not be called from an ISR.
+ *
+ * \param module_id Identifier of a module with an asynchronous start.
+ *
+ * \retval FWK_SUCCESS The module is started.
+ * \retval FWK_E_PARAM The identifier is not a valid module identifier.
+ * \retval FWK_E_STATE The module has no start in progress.
+ * \return One of the error codes returned by the start function of a module
+ *      waiting for the module to start.
+ */
+int fwk_module_start_complete(fwk_id_t module_id);
+
+/*!
+ * \brief Activate an element of a module whose elements are initialized
+ *      lazily.
+ *
+ * \details The element is initialized, bound and started according to the
+ *      pre-runtime stages its module has already gone through. Nothing is done
+ *      if the element is already active or if its module does not initialize
+ *      its elements lazily.
+ *
+ * \note This function must not be called from an ISR.
+ *
+ * \param element_id Identifier of the element, or of one of its
+ *      sub-elements.
+ *
+ * \retval FWK_SUCCESS The element is active.
+ * \retval FWK_E_PARAM The identifier is not a valid element or sub-element
+ *      identifier.
+ * \retval FWK_E_INIT The module of the element is not initialized yet.
+ * \return One of the error codes returned by the handlers of the module while
+ *      activating the element.
+ */
+int fwk_module_activate_element(fwk_id_t element_id);
+
+/*!
+ * \brief Get the memory usage of a module or element.
+ *
+ * \details The memory allocated while the framework calls one of the
+ *      handlers of a module or element, including the memory the framework
+ *      allocates for its own context of the module or element, is accounted
+ *      to that module or element. The memory usage of a module includes the
+ *      memory usage of its elements.
+ *
+ * \note Only available when the build has memory accounting support
+ *      (BUILD_HAS_MM_ACCOUNTING).
+ *
+ * \param id Identifier of the module or element.
+ * \param [out] usage Memory usage of the module or element.
+ *
+ * \retval FWK_SUCCESS The memory usage was returned.
+ * \retval FWK_E_PARAM One or more parameters were invalid.
+ * \retval FWK_E_SUPPORT The build has no memory accounting support.
+ */
+int fwk_module_get_mm_usage(fwk_id_t id, struct fwk_mm_usage *usage);
+
 /*!
  * @}
  */
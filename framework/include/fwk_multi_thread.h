@@ -50,6 +50,24 @@
  */
 int fwk_thread_create(fwk_id_t id);
 
+/*!
+ * \brief Get the usage statistics of the event queue of the thread processing
+ *      the events of a module or element.
+ *
+ * \param id Identifier of the module or element. If the module or element has
+ *      no thread of its own, the statistics of the queue of the thread its
+ *      events are processed in are returned.
+ * \param [out] stats Event queue usage statistics.
+ *
+ * \retval FWK_SUCCESS The statistics were returned.
+ * \retval FWK_E_INIT The thread framework component is not initialized.
+ * \retval FWK_E_PARAM The identifier is not a valid module or element
+ *      identifier.
+ * \retval FWK_E_PARAM The pointer \p stats is equal to NULL.
+ */
+int fwk_thread_get_queue_stats(fwk_id_t id,
+                               struct fwk_thread_queue_stats *stats);
+
 /*!
  * \brief Put an event in a module or element thread queue and wait for it to
  *      be processed.
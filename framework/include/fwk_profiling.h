@@ -0,0 +1,207 @@
+/*
+ * Arm SCP/MCP Software
+ * Copyright (c) 2015-2019, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Description:
+ *     Event processing and boot profiling.
+ */
+
+#ifndef FWK_PROFILING_H
+#define FWK_PROFILING_H
+
+#include <stdint.h>
+#include <fwk_id.h>
+
+/*!
+ * \addtogroup GroupLibFramework Framework
+ * @{
+ */
+
+/*!
+ * \defgroup GroupProfiling Profiling
+ *
+ * \details When the build has event profiling support, the framework
+ *      timestamps each event when it is put, when its processing starts and
+ *      when its processing completes. From these timestamps it computes the
+ *      time the event waited in the event queues and the time its handler
+ *      took, and accumulates them into histograms:
+ *      - per module, for all the events, responses and notifications processed
+ *        by the module or its elements.
+ *      - per event identifier, for the events that are not responses.
+ *
+ *      When the build has boot profiling support, the framework times the
+ *      handlers it calls for each module and element during the pre-runtime
+ *      phase: initialization, post-initialization, each bind round and start.
+ *      These times are available per module and element, and as a report of
+ *      the modules and elements sorted by decreasing time.
+ *
+ *      The timestamps are read from a counter provided by the firmware with
+ *      fwk_profiling_set_counter(). No statistics are collected until a
+ *      counter has been provided. To time the whole pre-runtime phase, the
+ *      counter must be provided before the framework is initialized.
+ *
+ * @{
+ */
+
+/*!
+ * \brief Number of bins of the histograms.
+ */
+#define FWK_PROFILING_BIN_COUNT 16
+
+/*!
+ * \brief Histogram of durations, in counter ticks.
+ *
+ * \details The bins are logarithmic. Bin 0 counts the durations of zero ticks.
+ *      Bin n, with n greater than zero, counts the durations between 2^(n-1)
+ *      and 2^n - 1 ticks. The last bin also counts all the longer durations.
+ */
+struct fwk_profiling_histogram {
+    /*! Number of durations */
+    uint32_t count;
+
+    /*! Longest duration */
+    uint32_t max;
+
+    /*! Sum of the durations */
+    uint64_t total;
+
+    /*! Number of durations per bin */
+    uint32_t bins[FWK_PROFILING_BIN_COUNT];
+};
+
+/*!
+ * \brief Event processing statistics.
+ */
+struct fwk_profiling_stats {
+    /*! Time spent by the events in the event queues, from put to dispatch */
+    struct fwk_profiling_histogram wait;
+
+    /*! Time spent by the event handlers to process the events */
+    struct fwk_profiling_histogram handler;
+};
+
+/*!
+ * \brief Pre-runtime stages timed by the boot profiling.
+ */
+enum fwk_profiling_boot_stage {
+    /*! Module or element initialization */
+    FWK_PROFILING_BOOT_STAGE_INIT,
+
+    /*! Module post-initialization */
+    FWK_PROFILING_BOOT_STAGE_POST_INIT,
+
+    /*! First bind round */
+    FWK_PROFILING_BOOT_STAGE_BIND_ROUND_0,
+
+    /*! Second bind round */
+    FWK_PROFILING_BOOT_STAGE_BIND_ROUND_1,
+
+    /*! Module or element start */
+    FWK_PROFILING_BOOT_STAGE_START,
+
+    /*! Number of stages */
+    FWK_PROFILING_BOOT_STAGE_COUNT
+};
+
+/*!
+ * \brief Pre-runtime handler times of a module or element, in counter ticks.
+ *
+ * \details The times of a module do not include the times of its elements.
+ */
+struct fwk_profiling_boot_times {
+    /*! Time per stage, indexed by \ref fwk_profiling_boot_stage */
+    uint32_t stage_times[FWK_PROFILING_BOOT_STAGE_COUNT];
+
+    /*! Sum of the stage times */
+    uint32_t total;
+};
+
+/*!
+ * \brief Boot report entry.
+ */
+struct fwk_profiling_boot_entry {
+    /*! Identifier of the module or element */
+    fwk_id_t id;
+
+    /*! Pre-runtime handler times of the module or element */
+    struct fwk_profiling_boot_times times;
+};
+
+/*!
+ * \brief Set the counter the timestamps are read from.
+ *
+ * \details The counter is typically a free-running timer, for instance one of
+ *      the devices of the timer module, read through a short product-specific
+ *      function. The counter must count up and wrap around from UINT32_MAX to
+ *      zero.
+ *
+ * \note The statistics that have been collected with another counter, if any,
+ *      are not reset.
+ *
+ * \param read_counter Function returning the current value of the counter,
+ *      \c NULL to stop collecting statistics. The function may be called from
+ *      an ISR.
+ *
+ * \retval FWK_SUCCESS The counter was set.
+ * \retval FWK_E_SUPPORT The build has neither event nor boot profiling
+ *      support.
+ */
+int fwk_profiling_set_counter(uint32_t (*read_counter)(void));
+
+/*!
+ * \brief Get the event processing statistics of a module or of an event.
+ *
+ * \param id Identifier of a module or of an event.
+ * \param [out] stats Event processing statistics.
+ *
+ * \retval FWK_SUCCESS The statistics were returned.
+ * \retval FWK_E_PARAM The identifier \p id is not a valid module or event
+ *      identifier.
+ * \retval FWK_E_PARAM The pointer \p stats is \c NULL.
+ * \retval FWK_E_SUPPORT The build does not have event profiling support.
+ */
+int fwk_profiling_get_stats(fwk_id_t id, struct fwk_profiling_stats *stats);
+
+/*!
+ * \brief Get the pre-runtime handler times of a module or element.
+ *
+ * \param id Identifier of a module or element.
+ * \param [out] times Pre-runtime handler times.
+ *
+ * \retval FWK_SUCCESS The times were returned.
+ * \retval FWK_E_PARAM The identifier \p id is not a valid module or element
+ *      identifier.
+ * \retval FWK_E_PARAM The pointer \p times is \c NULL.
+ * \retval FWK_E_SUPPORT The build does not have boot profiling support.
+ */
+int fwk_profiling_get_boot_times(fwk_id_t id,
+                                 struct fwk_profiling_boot_times *times);
+
+/*!
+ * \brief Get the modules and elements that took the most time during the
+ *      pre-runtime phase.
+ *
+ * \param [out] entry_table Table of entries to fill, sorted by decreasing
+ *      total time.
+ * \param [in, out] entry_count Number of entries of \p entry_table on entry,
+ *      number of entries filled on return. When the table is too small, only
+ *      the modules and elements with the longest total times are returned.
+ *
+ * \retval FWK_SUCCESS The report was returned.
+ * \retval FWK_E_PARAM One of the pointers is \c NULL.
+ * \retval FWK_E_SUPPORT The build does not have boot profiling support.
+ */
+int fwk_profiling_get_boot_report(struct fwk_profiling_boot_entry *entry_table,
+                                  unsigned int *entry_count);
+
+/*!
+ * @}
+ */
+
+/*!
+ * @}
+ */
+
+#endif /* FWK_PROFILING_H */
@@ -11,7 +11,10 @@
 #ifndef FWK_THREAD_H
 #define FWK_THREAD_H
 
+#include <stddef.h>
+#include <stdint.h>
 #include <fwk_event.h>
+#include <fwk_id.h>
 
 /*!
  * \addtogroup GroupLibFramework Framework
@@ -24,6 +27,92 @@
  * @{
  */
 
+/*!
+ * \brief Usage statistics of an event queue.
+ */
+struct fwk_thread_queue_stats {
+    /*! Number of events in the queue */
+    unsigned int depth;
+
+    /*! Highest number of events the queue has held */
+    unsigned int depth_max;
+
+    /*! Number of events that could not be put in the queue */
+    unsigned int failed_put_count;
+};
+
+/*!
+ * \brief Timer driver the delayed and periodic events are scheduled with.
+ *
+ * \details The driver is provided by the module controlling the timer device
+ *      that is the time base of the framework.
+ */
+struct fwk_thread_timer_driver {
+    /*! Frequency of the counter of the timer in Hz */
+    uint32_t frequency;
+
+    /*!
+     * \brief Get the current value of the counter of the timer.
+     *
+     * \param [out] counter Value of the counter.
+     *
+     * \retval FWK_SUCCESS Operation succeeded.
+     * \return One of the other error codes described by the framework.
+     */
+    int (*get_counter)(uint64_t *counter);
+
+    /*!
+     * \brief Set the alarm of the timer.
+     *
+     * \details When the counter reaches \p timestamp, the driver calls
+     *      fwk_thread_signal_timer(), possibly from an ISR. If \p timestamp is
+     *      already in the past, the driver signals the timer as soon as
+     *      possible. Setting the alarm replaces the previous alarm, if any.
+     *
+     * \param timestamp Value of the counter the alarm is due at.
+     *
+     * \retval FWK_SUCCESS Operation succeeded.
+     * \return One of the other error codes described by the framework.
+     */
+    int (*set_alarm)(uint64_t timestamp);
+};
+
+/*!
+ * \brief Event usage statistics.
+ *
+ * \details The statistics help sizing the number of event structures of a
+ *      firmware from the peak usage measured on the target.
+ */
+struct fwk_thread_stats {
+    /*! Number of event structures */
+    unsigned int event_count;
+
+    /*! Number of event structures in use */
+    unsigned int used_event_count;
+
+    /*! Highest number of event structures in use */
+    unsigned int used_event_count_max;
+
+    /*! Number of requests for an event structure that failed */
+    unsigned int failed_alloc_count;
+
+    /*! Number of events coalesced with an event awaiting processing */
+    unsigned int coalesced_event_count;
+
+    /*!
+     * \brief Usage of the queues of events awaiting processing.
+     *
+     * \details In the single-thread configuration, the event queues of all
+     *      priorities are accounted together. In the multi-thread
+     *      configuration, the event queues of all the threads are accounted
+     *      together.
+     */
+    struct fwk_thread_queue_stats event_queue;
+
+    /*! Usage of the queue of events put by ISRs and not yet dispatched */
+    struct fwk_thread_queue_stats isr_event_queue;
+};
+
 /*!
  * \brief Put an event in one of the event queues.
  *
@@ -60,6 +149,182 @@
  */
 int fwk_thread_put_event(struct fwk_event *event);
 
+/*!
+ * \brief Put an event in one of the event queues after a delay.
+ *
+ * \details The event is checked and its source identifier populated as by
+ *      fwk_thread_put_event(). It is then held by the framework until the
+ *      delay has elapsed and only then put in the event queues.
+ *      A delayed event uses one of the event structures of the framework
+ *      while it is held.
+ *
+ *      The delay is measured with the timer driver registered with
+ *      fwk_thread_set_timer_driver().
+ *
+ * \param event Pointer to the event to put. Must not be \c NULL.
+ * \param microseconds Delay in microseconds.
+ *
+ * \retval FWK_SUCCESS The event is held until the delay has elapsed.
+ * \retval FWK_E_INIT The thread framework component is not initialized.
+ * \retval FWK_E_ACCESS The API is called from an ISR.
+ * \retval FWK_E_PARAM One or more fields in the \p event parameter were
+ *      invalid.
+ * \retval FWK_E_PARAM The event is a response.
+ * \retval FWK_E_NOMEM All the event structures are in use.
+ * \retval FWK_E_SUPPORT No timer driver has been registered.
+ * \return One of the error codes of the timer driver.
+ */
+int fwk_thread_put_event_delayed(struct fwk_event *event,
+                                 uint32_t microseconds);
+
+/*!
+ * \brief Put an event in one of the event queues periodically.
+ *
+ * \details The event is put as by fwk_thread_put_event_delayed() after
+ *      \p microseconds, then again every \p microseconds until it is
+ *      cancelled with fwk_thread_cancel_delayed_event(). When the event
+ *      cannot be put at the end of a period, because no event structure is
+ *      free or because the processing of the firmware fell behind, the
+ *      occurrence is skipped rather than put late.
+ *
+ *      Setting the \ref fwk_event.coalesce flag of the event prevents
+ *      occurrences from piling up in the event queue when the target is slower
+ *      than the period.
+ *
+ * \param event Pointer to the event to put. Must not be \c NULL.
+ * \param microseconds Period in microseconds.
+ *
+ * \retval FWK_SUCCESS The event is put periodically.
+ * \retval FWK_E_INIT The thread framework component is not initialized.
+ * \retval FWK_E_ACCESS The API is called from an ISR.
+ * \retval FWK_E_PARAM One or more fields in the \p event parameter were
+ *      invalid.
+ * \retval FWK_E_PARAM The event is a response or has an out-of-line
+ *      parameter block.
+ * \retval FWK_E_PARAM The period \p microseconds is equal to zero.
+ * \retval FWK_E_NOMEM All the event structures are in use.
+ * \retval FWK_E_SUPPORT No timer driver has been registered.
+ * \return One of the error codes of the timer driver.
+ */
+int fwk_thread_put_event_periodic(struct fwk_event *event,
+                                  uint32_t microseconds);
+
+/*!
+ * \brief Cancel the delayed and periodic events with a given target and
+ *      identifier.
+ *
+ * \details The events that have already been put in the event queues are not
+ *      affected.
+ *
+ * \param target_id Identifier of the target of the events.
+ * \param event_id Identifier of the events.
+ *
+ * \retval FWK_SUCCESS At least one event was cancelled.
+ * \retval FWK_E_INIT The thread framework component is not initialized.
+ * \retval FWK_E_ACCESS The API is called from an ISR.
+ * \retval FWK_E_STATE No delayed or periodic event matched.
+ */
+int fwk_thread_cancel_delayed_event(fwk_id_t target_id, fwk_id_t event_id);
+
+/*!
+ * \brief Register the timer driver the delayed and periodic events are
+ *      scheduled with.
+ *
+ * \details Only one timer driver can be registered. The driver is expected to
+ *      be registered during the pre-runtime phase, by the start of the module
+ *      controlling the timer device.
+ *
+ * \param driver Pointer to the timer driver. Must not be \c NULL and must
+ *      remain valid.
+ *
+ * \retval FWK_SUCCESS The driver was registered.
+ * \retval FWK_E_INIT The thread framework component is not initialized.
+ * \retval FWK_E_PARAM The driver is invalid.
+ * \retval FWK_E_STATE A timer driver has already been registered.
+ * \retval FWK_E_NOMEM The storage of the delayed events could not be
+ *      allocated.
+ */
+int fwk_thread_set_timer_driver(const struct fwk_thread_timer_driver *driver);
+
+/*!
+ * \brief Signal that the alarm of the registered timer driver has expired.
+ *
+ * \details The delayed and periodic events that are due are put in the event
+ *      queues by the thread, not by the caller.
+ *
+ *      The function can be called from an ISR.
+ */
+void fwk_thread_signal_timer(void);
+
+/*!
+ * \brief Allocate an out-of-line parameter block for an event.
+ *
+ * \details The block is taken from a pool of blocks of
+ *      \ref FWK_EVENT_EXT_PARAMETERS_SIZE bytes owned by the framework and its
+ *      address is stored in the \ref fwk_event.ext_params field of \p event.
+ *      The content of the block is undefined.
+ *
+ *      Once \p event has been put successfully with fwk_thread_put_event(),
+ *      the block belongs to the framework, which passes it to the target of
+ *      the event and releases it when the processing of the event completes.
+ *      The target must thus copy out the parameters it needs to keep. If the
+ *      event could not be put, the block must be released with
+ *      fwk_thread_free_ext_params().
+ *
+ *      A response event may also carry an out-of-line parameter block, in
+ *      which case the block is released once the response has been processed.
+ *
+ *      The function can be called from an ISR.
+ *
+ * \note Notifications cannot carry an out-of-line parameter block.
+ *
+ * \note Only supported when the firmware configures a number of blocks with
+ *      BS_FIRMWARE_EVENT_EXT_PARAMS_COUNT. In the multi-thread configuration,
+ *      the response returned by fwk_thread_put_event_and_wait() never carries
+ *      a block.
+ *
+ * \param event Pointer to the event. Must not be \c NULL.
+ * \param size Size in bytes of the parameter block.
+ *
+ * \retval FWK_SUCCESS The block was allocated.
+ * \retval FWK_E_INIT The thread framework component is not initialized.
+ * \retval FWK_E_PARAM The pointer \p event is equal to NULL.
+ * \retval FWK_E_PARAM The size \p size is equal to zero or greater than
+ *      \ref FWK_EVENT_EXT_PARAMETERS_SIZE.
+ * \retval FWK_E_STATE The event already has an out-of-line parameter block.
+ * \retval FWK_E_NOMEM All the out-of-line parameter blocks are in use.
+ * \retval FWK_E_SUPPORT The configuration does not support out-of-line
+ *      parameter blocks.
+ */
+int fwk_thread_alloc_ext_params(struct fwk_event *event, size_t size);
+
+/*!
+ * \brief Release the out-of-line parameter block of an event that has not
+ *      been put.
+ *
+ * \param event Pointer to the event. Must not be \c NULL.
+ *
+ * \retval FWK_SUCCESS The block was released, or the event had none.
+ * \retval FWK_E_INIT The thread framework component is not initialized.
+ * \retval FWK_E_PARAM The pointer \p event is equal to NULL.
+ * \retval FWK_E_PARAM The block was not allocated with
+ *      fwk_thread_alloc_ext_params().
+ * \retval FWK_E_SUPPORT The configuration does not support out-of-line
+ *      parameter blocks.
+ */
+int fwk_thread_free_ext_params(struct fwk_event *event);
+
+/*!
+ * \brief Get the event usage statistics.
+ *
+ * \param [out] stats Event usage statistics.
+ *
+ * \retval FWK_SUCCESS The statistics were returned.
+ * \retval FWK_E_INIT The thread framework component is not initialized.
+ * \retval FWK_E_PARAM The pointer \p stats is equal to NULL.
+ */
+int fwk_thread_get_stats(struct fwk_thread_stats *stats);
+
 /*!
  * \brief Get a copy of a delayed response event.
  *
@@ -88,6 +353,24 @@ int fwk_thread_put_event(struct fwk_event *event);
 int fwk_thread_get_delayed_response(fwk_id_t id, uint32_t cookie,
                                     struct fwk_event *event);
 
+/*!
+ * \brief Start a section of an event or notification handler that runs alone.
+ *
+ * \details The handlers of the modules that allow concurrent event processing
+ *      (see fwk_module::concurrent_event_processing) call it before calling
+ *      into modules that do not. Until the section ends, no other handler
+ *      runs. Sections may be nested.
+ *
+ *      The function does nothing when the handlers of the module do not run
+ *      concurrently.
+ */
+void fwk_thread_begin_exclusive(void);
+
+/*!
+ * \brief End a section started with fwk_thread_begin_exclusive().
+ */
+void fwk_thread_end_exclusive(void);
+
 /*!
  * @}
  */
@@ -0,0 +1,32 @@
+/*
+ * Arm SCP/MCP Software
+ * Copyright (c) 2015-2019, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Description:
+ *     Framework private memory management definitions.
+ */
+
+#ifndef FWK_INTERNAL_MM_H
+#define FWK_INTERNAL_MM_H
+
+#include <fwk_mm.h>
+
+/*
+ * \brief Select the memory usage record the subsequent allocations are
+ *      accounted to.
+ *
+ * \details The allocations are always accounted to the heap statistics
+ *      returned by fwk_mm_get_stats(). They are in addition accounted to the
+ *      selected record, if any.
+ *
+ * \note Only available when the build has memory accounting support.
+ *
+ * \param usage Pointer to the memory usage record of the entity currently
+ *      allocating memory. NULL if the allocations are not to be accounted to
+ *      any entity.
+ */
+void __fwk_mm_set_usage(struct fwk_mm_usage *usage);
+
+#endif /* FWK_INTERNAL_MM_H */
@@ -12,8 +12,11 @@
 #define FWK_INTERNAL_MODULE_H
 
 #include <stddef.h>
+#include <fwk_mm.h>
 #include <fwk_module.h>
+#include <fwk_profiling.h>
 #include <internal/fwk_notification.h>
+#include <internal/fwk_worker_pool.h>
 
 /*
  * Module context.
@@ -25,6 +28,16 @@ struct fwk_module_ctx {
     /* Module state */
     enum fwk_module_state state;
 
+    /* Flag indicating whether an asynchronous start of the module is pending */
+    bool start_pending;
+
+    /*
+     * Flag indicating whether the module is started or will be once the
+     * pending asynchronous starts complete. Only meaningful while the start
+     * dependencies are being checked.
+     */
+    bool start_reachable;
+
     /* Module description */
     const struct fwk_module *desc;
 
@@ -46,10 +59,43 @@ struct fwk_module_ctx {
      * notification defined by the module.
      */
     struct fwk_dlist *subscription_dlist_table;
+
+    /*
+     * Table of frozen notification subscriptions. One table per type of
+     * notification defined by the module. NULL until the subscriptions are
+     * frozen.
+     */
+    struct __fwk_notification_frozen_list *frozen_subscription_table;
     #endif
 
     /* List of delayed response events */
     struct fwk_slist delayed_response_list;
+
+    #ifdef BUILD_HAS_WORKER_POOL
+    /* Worker pool context of the events targeting the module */
+    struct __fwk_worker_pool_entity worker_pool_entity;
+    #endif
+
+    #ifdef BUILD_HAS_MM_ACCOUNTING
+    /* Memory allocated on behalf of the module, excluding its elements */
+    struct fwk_mm_usage mm_usage;
+    #endif
+
+    #ifdef BUILD_HAS_EVENT_PROFILING
+    /* Processing statistics of the events processed by the module entities */
+    struct fwk_profiling_stats profiling_stats;
+
+    /*
+     * Table of processing statistics of the events defined by the module. One
+     * entry per event.
+     */
+    struct fwk_profiling_stats *event_profiling_stats_table;
+    #endif
+
+    #ifdef BUILD_HAS_BOOT_PROFILING
+    /* Pre-runtime handler times of the module, excluding its elements */
+    struct fwk_profiling_boot_times boot_times;
+    #endif
 };
 
 /*
@@ -74,10 +120,35 @@ struct fwk_element_ctx {
      * notification defined by the element's module.
      */
     struct fwk_dlist *subscription_dlist_table;
+
+    /*
+     * Table of frozen notification subscriptions. One table per type of
+     * notification defined by the element's module. NULL until the
+     * subscriptions are frozen.
+     */
+    struct __fwk_notification_frozen_list *frozen_subscription_table;
     #endif
 
     /* List of delayed response events */
     struct fwk_slist delayed_response_list;
+
+    #ifdef BUILD_HAS_WORKER_POOL
+    /*
+     * Worker pool context of the events targeting the element and its
+     * sub-elements.
+     */
+    struct __fwk_worker_pool_entity worker_pool_entity;
+    #endif
+
+    #ifdef BUILD_HAS_MM_ACCOUNTING
+    /* Memory allocated on behalf of the element */
+    struct fwk_mm_usage mm_usage;
+    #endif
+
+    #ifdef BUILD_HAS_BOOT_PROFILING
+    /* Pre-runtime handler times of the element */
+    struct fwk_profiling_boot_times boot_times;
+    #endif
 };
 
 /*
@@ -123,6 +194,26 @@ int __fwk_module_get_state(fwk_id_t id, enum fwk_module_state *state);
  */
 struct fwk_element_ctx *__fwk_module_get_element_ctx(fwk_id_t element_id);
 
+/*
+ * \brief Activate the element targeted by an event or a binding request, if
+ *      its module initializes its elements lazily and it has not been
+ *      activated yet.
+ *
+ * \details Nothing is done for module identifiers and for the elements that
+ *      are already active, the function is cheap enough to be called for each
+ *      event processed.
+ *
+ * \param id Module, element or sub-element identifier.
+ *      If the identifier provided does not refer to a valid module, element or
+ *      sub-element, the behaviour of this function is undefined.
+ *
+ * \retval FWK_SUCCESS The element is active.
+ * \retval FWK_E_INIT The module of the element is not initialized yet.
+ * \return One of the other framework error codes returned by the handlers of
+ *      the module while activating the element.
+ */
+int __fwk_module_activate(fwk_id_t id);
+
 /*
  * \brief Reset the module framework component.
  *
@@ -12,7 +12,9 @@
 #include <fwk_event.h>
 #include <fwk_id.h>
 #include <fwk_list.h>
+#include <fwk_mm.h>
 #include <fwk_multi_thread.h>
+#include <fwk_thread.h>
 #include <internal/fwk_thread.h>
 #include <cmsis_os2.h>
 
@@ -40,6 +42,9 @@ struct __fwk_thread_ctx {
     /* Thread queue of events */
     struct fwk_slist event_queue;
 
+    /* Usage statistics of the thread queue of events */
+    struct fwk_thread_queue_stats event_queue_stats;
+
     /*
      * Flag indicating if the thread is waiting for the completion of the
      * processing of an event by another thread (true) or not (false). A thread
@@ -111,6 +116,27 @@ struct __fwk_multi_thread_ctx {
      * ready to execute as soon as the CPU becomes available for them.
      */
     struct fwk_slist thread_ready_queue;
+
+    /* Pool of out-of-line event parameter blocks, NULL if none configured */
+    struct fwk_mm_pool *ext_params_pool;
+
+    /* Timer driver the delayed events are scheduled with, NULL if none */
+    const struct fwk_thread_timer_driver *timer_driver;
+
+    /*
+     * Binary min-heap of the delayed events, ordered by timestamp. The table
+     * has room for as many delayed events as there are event structures.
+     */
+    struct __fwk_thread_delayed_event *delayed_event_heap;
+
+    /* Number of delayed events in the heap */
+    unsigned int delayed_event_count;
+
+    /* Flag set by the timer driver when its alarm has expired */
+    volatile bool timer_signaled;
+
+    /* Event usage statistics */
+    struct fwk_thread_stats stats;
 };
 
 /*
@@ -23,6 +23,29 @@ struct __fwk_notification_subscription {
     fwk_id_t target_id;
 };
 
+/*
+ * Subscription to a notification, once frozen into a table of subscriptions.
+ */
+struct __fwk_notification_subscriber {
+    /* Identifier of the notification source entity. */
+    fwk_id_t source_id;
+
+    /* Identifier of the notification target entity. */
+    fwk_id_t target_id;
+};
+
+/*
+ * Table of the subscriptions to a notification emitted by an entity, frozen
+ * at the end of the pre-runtime phase.
+ */
+struct __fwk_notification_frozen_list {
+    /* Table of subscribers, in subscription order. */
+    struct __fwk_notification_subscriber *subscriber_table;
+
+    /* Number of subscribers in the table. */
+    unsigned int subscriber_count;
+};
+
 /*
  * \brief Initialize the notification framework component.
  *
@@ -37,6 +60,24 @@ struct __fwk_notification_subscription {
  */
 int __fwk_notification_init(size_t notification_count);
 
+/*
+ * \brief Freeze the notification subscriptions.
+ *
+ * \details The subscriptions of each entity to each notification are moved
+ *      from their subscription list to a contiguous table, which is what the
+ *      notifications are sent from. The subscriptions made afterwards are
+ *      added to the subscription lists and are sent after the ones of the
+ *      table.
+ *
+ * \note This function is called once all the modules and elements have
+ *      started.
+ *
+ * \retval FWK_SUCCESS The subscriptions were frozen.
+ * \retval FWK_E_NOMEM Insufficient memory available to allocate the tables of
+ *      subscriptions.
+ */
+int __fwk_notification_freeze(void);
+
 /*
  * \brief Reset the notification framework component.
  *
@@ -0,0 +1,65 @@
+/*
+ * Arm SCP/MCP Software
+ * Copyright (c) 2015-2019, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Description:
+ *     Framework private event profiling definitions.
+ */
+
+#ifndef FWK_INTERNAL_PROFILING_H
+#define FWK_INTERNAL_PROFILING_H
+
+#include <stdint.h>
+#include <fwk_event.h>
+#include <fwk_profiling.h>
+
+/*
+ * \brief Timestamp an event as it is put in an event queue.
+ *
+ * \note Only available when the build has event profiling support. The
+ *      function may be called from an ISR.
+ *
+ * \param event Pointer to the event.
+ */
+void __fwk_profiling_stamp(struct fwk_event *event);
+
+/*
+ * \brief Get the current value of the profiling counter.
+ *
+ * \note Only available when the build has event or boot profiling support.
+ *
+ * \return The value of the counter, zero if no counter has been set.
+ */
+uint32_t __fwk_profiling_get_timestamp(void);
+
+/*
+ * \brief Account the processing of an event that has just completed to the
+ *      statistics of its target and of its event identifier.
+ *
+ * \note Only available when the build has event profiling support.
+ *
+ * \param event Pointer to the event.
+ * \param dispatch_timestamp Value of the profiling counter when the processing
+ *      of the event started.
+ */
+void __fwk_profiling_record(const struct fwk_event *event,
+                            uint32_t dispatch_timestamp);
+
+/*
+ * \brief Account the time taken by a pre-runtime handler that has just
+ *      returned to the boot times of a module or element.
+ *
+ * \note Only available when the build has boot profiling support.
+ *
+ * \param id Identifier of the module or element.
+ * \param stage Pre-runtime stage of the handler.
+ * \param begin_timestamp Value of the profiling counter when the handler was
+ *      called.
+ */
+void __fwk_profiling_record_boot_stage(fwk_id_t id,
+                                       enum fwk_profiling_boot_stage stage,
+                                       uint32_t begin_timestamp);
+
+#endif /* FWK_INTERNAL_PROFILING_H */
@@ -8,9 +8,84 @@
 #ifndef FWK_INTERNAL_SINGLE_THREAD_H
 #define FWK_INTERNAL_SINGLE_THREAD_H
 
+#include <stdatomic.h>
 #include <stdbool.h>
+#include <stdint.h>
 #include <fwk_event.h>
 #include <fwk_list.h>
+#include <fwk_mm.h>
+#include <fwk_thread.h>
+#include <internal/fwk_thread.h>
+
+/*
+ * Slot of the ring of events generated by ISRs.
+ */
+struct __fwk_thread_isr_event_slot {
+    /* Event */
+    struct fwk_event event;
+
+    /*
+     * Flag indicating whether the slot has been filled in by an ISR and not
+     * yet consumed by the thread.
+     */
+    atomic_bool ready;
+};
+
+/*
+ * Lock-free ring of events generated by ISRs.
+ *
+ * The producers are the ISRs, possibly nested. They reserve a slot by advancing
+ * 'head' atomically, fill it in and then publish it by setting its 'ready'
+ * flag. The consumer is the thread, the only one to advance 'tail'. Neither
+ * side has to mask the interrupts to access the ring.
+ */
+struct __fwk_thread_isr_event_ring {
+    /* Table of slots, the number of slots is a power of two */
+    struct __fwk_thread_isr_event_slot *slots;
+
+    /* Number of slots minus one, to wrap the ring indices around */
+    unsigned int mask;
+
+    /* Free-running index of the next slot to be reserved by an ISR */
+    atomic_uint head;
+
+    /* Free-running index of the next slot to be consumed by the thread */
+    atomic_uint tail;
+
+    /* Number of events that could not be put as the ring was full */
+    atomic_uint failed_put_count;
+};
+
+#ifdef BUILD_HAS_NOTIFICATION
+/*
+ * Notification payload shared by all the targets of the notification.
+ */
+struct __fwk_thread_shared_notification {
+    /*
+     * Notification event. Its target identifier is the one of the target the
+     * notification is being processed for.
+     */
+    struct fwk_event event;
+
+    /* Number of handles to the payload not yet processed */
+    unsigned int ref_count;
+};
+
+/*
+ * Handle to a shared notification payload. Queued in place of a copy of the
+ * notification event for one of its targets.
+ */
+struct __fwk_thread_notification_handle {
+    /* Linked list node */
+    struct fwk_slist_node slist_node;
+
+    /* Identifier of the target of the notification */
+    fwk_id_t target_id;
+
+    /* Shared notification payload */
+    struct __fwk_thread_shared_notification *notification;
+};
+#endif
 
 /*
  * Thread component context. Exposed for testing purposes only.
@@ -22,18 +97,73 @@ struct __fwk_thread_ctx {
 
     /*
      * Queue of event structures that are free to be filled in and linked
-     * to the event queue or the ISR event queue.
+     * to one of the event queues. The queue is only accessed by the thread.
      */
     struct fwk_slist free_event_queue;
 
-    /* Queue of events, generated by ISRs, that are awaiting processing */
-    struct fwk_slist isr_event_queue;
+    /* Ring of events, generated by ISRs, that are awaiting processing */
+    struct __fwk_thread_isr_event_ring isr_event_ring;
 
-    /* Queue of events that are awaiting processing */
-    struct fwk_slist event_queue;
+    /* Number of ISR events moved to the event queues at the last wakeup */
+    unsigned int isr_event_batch_count;
+
+    /* Maximum number of ISR events moved to the event queues at a wakeup */
+    unsigned int isr_event_batch_count_max;
+
+    /*
+     * Event usage statistics. The statistics of the ring of ISR events are
+     * only updated when the ring is drained, the number of events in the ring
+     * and the number of events that could not be put in it are kept in the
+     * ring itself.
+     */
+    struct fwk_thread_stats stats;
+
+    /*
+     * Queues of events that are awaiting processing, one per event priority
+     * and indexed by priority.
+     */
+    struct fwk_slist event_queue[FWK_EVENT_PRIORITY_COUNT];
 
     /* The event currently being processed */
     struct fwk_event *current_event;
+
+    /* Pool of out-of-line event parameter blocks */
+    struct fwk_mm_pool *ext_params_pool;
+
+    /* Timer driver the delayed events are scheduled with, NULL if none */
+    const struct fwk_thread_timer_driver *timer_driver;
+
+    /*
+     * Binary min-heap of the delayed events, ordered by timestamp. The table
+     * has room for as many delayed events as there are event structures.
+     */
+    struct __fwk_thread_delayed_event *delayed_event_heap;
+
+    /* Number of delayed events in the heap */
+    unsigned int delayed_event_count;
+
+    /* Flag set by the timer driver when its alarm has expired */
+    atomic_bool timer_signaled;
+
+    #ifdef BUILD_HAS_NOTIFICATION
+    /* Queue of shared notification payloads that are free to be used */
+    struct fwk_slist free_shared_notification_queue;
+
+    /* Queue of notification handles that are free to be used */
+    struct fwk_slist free_notification_handle_queue;
+
+    /* Table of notification handles */
+    struct __fwk_thread_notification_handle *notification_handle_table;
+
+    /* Number of notification handles */
+    unsigned int notification_handle_count;
+
+    /*
+     * Notification payload the notifications being put are sharing, NULL if
+     * no notification payload is being shared.
+     */
+    struct __fwk_thread_shared_notification *shared_notification;
+    #endif
 };
 
 /*
@@ -9,10 +9,45 @@
 #define FWK_INTERNAL_THREAD_H
 
 #include <stddef.h>
+#include <stdint.h>
 #include <fwk_event.h>
+#include <fwk_id.h>
 #include <fwk_noreturn.h>
 #include <fwk_thread.h>
 
+/*
+ * Event held by the framework until it is due.
+ */
+struct __fwk_thread_delayed_event {
+    /* Value of the counter of the timer the event is due at */
+    uint64_t timestamp;
+
+    /* Period in timer counter ticks of a periodic event, zero otherwise */
+    uint64_t period;
+
+    /* Event structure */
+    struct fwk_event *event;
+};
+
+/*
+ * \brief Check whether a new event can be coalesced with an event awaiting
+ *      processing.
+ *
+ * \details Both events must have the coalescing flag set and the same target
+ *      and identifier. Neither may be a response, a notification or an event
+ *      requesting a response.
+ *
+ * \param PENDING_EVENT Pointer to the event awaiting processing.
+ * \param EVENT Pointer to the new event.
+ */
+#define __FWK_THREAD_CAN_COALESCE(PENDING_EVENT, EVENT) \
+    ((PENDING_EVENT)->coalesce && (EVENT)->coalesce && \
+     !(PENDING_EVENT)->is_response && !(PENDING_EVENT)->is_notification && \
+     !(PENDING_EVENT)->response_requested && !(EVENT)->is_response && \
+     !(EVENT)->is_notification && !(EVENT)->response_requested && \
+     fwk_id_is_equal((PENDING_EVENT)->target_id, (EVENT)->target_id) && \
+     fwk_id_is_equal((PENDING_EVENT)->id, (EVENT)->id))
+
 /*
  * \brief Initialize the thread framework component.
  *
@@ -60,4 +95,35 @@ const struct fwk_event *__fwk_thread_get_current_event(void);
  */
 int __fwk_thread_put_notification(struct fwk_event *event);
 
+#ifndef BUILD_HAS_MULTITHREADING
+/*
+ * \brief Start sharing the payload of a notification between its targets.
+ *
+ * \details The notification event is copied once into a shared notification
+ *      payload. Until __fwk_thread_unshare_notification() is called, the
+ *      notifications put from the thread by __fwk_thread_put_notification()
+ *      are queued as lightweight handles to this payload instead of copies of
+ *      the notification event. The payload is released once the notification
+ *      has been processed for all its targets.
+ *
+ *      If there is no handle left, the notifications are copied as usual.
+ *
+ * \param event Pointer to the notification event.
+ *
+ * \retval FWK_SUCCESS The notification payload is shared.
+ * \retval FWK_E_HANDLER The function was called from an ISR.
+ * \retval FWK_E_STATE A notification payload is already being shared.
+ * \retval FWK_E_NOMEM No shared notification payload is free.
+ */
+int __fwk_thread_share_notification(const struct fwk_event *event);
+
+/*
+ * \brief Stop sharing the payload of a notification between its targets.
+ *
+ * \details The shared notification payload is released at once if no handle
+ *      to it has been queued.
+ */
+void __fwk_thread_unshare_notification(void);
+#endif
+
 #endif /* FWK_INTERNAL_THREAD_H */
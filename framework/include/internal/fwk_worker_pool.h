@@ -0,0 +1,187 @@
+/*
+ * Arm SCP/MCP Software
+ * Copyright (c) 2015-2019, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Description:
+ *     Framework private worker pool definitions.
+ */
+
+#ifndef FWK_INTERNAL_WORKER_POOL_H
+#define FWK_INTERNAL_WORKER_POOL_H
+
+#include <stdbool.h>
+#include <fwk_list.h>
+#include <fwk_noreturn.h>
+
+/* Maximum number of worker threads */
+#define __FWK_WORKER_POOL_WORKER_COUNT_MAX 16
+
+/*
+ * Worker pool context of a module or element.
+ *
+ * The events of a module or element are queued in its own event queue. While
+ * the queue is not empty and no worker is processing one of its events, the
+ * module or element is queued in the queue of ready entities of one of the
+ * workers. Its events are thus processed one at a time, in the order they were
+ * put.
+ */
+struct __fwk_worker_pool_entity {
+    /* Link in the queue of ready entities of a worker */
+    struct fwk_dlist_node dlist_node;
+
+    /* Queue of the events awaiting processing */
+    struct fwk_slist event_queue;
+
+    /* Flag indicating whether the entity is in a queue of ready entities */
+    bool ready;
+
+    /* Flag indicating whether one of its events is being processed */
+    bool busy;
+};
+
+/*
+ * \brief Initialize the worker pool.
+ *
+ * \param worker_count Number of worker threads, including the calling thread.
+ *      Zero to have one worker per online host CPU, capped to
+ *      __FWK_WORKER_POOL_WORKER_COUNT_MAX.
+ *
+ * \retval FWK_SUCCESS The worker pool was initialized.
+ * \retval FWK_E_NOMEM A memory allocation failed.
+ * \retval FWK_E_OS A host synchronization object could not be created.
+ */
+int __fwk_worker_pool_init(unsigned int worker_count);
+
+/*
+ * \brief Initialize the worker pool context of a module or element.
+ *
+ * \param entity Worker pool context of the module or element.
+ */
+void __fwk_worker_pool_init_entity(struct __fwk_worker_pool_entity *entity);
+
+/*
+ * \brief Lock the framework state shared between the workers.
+ *
+ * \details The lock is recursive. The framework functions that may be called
+ *      from the event handlers running concurrently take it.
+ */
+void __fwk_worker_pool_lock(void);
+
+/*
+ * \brief Unlock the framework state shared between the workers.
+ */
+void __fwk_worker_pool_unlock(void);
+
+/*
+ * \brief Lock and unlock the framework state when the build processes the
+ *      events with the worker pool (BUILD_HAS_WORKER_POOL), do nothing
+ *      otherwise.
+ */
+#ifdef BUILD_HAS_WORKER_POOL
+#define __FWK_WORKER_POOL_LOCK() __fwk_worker_pool_lock()
+#define __FWK_WORKER_POOL_UNLOCK() __fwk_worker_pool_unlock()
+#else
+#define __FWK_WORKER_POOL_LOCK() do { } while (0)
+#define __FWK_WORKER_POOL_UNLOCK() do { } while (0)
+#endif
+
+/*
+ * \brief Queue an event of a module or element.
+ *
+ * \note The framework lock must be held.
+ *
+ * \param entity Worker pool context of the target of the event.
+ * \param node Node of the event.
+ */
+void __fwk_worker_pool_queue(struct __fwk_worker_pool_entity *entity,
+                             struct fwk_slist_node *node);
+
+/*
+ * \brief Get the next event to process by a worker.
+ *
+ * \details The worker takes the most recently readied entity of its own queue
+ *      of ready entities. If its queue is empty, it steals the least recently
+ *      readied entity of the queue of another worker. The entity is busy until
+ *      the worker calls __fwk_worker_pool_complete().
+ *
+ * \note The framework lock must be held.
+ *
+ * \param worker_idx Index of the worker.
+ * \param [out] entity Worker pool context of the target of the event.
+ *
+ * \return The node of the event, NULL if no event is awaiting processing.
+ */
+struct fwk_slist_node *__fwk_worker_pool_get_next(unsigned int worker_idx,
+    struct __fwk_worker_pool_entity **entity);
+
+/*
+ * \brief Complete the processing of an event by a worker.
+ *
+ * \details If the target of the event has other events awaiting processing,
+ *      it is queued in the queue of ready entities of the worker.
+ *
+ * \note The framework lock must be held.
+ *
+ * \param worker_idx Index of the worker.
+ * \param entity Worker pool context of the target of the event.
+ */
+void __fwk_worker_pool_complete(unsigned int worker_idx,
+                                struct __fwk_worker_pool_entity *entity);
+
+/*
+ * \brief Release the framework lock to call an event handler.
+ *
+ * \details The handlers of the modules that allow concurrent event processing
+ *      run concurrently with each other. The other handlers run alone.
+ *
+ * \param concurrent Whether the handler may run concurrently with other ones.
+ */
+void __fwk_worker_pool_begin_handler(bool concurrent);
+
+/*
+ * \brief Take the framework lock back once an event handler has returned.
+ *
+ * \param concurrent Value passed to __fwk_worker_pool_begin_handler().
+ */
+void __fwk_worker_pool_end_handler(bool concurrent);
+
+/*
+ * \brief Start a section of a handler that runs alone.
+ *
+ * \details Does nothing when the calling thread does not run a handler that
+ *      may run concurrently. Sections may be nested.
+ */
+void __fwk_worker_pool_begin_exclusive(void);
+
+/*
+ * \brief End a section started with __fwk_worker_pool_begin_exclusive().
+ */
+void __fwk_worker_pool_end_exclusive(void);
+
+/*
+ * \brief Start the workers and process events until the end of times.
+ *
+ * \details The calling thread becomes the first worker.
+ *
+ * \param process_event Function processing an event, called with the framework
+ *      lock held.
+ * \param process_isr Function moving the events put by ISRs to the event
+ *      queues, called with the framework lock held when a worker is idle.
+ *      Returns whether an event was moved.
+ *
+ * \return The function does not return.
+ */
+noreturn void __fwk_worker_pool_run(
+    void (*process_event)(struct fwk_slist_node *node),
+    bool (*process_isr)(void));
+
+/*
+ * \brief Reset the worker pool.
+ *
+ * \note Only for testing.
+ */
+void __fwk_worker_pool_reset(void);
+
+#endif /* FWK_INTERNAL_WORKER_POOL_H */
@@ -17,14 +17,62 @@
 #include <string.h>
 #include <fwk_assert.h>
 #include <fwk_errno.h>
+#include <fwk_interrupt.h>
 #include <fwk_macros.h>
 #include <fwk_mm.h>
+#include <internal/fwk_mm.h>
+
+struct fwk_mm_pool {
+    /* First free block, each free block stores a pointer to the next one */
+    void *free_block;
+
+    /* Start address of the block table */
+    uintptr_t block_table;
+
+    /* Size of the blocks as requested when creating the pool */
+    size_t block_size;
+
+    /* Distance in bytes between two consecutive blocks */
+    size_t block_stride;
+
+    /* Number of blocks */
+    unsigned int block_count;
+
+    /* Number of blocks currently allocated */
+    unsigned int used_count;
+
+    /* Maximum number of blocks allocated at the same time */
+    unsigned int used_count_max;
+
+    /* Number of failed allocation requests */
+    unsigned int failed_alloc_count;
+};
 
 static bool initialized;
 static bool mm_locked;
+static uintptr_t heap_start;
 static uintptr_t heap_free;
 static uintptr_t heap_end;
 
+/* Usage of the heap by all the entities */
+static struct fwk_mm_usage heap_usage;
+
+/* Number of failed allocation requests */
+static unsigned int failed_alloc_count;
+
+#ifdef BUILD_HAS_MM_ACCOUNTING
+/* Usage record of the entity currently allocating memory, if any */
+static struct fwk_mm_usage *current_usage;
+#endif
+
+static void account_alloc(struct fwk_mm_usage *usage, size_t allocated_size,
+                          size_t padding_size)
+{
+    usage->allocated_size += allocated_size;
+    usage->padding_size += padding_size;
+    usage->alloc_count++;
+}
+
 /*
  * Initialize the memory management component.
  *
@@ -43,6 +91,7 @@ int fwk_mm_init(uintptr_t start, size_t size)
     if ((start == 0) || (size == 0))
         return FWK_E_RANGE;
 
+    heap_start = start;
     heap_free = start;
     heap_end = start + size;
 
@@ -90,11 +139,18 @@ void *fwk_mm_alloc_aligned(size_t num, size_t size, unsigned int alignment)
     if (total_size > (heap_end - start))
         goto error;
 
+    account_alloc(&heap_usage, total_size, start - heap_free);
+    #ifdef BUILD_HAS_MM_ACCOUNTING
+    if (current_usage != NULL)
+        account_alloc(current_usage, total_size, start - heap_free);
+    #endif
+
     heap_free = start + total_size;
 
     return (void *)start;
 
 error:
+    failed_alloc_count++;
     fwk_expect(false);
     return NULL;
 }
@@ -115,6 +171,169 @@ void *fwk_mm_calloc_aligned(size_t num, size_t size, unsigned int alignment)
     return start;
 }
 
+int fwk_mm_get_stats(struct fwk_mm_stats *stats)
+{
+    if (stats == NULL)
+        return FWK_E_PARAM;
+
+    if (!initialized)
+        return FWK_E_STATE;
+
+    *stats = (struct fwk_mm_stats) {
+        .heap_size = heap_end - heap_start,
+        .free_size = heap_end - heap_free,
+        .failed_alloc_count = failed_alloc_count,
+        .usage = heap_usage,
+    };
+
+    return FWK_SUCCESS;
+}
+
+#ifdef BUILD_HAS_MM_ACCOUNTING
+void __fwk_mm_set_usage(struct fwk_mm_usage *usage)
+{
+    current_usage = usage;
+}
+#endif
+
+struct fwk_mm_pool *fwk_mm_pool_create(size_t block_size,
+                                       unsigned int block_count)
+{
+    struct fwk_mm_pool *pool;
+    size_t block_stride;
+    unsigned int block_idx;
+    void **block;
+
+    if ((block_size == 0) || (block_count == 0))
+        goto error;
+
+    /* Each free block must be able to hold a pointer to the next free one */
+    block_stride = FWK_MAX(block_size, sizeof(void *));
+    block_stride = FWK_ALIGN_NEXT(block_stride, FWK_MM_DEFAULT_ALIGNMENT);
+    if (block_stride < block_size)
+        goto error;
+
+    pool = fwk_mm_calloc(1, sizeof(struct fwk_mm_pool));
+    if (pool == NULL)
+        return NULL;
+
+    pool->block_table = (uintptr_t)fwk_mm_alloc(block_count, block_stride);
+    if (pool->block_table == 0)
+        return NULL;
+
+    pool->block_size = block_size;
+    pool->block_stride = block_stride;
+    pool->block_count = block_count;
+
+    /* Chain all the blocks together, in address order */
+    for (block_idx = 0; block_idx < block_count; block_idx++) {
+        block = (void **)(pool->block_table + (block_idx * block_stride));
+        *block = (block_idx == (block_count - 1)) ?
+                 NULL : (void *)((uintptr_t)block + block_stride);
+    }
+    pool->free_block = (void *)pool->block_table;
+
+    return pool;
+
+error:
+    fwk_expect(false);
+    return NULL;
+}
+
+void *fwk_mm_pool_alloc(struct fwk_mm_pool *pool)
+{
+    void *block;
+
+    assert(pool != NULL);
+
+    fwk_interrupt_global_disable();
+
+    block = pool->free_block;
+    if (block == NULL)
+        pool->failed_alloc_count++;
+    else {
+        pool->free_block = *(void **)block;
+        pool->used_count++;
+        if (pool->used_count > pool->used_count_max)
+            pool->used_count_max = pool->used_count;
+    }
+
+    fwk_interrupt_global_enable();
+
+    return block;
+}
+
+int fwk_mm_pool_free(struct fwk_mm_pool *pool, void *block)
+{
+    uintptr_t offset;
+    int status = FWK_SUCCESS;
+    #ifdef BUILD_MODE_DEBUG
+    void *free_block;
+    #endif
+
+    assert(pool != NULL);
+
+    if ((uintptr_t)block < pool->block_table)
+        return FWK_E_PARAM;
+
+    offset = (uintptr_t)block - pool->block_table;
+    if ((offset % pool->block_stride) != 0)
+        return FWK_E_PARAM;
+    if ((offset / pool->block_stride) >= pool->block_count)
+        return FWK_E_PARAM;
+
+    fwk_interrupt_global_disable();
+
+    /* The block has been freed already if no block is allocated */
+    if (pool->used_count == 0) {
+        status = FWK_E_STATE;
+        goto exit;
+    }
+
+    #ifdef BUILD_MODE_DEBUG
+    /* Look for the block in the free blocks to detect double frees */
+    for (free_block = pool->free_block; free_block != NULL;
+         free_block = *(void **)free_block) {
+        if (free_block == block) {
+            status = FWK_E_STATE;
+            goto exit;
+        }
+    }
+    #endif
+
+    *(void **)block = pool->free_block;
+    pool->free_block = block;
+    pool->used_count--;
+
+exit:
+    fwk_interrupt_global_enable();
+
+    fwk_expect(status == FWK_SUCCESS);
+
+    return status;
+}
+
+int fwk_mm_pool_get_stats(const struct fwk_mm_pool *pool,
+                          struct fwk_mm_pool_stats *stats)
+{
+    if ((pool == NULL) || (stats == NULL))
+        return FWK_E_PARAM;
+
+    fwk_interrupt_global_disable();
+
+    *stats = (struct fwk_mm_pool_stats) {
+        .block_size = pool->block_size,
+        .block_count = pool->block_count,
+        .used_count = pool->used_count,
+        .used_count_max = pool->used_count_max,
+        .failed_alloc_count = pool->failed_alloc_count,
+    };
+
+    fwk_interrupt_global_enable();
+
+    return FWK_SUCCESS;
+}
+
 #ifdef __NEWLIB__
 void *_sbrk(intptr_t increment)
 {
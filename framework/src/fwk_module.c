@@ -13,8 +13,14 @@
 #include <fwk_errno.h>
 #include <fwk_host.h>
 #include <fwk_mm.h>
+#ifdef BUILD_HAS_MM_ACCOUNTING
+#include <internal/fwk_mm.h>
+#endif
 #include <internal/fwk_module.h>
 #include <internal/fwk_thread.h>
+#ifdef BUILD_HAS_BOOT_PROFILING
+#include <internal/fwk_profiling.h>
+#endif
 #ifdef BUILD_HAS_NOTIFICATION
 #include <internal/fwk_notification.h>
 #endif
@@ -23,6 +29,9 @@
 #define NOTIFICATION_COUNT 64
 #define BIND_ROUND_MAX 1
 
+/* Number of entries of the boot report printed by host firmware */
+#define BOOT_REPORT_ENTRY_COUNT 16
+
 /* Pre-runtime phase stages */
 enum module_stage {
     MODULE_STAGE_INITIALIZE,
@@ -48,6 +57,20 @@ struct context {
      * elements as part as of the binding stage.
      */
     fwk_id_t bind_id;
+
+    /* Flag indicating whether the modules ready to start are being started */
+    bool starting_modules;
+
+    /*
+     * Flag indicating whether an element initialized lazily is being
+     * activated, its binding requests are then allowed at runtime.
+     */
+    bool activating_element;
+
+    #ifdef BUILD_HAS_MM_ACCOUNTING
+    /* Memory usage record the memory allocations are accounted to */
+    struct fwk_mm_usage *mm_usage;
+    #endif
 };
 
 extern const struct fwk_module *module_table[];
@@ -55,6 +78,8 @@ extern const struct fwk_module_config *module_config_table[];
 
 static struct context ctx;
 
+struct __fwk_module_callable_map __fwk_module_callable_map;
+
 #ifdef BUILD_HOST
 static const char err_msg_line[] = "[MOD] Error %d in %s @%d\n";
 static const char err_msg_func[] = "[MOD] Error %d in %s\n";
@@ -64,6 +89,183 @@ static const char err_msg_func[] = "[MOD] Error %d in %s\n";
  * Static functions
  */
 
+#ifdef BUILD_HAS_MM_ACCOUNTING
+static void account_mm_to(struct fwk_mm_usage *usage)
+{
+    ctx.mm_usage = usage;
+    __fwk_mm_set_usage(usage);
+}
+#endif
+
+/*
+ * Account the subsequent memory allocations to a module, or to no entity if
+ * 'module_ctx' is NULL.
+ */
+static void account_mm_to_module(struct fwk_module_ctx *module_ctx)
+{
+    #ifdef BUILD_HAS_MM_ACCOUNTING
+    account_mm_to((module_ctx == NULL) ? NULL : &module_ctx->mm_usage);
+    #else
+    (void)module_ctx;
+    #endif
+}
+
+/* Account the subsequent memory allocations to an element */
+static void account_mm_to_element(struct fwk_element_ctx *element_ctx)
+{
+    #ifdef BUILD_HAS_MM_ACCOUNTING
+    account_mm_to(&element_ctx->mm_usage);
+    #else
+    (void)element_ctx;
+    #endif
+}
+
+/* Get the timestamp of the call to a pre-runtime handler */
+static uint32_t begin_boot_stage(void)
+{
+    #ifdef BUILD_HAS_BOOT_PROFILING
+    return __fwk_profiling_get_timestamp();
+    #else
+    return 0;
+    #endif
+}
+
+/* Account the time taken by a pre-runtime handler to a module or element */
+static void end_boot_stage(fwk_id_t id, enum fwk_profiling_boot_stage stage,
+                           uint32_t begin_timestamp)
+{
+    #ifdef BUILD_HAS_BOOT_PROFILING
+    __fwk_profiling_record_boot_stage(id, stage, begin_timestamp);
+    #else
+    (void)id;
+    (void)stage;
+    (void)begin_timestamp;
+    #endif
+}
+
+#ifdef BUILD_HAS_MM_ACCOUNTING
+static void add_mm_usage(struct fwk_mm_usage *usage,
+                         const struct fwk_mm_usage *addend)
+{
+    usage->allocated_size += addend->allocated_size;
+    usage->padding_size += addend->padding_size;
+    usage->alloc_count += addend->alloc_count;
+}
+
+#ifdef BUILD_HOST
+static void print_mm_usage(void)
+{
+    unsigned int module_idx;
+    const struct fwk_module_ctx *module_ctx;
+    struct fwk_mm_stats stats;
+    struct fwk_mm_usage usage;
+    struct fwk_mm_usage module_usage = { 0 };
+
+    if (fwk_mm_get_stats(&stats) != FWK_SUCCESS)
+        return;
+
+    FWK_HOST_PRINT("[MOD] Heap: %zu bytes, %zu allocated, %zu padding, "
+                   "%zu free\n", stats.heap_size, stats.usage.allocated_size,
+                   stats.usage.padding_size, stats.free_size);
+
+    for (module_idx = 0; module_idx < ctx.module_count; module_idx++) {
+        module_ctx = &ctx.module_ctx_table[module_idx];
+        fwk_module_get_mm_usage(module_ctx->id, &usage);
+        add_mm_usage(&module_usage, &usage);
+
+        FWK_HOST_PRINT("[MOD]   %s: %zu allocated, %zu padding, "
+                       "%u allocations\n", module_ctx->desc->name,
+                       usage.allocated_size, usage.padding_size,
+                       usage.alloc_count);
+    }
+
+    FWK_HOST_PRINT("[MOD]   Framework: %zu allocated, %zu padding, "
+                   "%u allocations\n",
+                   stats.usage.allocated_size - module_usage.allocated_size,
+                   stats.usage.padding_size - module_usage.padding_size,
+                   stats.usage.alloc_count - module_usage.alloc_count);
+}
+#endif
+#endif
+
+#if defined(BUILD_HAS_BOOT_PROFILING) && defined(BUILD_HOST)
+static void print_boot_report(void)
+{
+    struct fwk_profiling_boot_entry entry_table[BOOT_REPORT_ENTRY_COUNT];
+    unsigned int entry_count = BOOT_REPORT_ENTRY_COUNT;
+    unsigned int entry_idx;
+    const struct fwk_profiling_boot_entry *entry;
+    const uint32_t *stage_times;
+    bool is_element;
+
+    if (fwk_profiling_get_boot_report(entry_table, &entry_count) !=
+        FWK_SUCCESS)
+        return;
+
+    FWK_HOST_PRINT("[MOD] Boot time in counter ticks: total (init, post-init, "
+                   "bind, start)\n");
+
+    for (entry_idx = 0; entry_idx < entry_count; entry_idx++) {
+        entry = &entry_table[entry_idx];
+        if (entry->times.total == 0)
+            break;
+
+        stage_times = entry->times.stage_times;
+        is_element = fwk_id_is_type(entry->id, FWK_ID_TYPE_ELEMENT);
+
+        FWK_HOST_PRINT("[MOD]   %s%s%s: %u (%u, %u, %u, %u)\n",
+            fwk_module_get_name(fwk_id_build_module_id(entry->id)),
+            is_element ? "/" : "",
+            is_element ? fwk_module_get_name(entry->id) : "",
+            entry->times.total,
+            stage_times[FWK_PROFILING_BOOT_STAGE_INIT],
+            stage_times[FWK_PROFILING_BOOT_STAGE_POST_INIT],
+            stage_times[FWK_PROFILING_BOOT_STAGE_BIND_ROUND_0] +
+            stage_times[FWK_PROFILING_BOOT_STAGE_BIND_ROUND_1],
+            stage_times[FWK_PROFILING_BOOT_STAGE_START]);
+    }
+}
+#endif
+
+static bool is_callable_state(enum fwk_module_state state)
+{
+    return (state != FWK_MODULE_STATE_UNINITIALIZED) &&
+           (state != FWK_MODULE_STATE_SUSPENDED);
+}
+
+static void update_callable_bit(unsigned int module_idx, unsigned int bit_idx,
+                                enum fwk_module_state state)
+{
+    struct __fwk_module_callable_map *map = &__fwk_module_callable_map;
+    uint32_t mask;
+
+    if (map->bitmap == NULL)
+        return;
+
+    bit_idx += map->bit_idx_table[module_idx];
+    mask = UINT32_C(1) << (bit_idx % __FWK_MODULE_CALLABLE_WORD_BITS);
+    if (is_callable_state(state))
+        map->bitmap[bit_idx / __FWK_MODULE_CALLABLE_WORD_BITS] |= mask;
+    else
+        map->bitmap[bit_idx / __FWK_MODULE_CALLABLE_WORD_BITS] &= ~mask;
+}
+
+static void set_module_state(struct fwk_module_ctx *module_ctx,
+                             enum fwk_module_state state)
+{
+    module_ctx->state = state;
+    update_callable_bit(fwk_id_get_module_idx(module_ctx->id), 0, state);
+}
+
+static void set_element_state(struct fwk_module_ctx *module_ctx,
+                              unsigned int element_idx,
+                              enum fwk_module_state state)
+{
+    module_ctx->element_ctx_table[element_idx].state = state;
+    update_callable_bit(fwk_id_get_module_idx(module_ctx->id),
+                        1 + element_idx, state);
+}
+
 #ifdef BUILD_HAS_NOTIFICATION
 static int init_notification_dlist_table(size_t count,
     struct fwk_dlist **notification_dlist_table)
@@ -85,13 +287,59 @@ static int init_notification_dlist_table(size_t count,
 }
 #endif
 
+/*
+ * Initialize an element whose description has already been recorded in its
+ * context: allocate its notification subscription lists and call the
+ * element initialization function of its module.
+ */
+static int init_element(struct fwk_module_ctx *module_ctx,
+                        unsigned int element_idx)
+{
+    int status;
+    const struct fwk_module *module;
+    fwk_id_t element_id;
+    struct fwk_element_ctx *element_ctx;
+    const struct fwk_element *element;
+    uint32_t timestamp;
+
+    module = module_ctx->desc;
+    element_ctx = &module_ctx->element_ctx_table[element_idx];
+    element = element_ctx->desc;
+    element_id = fwk_id_build_element_id(module_ctx->id, element_idx);
+    ctx.bind_id = element_id;
+    account_mm_to_element(element_ctx);
+
+    /* Allocated already if a previous activation of the element failed */
+    #ifdef BUILD_HAS_NOTIFICATION
+    if ((module->notification_count) &&
+        (element_ctx->subscription_dlist_table == NULL)) {
+        status = init_notification_dlist_table(module->notification_count,
+            &element_ctx->subscription_dlist_table);
+        if (!fwk_expect(status == FWK_SUCCESS))
+            return status;
+    }
+    #endif
+
+    timestamp = begin_boot_stage();
+    status = module->element_init(
+        element_id, element->sub_element_count, element->data);
+    end_boot_stage(element_id, FWK_PROFILING_BOOT_STAGE_INIT, timestamp);
+    if (!fwk_expect(status == FWK_SUCCESS)) {
+        FWK_HOST_PRINT(err_msg_func, status, __func__);
+        return status;
+    }
+
+    set_element_state(module_ctx, element_idx, FWK_MODULE_STATE_INITIALIZED);
+
+    return FWK_SUCCESS;
+}
+
 static int init_elements(struct fwk_module_ctx *module_ctx,
                          const struct fwk_element *element_table)
 {
     int status;
     const struct fwk_module *module;
     unsigned int element_idx;
-    fwk_id_t element_id;
     struct fwk_element_ctx *element_ctx;
     const struct fwk_element *element;
 
@@ -110,8 +358,6 @@ static int init_elements(struct fwk_module_ctx *module_ctx,
 
         element_ctx = &module_ctx->element_ctx_table[element_idx];
         element = &element_table[element_idx];
-        element_id = fwk_id_build_element_id(module_ctx->id, element_idx);
-        ctx.bind_id = element_id;
 
         /* Each element must have a valid pointer to specific data */
         if (!fwk_expect(element->data != NULL)) {
@@ -122,29 +368,47 @@ static int init_elements(struct fwk_module_ctx *module_ctx,
         element_ctx->desc = element;
         element_ctx->sub_element_count = element->sub_element_count;
         fwk_list_init(&element_ctx->delayed_response_list);
-
-        #ifdef BUILD_HAS_NOTIFICATION
-        if (module->notification_count) {
-            status = init_notification_dlist_table(module->notification_count,
-                &element_ctx->subscription_dlist_table);
-            if (!fwk_expect(status == FWK_SUCCESS))
-                return status;
-        }
+        #ifdef BUILD_HAS_WORKER_POOL
+        __fwk_worker_pool_init_entity(&element_ctx->worker_pool_entity);
         #endif
 
-        status = module->element_init(
-            element_id, element->sub_element_count, element->data);
-        if (!fwk_expect(status == FWK_SUCCESS)) {
-            FWK_HOST_PRINT(err_msg_func, status, __func__);
-            return status;
-        }
+        /* The elements initialized lazily are initialized when activated */
+        if (module_ctx->config->lazy_element_init)
+            continue;
 
-        element_ctx->state = FWK_MODULE_STATE_INITIALIZED;
+        status = init_element(module_ctx, element_idx);
+        if (status != FWK_SUCCESS)
+            return status;
     }
 
     return FWK_SUCCESS;
 }
 
+static bool are_start_dependencies_valid(
+    const struct fwk_module_ctx *module_ctx,
+    const struct fwk_module_config *module_config)
+{
+    unsigned int dependency_idx;
+    fwk_id_t dependency_id;
+
+    if (module_config->start_dependency_count == 0)
+        return true;
+
+    if (module_config->start_dependency_table == NULL)
+        return false;
+
+    for (dependency_idx = 0;
+         dependency_idx < module_config->start_dependency_count;
+         dependency_idx++) {
+        dependency_id = module_config->start_dependency_table[dependency_idx];
+        if (!fwk_module_is_valid_module_id(dependency_id) ||
+            fwk_id_is_equal(dependency_id, module_ctx->id))
+            return false;
+    }
+
+    return true;
+}
+
 static int init_module(struct fwk_module_ctx *module_ctx,
                        const struct fwk_module *module,
                        const struct fwk_module_config *module_config)
@@ -152,12 +416,14 @@ static int init_module(struct fwk_module_ctx *module_ctx,
     int status;
     const struct fwk_element *element_table = NULL;
     unsigned int count;
+    uint32_t timestamp;
 
     if ((module->name == NULL) ||
         (module->type >= FWK_MODULE_TYPE_COUNT) ||
         (module->init == NULL) ||
         (module_config == NULL) ||
-        ((module->api_count > 0) && (module->process_bind_request == NULL))) {
+        ((module->api_count > 0) && (module->process_bind_request == NULL)) ||
+        !are_start_dependencies_valid(module_ctx, module_config)) {
         fwk_expect(false);
         return FWK_E_PARAM;
     }
@@ -165,7 +431,11 @@ static int init_module(struct fwk_module_ctx *module_ctx,
     module_ctx->desc = module;
     module_ctx->config = module_config;
     fwk_list_init(&module_ctx->delayed_response_list);
+    #ifdef BUILD_HAS_WORKER_POOL
+    __fwk_worker_pool_init_entity(&module_ctx->worker_pool_entity);
+    #endif
     ctx.bind_id = module_ctx->id;
+    account_mm_to_module(module_ctx);
 
     #ifdef BUILD_HAS_NOTIFICATION
     if (module->notification_count) {
@@ -176,6 +446,15 @@ static int init_module(struct fwk_module_ctx *module_ctx,
     }
     #endif
 
+    #ifdef BUILD_HAS_EVENT_PROFILING
+    if (module->event_count) {
+        module_ctx->event_profiling_stats_table = fwk_mm_calloc(
+            module->event_count, sizeof(struct fwk_profiling_stats));
+        if (!fwk_expect(module_ctx->event_profiling_stats_table != NULL))
+            return FWK_E_NOMEM;
+    }
+    #endif
+
     if (module_config->get_element_table != NULL) {
         element_table = module_config->get_element_table(module_ctx->id);
         if (!fwk_expect(element_table != NULL))
@@ -187,8 +466,10 @@ static int init_module(struct fwk_module_ctx *module_ctx,
         module_ctx->element_count = count;
     }
 
+    timestamp = begin_boot_stage();
     status = module->init(module_ctx->id, module_ctx->element_count,
                           module_config->data);
+    end_boot_stage(module_ctx->id, FWK_PROFILING_BOOT_STAGE_INIT, timestamp);
     if (!fwk_expect(status == FWK_SUCCESS)) {
         FWK_HOST_PRINT(err_msg_line, status, __func__, __LINE__);
         return status;
@@ -203,14 +484,60 @@ static int init_module(struct fwk_module_ctx *module_ctx,
     }
 
     if (module->post_init != NULL) {
+        account_mm_to_module(module_ctx);
+        timestamp = begin_boot_stage();
         status = module->post_init(module_ctx->id);
+        end_boot_stage(module_ctx->id, FWK_PROFILING_BOOT_STAGE_POST_INIT,
+                       timestamp);
         if (!fwk_expect(status == FWK_SUCCESS)) {
             FWK_HOST_PRINT(err_msg_line, status, __func__, __LINE__);
             return status;
         }
     }
 
-    module_ctx->state = FWK_MODULE_STATE_INITIALIZED;
+    set_module_state(module_ctx, FWK_MODULE_STATE_INITIALIZED);
+
+    return FWK_SUCCESS;
+}
+
+static int init_callable_bitmap(void)
+{
+    struct __fwk_module_callable_map *map = &__fwk_module_callable_map;
+    unsigned int module_idx, element_idx;
+    unsigned int bit_count = 0;
+    unsigned int *bit_idx_table;
+    uint32_t *bitmap;
+    struct fwk_module_ctx *module_ctx;
+
+    bit_idx_table = fwk_mm_calloc(ctx.module_count + 1, sizeof(unsigned int));
+    if (bit_idx_table == NULL)
+        return FWK_E_NOMEM;
+
+    for (module_idx = 0; module_idx < ctx.module_count; module_idx++) {
+        bit_idx_table[module_idx] = bit_count;
+        bit_count += 1 + ctx.module_ctx_table[module_idx].element_count;
+    }
+    bit_idx_table[ctx.module_count] = bit_count;
+
+    bitmap = fwk_mm_calloc(
+        (bit_count + __FWK_MODULE_CALLABLE_WORD_BITS - 1) /
+        __FWK_MODULE_CALLABLE_WORD_BITS, sizeof(uint32_t));
+    if (bitmap == NULL)
+        return FWK_E_NOMEM;
+
+    map->bit_idx_table = bit_idx_table;
+    map->module_count = ctx.module_count;
+    map->bitmap = bitmap;
+
+    for (module_idx = 0; module_idx < ctx.module_count; module_idx++) {
+        module_ctx = &ctx.module_ctx_table[module_idx];
+        set_module_state(module_ctx, module_ctx->state);
+        for (element_idx = 0; element_idx < module_ctx->element_count;
+             element_idx++) {
+            set_element_state(module_ctx, element_idx,
+                module_ctx->element_ctx_table[element_idx].state);
+        }
+    }
 
     return FWK_SUCCESS;
 }
@@ -242,6 +569,37 @@ static int init_modules(void)
         }
     }
 
+    account_mm_to_module(NULL);
+
+    status = init_callable_bitmap();
+    if (status != FWK_SUCCESS) {
+        FWK_HOST_PRINT(err_msg_line, status, __func__, __LINE__);
+        return status;
+    }
+
+    return FWK_SUCCESS;
+}
+
+static int bind_element(struct fwk_module_ctx *module_ctx,
+                        unsigned int element_idx, unsigned int round)
+{
+    int status;
+    uint32_t timestamp;
+
+    ctx.bind_id = fwk_id_build_element_id(module_ctx->id, element_idx);
+    account_mm_to_element(&module_ctx->element_ctx_table[element_idx]);
+    timestamp = begin_boot_stage();
+    status = module_ctx->desc->bind(ctx.bind_id, round);
+    end_boot_stage(ctx.bind_id, FWK_PROFILING_BOOT_STAGE_BIND_ROUND_0 + round,
+                   timestamp);
+    if (!fwk_expect(status == FWK_SUCCESS)) {
+        FWK_HOST_PRINT(err_msg_func, status, __func__);
+        return status;
+    }
+
+    if (round == BIND_ROUND_MAX)
+        set_element_state(module_ctx, element_idx, FWK_MODULE_STATE_BOUND);
+
     return FWK_SUCCESS;
 }
 
@@ -249,25 +607,22 @@ static int bind_elements(struct fwk_module_ctx *module_ctx,
                          unsigned int round)
 {
     int status;
-    const struct fwk_module *module;
     unsigned int element_idx;
 
-    module = module_ctx->desc;
-
     for (element_idx = 0; element_idx < module_ctx->element_count;
          element_idx++) {
 
-        ctx.bind_id = fwk_id_build_element_id(module_ctx->id, element_idx);
-        status = module->bind(ctx.bind_id, round);
-        if (!fwk_expect(status == FWK_SUCCESS)) {
-            FWK_HOST_PRINT(err_msg_func, status, __func__);
-            return status;
-        }
+        /*
+         * Skip the elements that have not been activated yet and the ones
+         * that have been bound when activated.
+         */
+        if (module_ctx->element_ctx_table[element_idx].state !=
+            FWK_MODULE_STATE_INITIALIZED)
+            continue;
 
-        if (round == BIND_ROUND_MAX) {
-            module_ctx->element_ctx_table[element_idx].state =
-                FWK_MODULE_STATE_BOUND;
-        }
+        status = bind_element(module_ctx, element_idx, round);
+        if (status != FWK_SUCCESS)
+            return status;
     }
 
     return FWK_SUCCESS;
@@ -278,22 +633,27 @@ static int bind_module(struct fwk_module_ctx *module_ctx,
 {
     int status;
     const struct fwk_module *module;
+    uint32_t timestamp;
 
     module = module_ctx->desc;
     if (module->bind == NULL) {
-        module_ctx->state = FWK_MODULE_STATE_BOUND;
+        set_module_state(module_ctx, FWK_MODULE_STATE_BOUND);
         return FWK_SUCCESS;
     }
 
     ctx.bind_id = module_ctx->id;
+    account_mm_to_module(module_ctx);
+    timestamp = begin_boot_stage();
     status = module->bind(module_ctx->id, round);
+    end_boot_stage(module_ctx->id,
+                   FWK_PROFILING_BOOT_STAGE_BIND_ROUND_0 + round, timestamp);
     if (!fwk_expect(status == FWK_SUCCESS)) {
         FWK_HOST_PRINT(err_msg_func, status, __func__);
         return status;
     }
 
     if (round == BIND_ROUND_MAX)
-        module_ctx->state = FWK_MODULE_STATE_BOUND;
+        set_module_state(module_ctx, FWK_MODULE_STATE_BOUND);
 
     return bind_elements(module_ctx, round);
 }
@@ -311,30 +671,58 @@ static int bind_modules(unsigned int round)
             return status;
     }
 
+    account_mm_to_module(NULL);
+
     return FWK_SUCCESS;
 }
 
-static int start_elements(struct fwk_module_ctx *module_ctx)
+static int start_element(struct fwk_module_ctx *module_ctx,
+                         unsigned int element_idx)
 {
     int status;
     const struct fwk_module *module;
-    unsigned int element_idx;
+    fwk_id_t element_id;
+    uint32_t timestamp;
 
     module = module_ctx->desc;
+    if (module->start != NULL) {
+        element_id = fwk_id_build_element_id(module_ctx->id, element_idx);
+        account_mm_to_element(&module_ctx->element_ctx_table[element_idx]);
+        timestamp = begin_boot_stage();
+        status = module->start(element_id);
+        end_boot_stage(element_id, FWK_PROFILING_BOOT_STAGE_START, timestamp);
+        if (!fwk_expect(status == FWK_SUCCESS)) {
+            FWK_HOST_PRINT(err_msg_func, status, __func__);
+            return status;
+        }
+    }
+
+    set_element_state(module_ctx, element_idx, FWK_MODULE_STATE_STARTED);
+
+    return FWK_SUCCESS;
+}
+
+static int start_elements(struct fwk_module_ctx *module_ctx)
+{
+    int status;
+    unsigned int element_idx;
+    enum fwk_module_state state;
+
     for (element_idx = 0; element_idx < module_ctx->element_count;
          element_idx++) {
 
-        if (module->start != NULL) {
-            status = module->start(
-                fwk_id_build_element_id(module_ctx->id, element_idx));
-            if (!fwk_expect(status == FWK_SUCCESS)) {
-                FWK_HOST_PRINT(err_msg_func, status, __func__);
-                return status;
-            }
-        }
+        /*
+         * Skip the elements that have not been activated yet and the ones
+         * that have been started when activated.
+         */
+        state = module_ctx->element_ctx_table[element_idx].state;
+        if ((state == FWK_MODULE_STATE_UNINITIALIZED) ||
+            (state == FWK_MODULE_STATE_STARTED))
+            continue;
 
-        module_ctx->element_ctx_table[element_idx].state =
-            FWK_MODULE_STATE_STARTED;
+        status = start_element(module_ctx, element_idx);
+        if (status != FWK_SUCCESS)
+            return status;
     }
 
     return FWK_SUCCESS;
@@ -344,36 +732,199 @@ static int start_module(struct fwk_module_ctx *module_ctx)
 {
     int status;
     const struct fwk_module *module;
+    uint32_t timestamp;
 
     module = module_ctx->desc;
 
+    /* The module may complete its start from within its start function */
+    if (module->async_start)
+        module_ctx->start_pending = true;
+
     if (module->start != NULL) {
+        account_mm_to_module(module_ctx);
+        timestamp = begin_boot_stage();
         status = module->start(module_ctx->id);
+        end_boot_stage(module_ctx->id, FWK_PROFILING_BOOT_STAGE_START,
+                       timestamp);
         if (!fwk_expect(status == FWK_SUCCESS)) {
             FWK_HOST_PRINT(err_msg_func, status, __func__);
             return status;
         }
     }
 
-    module_ctx->state = FWK_MODULE_STATE_STARTED;
+    if (!module->async_start)
+        set_module_state(module_ctx, FWK_MODULE_STATE_STARTED);
 
     return start_elements(module_ctx);
 }
 
+static bool is_ready_to_start(const struct fwk_module_ctx *module_ctx)
+{
+    const struct fwk_module_config *module_config = module_ctx->config;
+    unsigned int dependency_idx;
+    fwk_id_t dependency_id;
+
+    if ((module_ctx->state != FWK_MODULE_STATE_BOUND) ||
+        module_ctx->start_pending)
+        return false;
+
+    for (dependency_idx = 0;
+         dependency_idx < module_config->start_dependency_count;
+         dependency_idx++) {
+        dependency_id = module_config->start_dependency_table[dependency_idx];
+        if (__fwk_module_get_ctx(dependency_id)->state !=
+            FWK_MODULE_STATE_STARTED)
+            return false;
+    }
+
+    return true;
+}
+
+/*
+ * Start the modules whose start dependencies are met, until no more module
+ * can be started. Starting a module may meet the dependencies of a module that
+ * precedes it in the module table, hence the repeated passes.
+ */
 static int start_modules(void)
 {
-    int status;
+    int status = FWK_SUCCESS;
     unsigned int module_idx;
     struct fwk_module_ctx *module_ctx;
+    bool started;
+
+    ctx.starting_modules = true;
+
+    do {
+        started = false;
+
+        for (module_idx = 0; module_idx < ctx.module_count; module_idx++) {
+            module_ctx = &ctx.module_ctx_table[module_idx];
+            if (!is_ready_to_start(module_ctx))
+                continue;
+
+            status = start_module(module_ctx);
+            if (status != FWK_SUCCESS)
+                goto exit;
+
+            started = true;
+        }
+    } while (started);
+
+exit:
+    ctx.starting_modules = false;
+    account_mm_to_module(NULL);
+
+    return status;
+}
+
+/*
+ * Check whether the start dependencies of a module are started, or will be
+ * once the pending asynchronous starts complete.
+ */
+static bool are_start_dependencies_reachable(
+    const struct fwk_module_ctx *module_ctx)
+{
+    const struct fwk_module_config *module_config = module_ctx->config;
+    unsigned int dependency_idx;
+    fwk_id_t dependency_id;
+
+    for (dependency_idx = 0;
+         dependency_idx < module_config->start_dependency_count;
+         dependency_idx++) {
+        dependency_id = module_config->start_dependency_table[dependency_idx];
+        if (!__fwk_module_get_ctx(dependency_id)->start_reachable)
+            return false;
+    }
+
+    return true;
+}
+
+/*
+ * Check that the modules that are not started yet can still be started, that
+ * is that each of them depends, directly or transitively, only on modules that
+ * are started or whose asynchronous start is in progress. The modules
+ * depending on a cycle of start dependencies are never reached.
+ */
+static bool can_start_remaining_modules(void)
+{
+    unsigned int module_idx;
+    struct fwk_module_ctx *module_ctx;
+    bool reached;
 
     for (module_idx = 0; module_idx < ctx.module_count; module_idx++) {
         module_ctx = &ctx.module_ctx_table[module_idx];
-        status = start_module(module_ctx);
-        if (status != FWK_SUCCESS)
-            return status;
+        module_ctx->start_reachable =
+            (module_ctx->state == FWK_MODULE_STATE_STARTED) ||
+            module_ctx->start_pending;
     }
 
-    return FWK_SUCCESS;
+    do {
+        reached = false;
+
+        for (module_idx = 0; module_idx < ctx.module_count; module_idx++) {
+            module_ctx = &ctx.module_ctx_table[module_idx];
+            if (module_ctx->start_reachable ||
+                !are_start_dependencies_reachable(module_ctx))
+                continue;
+
+            module_ctx->start_reachable = true;
+            reached = true;
+        }
+    } while (reached);
+
+    for (module_idx = 0; module_idx < ctx.module_count; module_idx++) {
+        if (!ctx.module_ctx_table[module_idx].start_reachable)
+            return false;
+    }
+
+    return true;
+}
+
+/*
+ * Activate an element initialized lazily: initialize it and take it through
+ * the pre-runtime stages its module has already gone through.
+ */
+static int activate_element(struct fwk_module_ctx *module_ctx,
+                            unsigned int element_idx)
+{
+    int status;
+    unsigned int round;
+    fwk_id_t bind_id = ctx.bind_id;
+    bool activating_element = ctx.activating_element;
+    #ifdef BUILD_HAS_MM_ACCOUNTING
+    struct fwk_mm_usage *mm_usage = ctx.mm_usage;
+    #endif
+
+    ctx.activating_element = true;
+
+    status = init_element(module_ctx, element_idx);
+    if (status != FWK_SUCCESS)
+        goto exit;
+
+    /* The element is bound and started with the other elements if not past */
+    if (ctx.stage == MODULE_STAGE_INITIALIZE)
+        goto exit;
+
+    if (module_ctx->desc->bind != NULL) {
+        for (round = 0; round <= BIND_ROUND_MAX; round++) {
+            status = bind_element(module_ctx, element_idx, round);
+            if (status != FWK_SUCCESS)
+                goto exit;
+        }
+    }
+
+    if ((module_ctx->state == FWK_MODULE_STATE_STARTED) ||
+        module_ctx->start_pending)
+        status = start_element(module_ctx, element_idx);
+
+exit:
+    ctx.bind_id = bind_id;
+    ctx.activating_element = activating_element;
+    #ifdef BUILD_HAS_MM_ACCOUNTING
+    account_mm_to(mm_usage);
+    #endif
+
+    return status;
 }
 
 /*
@@ -417,21 +968,46 @@ int __fwk_module_init(void)
     if (status != FWK_SUCCESS)
         return status;
 
+    /* The start dependencies cannot be met, they are circular */
+    if (!can_start_remaining_modules()) {
+        FWK_HOST_PRINT(err_msg_line, FWK_E_PARAM, __func__, __LINE__);
+        return FWK_E_PARAM;
+    }
+
+    #ifdef BUILD_HAS_NOTIFICATION
+    status = __fwk_notification_freeze();
+    if (status != FWK_SUCCESS)
+        return status;
+    #endif
+
     ctx.initialized = true;
 
+    #if defined(BUILD_HAS_MM_ACCOUNTING) && defined(BUILD_HOST)
+    print_mm_usage();
+    #endif
+
+    #if defined(BUILD_HAS_BOOT_PROFILING) && defined(BUILD_HOST)
+    print_boot_report();
+    #endif
+
     __fwk_thread_run();
 
     return FWK_SUCCESS;
 }
 
+/*
+ * The identifiers are valid by contract, their fields are thus read directly
+ * rather than through the checking accessors of the identifier component.
+ */
 struct fwk_module_ctx *__fwk_module_get_ctx(fwk_id_t id)
 {
-    return &ctx.module_ctx_table[fwk_id_get_module_idx(id)];
+    return &ctx.module_ctx_table[id.common.module_idx];
 }
 
 struct fwk_element_ctx *__fwk_module_get_element_ctx(fwk_id_t element_id)
 {
-    struct fwk_module_ctx *module_ctx = __fwk_module_get_ctx(element_id);
+    struct fwk_module_ctx *module_ctx =
+        &ctx.module_ctx_table[element_id.common.module_idx];
 
     return &module_ctx->element_ctx_table[element_id.element.element_idx];
 }
@@ -454,9 +1030,34 @@ int __fwk_module_get_state(fwk_id_t id, enum fwk_module_state *state)
     return FWK_SUCCESS;
 }
 
+int __fwk_module_activate(fwk_id_t id)
+{
+    struct fwk_module_ctx *module_ctx;
+    unsigned int element_idx;
+
+    if ((id.common.type != FWK_ID_TYPE_ELEMENT) &&
+        (id.common.type != FWK_ID_TYPE_SUB_ELEMENT))
+        return FWK_SUCCESS;
+
+    module_ctx = &ctx.module_ctx_table[id.common.module_idx];
+    if (!module_ctx->config->lazy_element_init)
+        return FWK_SUCCESS;
+
+    element_idx = id.element.element_idx;
+    if (module_ctx->element_ctx_table[element_idx].state !=
+        FWK_MODULE_STATE_UNINITIALIZED)
+        return FWK_SUCCESS;
+
+    if (module_ctx->state == FWK_MODULE_STATE_UNINITIALIZED)
+        return FWK_E_INIT;
+
+    return activate_element(module_ctx, element_idx);
+}
+
 void __fwk_module_reset(void)
 {
     ctx = (struct context){ 0 };
+    __fwk_module_callable_map = (struct __fwk_module_callable_map){ 0 };
 }
 
 /*
@@ -615,7 +1216,7 @@ const void *fwk_module_get_data(fwk_id_t id)
     return NULL;
 }
 
-int fwk_module_check_call(fwk_id_t id)
+int __fwk_module_check_call(fwk_id_t id)
 {
     int status;
     enum fwk_module_state state;
@@ -641,6 +1242,104 @@ error:
     return status;
 }
 
+int fwk_module_start_complete(fwk_id_t module_id)
+{
+    int status;
+    struct fwk_module_ctx *module_ctx;
+
+    if (!fwk_module_is_valid_module_id(module_id)) {
+        status = FWK_E_PARAM;
+        goto error;
+    }
+
+    module_ctx = __fwk_module_get_ctx(module_id);
+    if (!module_ctx->start_pending) {
+        status = FWK_E_STATE;
+        goto error;
+    }
+
+    module_ctx->start_pending = false;
+    set_module_state(module_ctx, FWK_MODULE_STATE_STARTED);
+
+    /*
+     * When called from a start function, the modules waiting for the module
+     * are started by the ongoing start pass.
+     */
+    if (ctx.starting_modules)
+        return FWK_SUCCESS;
+
+    status = start_modules();
+    if (status != FWK_SUCCESS)
+        goto error;
+
+    /* The start dependencies of the remaining modules can still be met */
+    if (!can_start_remaining_modules()) {
+        status = FWK_E_PARAM;
+        goto error;
+    }
+
+    return FWK_SUCCESS;
+
+error:
+    FWK_HOST_PRINT(err_msg_func, status, __func__);
+    return status;
+}
+
+int fwk_module_activate_element(fwk_id_t element_id)
+{
+    int status;
+
+    if (!fwk_module_is_valid_element_id(element_id) &&
+        !fwk_module_is_valid_sub_element_id(element_id)) {
+        status = FWK_E_PARAM;
+        goto error;
+    }
+
+    status = __fwk_module_activate(element_id);
+    if (status != FWK_SUCCESS)
+        goto error;
+
+    return FWK_SUCCESS;
+
+error:
+    FWK_HOST_PRINT(err_msg_func, status, __func__);
+    return status;
+}
+
+int fwk_module_get_mm_usage(fwk_id_t id, struct fwk_mm_usage *usage)
+{
+    #ifdef BUILD_HAS_MM_ACCOUNTING
+    struct fwk_module_ctx *module_ctx;
+    unsigned int element_idx;
+
+    if (usage == NULL)
+        return FWK_E_PARAM;
+
+    if (fwk_module_is_valid_element_id(id)) {
+        *usage = __fwk_module_get_element_ctx(id)->mm_usage;
+        return FWK_SUCCESS;
+    }
+
+    if (!fwk_module_is_valid_module_id(id))
+        return FWK_E_PARAM;
+
+    module_ctx = __fwk_module_get_ctx(id);
+    *usage = module_ctx->mm_usage;
+    for (element_idx = 0; element_idx < module_ctx->element_count;
+         element_idx++) {
+        add_mm_usage(usage,
+                     &module_ctx->element_ctx_table[element_idx].mm_usage);
+    }
+
+    return FWK_SUCCESS;
+    #else
+    (void)id;
+    (void)usage;
+
+    return FWK_E_SUPPORT;
+    #endif
+}
+
 int fwk_module_bind(fwk_id_t target_id, fwk_id_t api_id, const void *api)
 {
     int status = FWK_E_PARAM;
@@ -663,12 +1362,16 @@ int fwk_module_bind(fwk_id_t target_id, fwk_id_t api_id, const void *api)
 
     if (((ctx.stage != MODULE_STAGE_INITIALIZE) ||
          (module_ctx->state != FWK_MODULE_STATE_INITIALIZED)) &&
-        (ctx.stage != MODULE_STAGE_BIND)) {
+        (ctx.stage != MODULE_STAGE_BIND) && !ctx.activating_element) {
 
         status = FWK_E_STATE;
         goto error;
     }
 
+    status = __fwk_module_activate(target_id);
+    if (status != FWK_SUCCESS)
+        goto error;
+
     status = module_ctx->desc->process_bind_request(ctx.bind_id, target_id,
                                                     api_id, (const void **)api);
     if (!fwk_expect(status == FWK_SUCCESS)) {
@@ -13,10 +13,14 @@
 #include <fwk_host.h>
 #include <fwk_interrupt.h>
 #include <fwk_element.h>
+#include <fwk_macros.h>
 #include <fwk_mm.h>
 #include <internal/fwk_module.h>
 #include <internal/fwk_notification.h>
 #include <internal/fwk_multi_thread.h>
+#ifdef BUILD_HAS_EVENT_PROFILING
+#include <internal/fwk_profiling.h>
+#endif
 #include <rtx_os.h>
 
 #define SIGNAL_ISR_EVENT 0x01
@@ -24,6 +28,11 @@
 #define SIGNAL_EVENT_PROCESSED 0x04
 #define SIGNAL_NO_READY_THREAD 0x08
 
+/* Number of out-of-line event parameter blocks, none unless configured */
+#ifndef BUILD_EVENT_EXT_PARAMS_COUNT
+#define BUILD_EVENT_EXT_PARAMS_COUNT 0
+#endif
+
 static struct __fwk_multi_thread_ctx ctx;
 #ifdef BUILD_HOST
 static const char err_msg_line[] = "[THR] Error %d @%d\n";
@@ -61,6 +70,28 @@ static int init_thread_attr(osThreadAttr_t *attr)
     return FWK_SUCCESS;
 }
 
+/*
+ * Release the out-of-line parameter block of an event, if any.
+ *
+ * \note The interrupts must be globally disabled, the pool of blocks being
+ *      shared with the ISRs and the threads.
+ *
+ * \param event Pointer to the event.
+ */
+static void free_ext_params(struct fwk_event *event)
+{
+    int status;
+
+    if (event->ext_params == NULL)
+        return;
+
+    status = fwk_mm_pool_free(ctx.ext_params_pool, event->ext_params);
+    if (status != FWK_SUCCESS)
+        FWK_HOST_PRINT(err_msg_func, status, __func__);
+
+    event->ext_params = NULL;
+}
+
 /*
  * Put back an event into the queue of free events.
  *
@@ -71,10 +102,47 @@ static int init_thread_attr(osThreadAttr_t *attr)
 static void free_event(struct fwk_event *event)
 {
     fwk_interrupt_global_disable();
+    free_ext_params(event);
     fwk_list_push_tail(&ctx.event_free_queue, &event->slist_node);
+    ctx.stats.used_event_count--;
     fwk_interrupt_global_enable();
 }
 
+/*
+ * Account an event put in an event queue to the statistics of the queue.
+ *
+ * \param queue_stats Pointer to the statistics of the queue.
+ */
+static void account_queued_event(struct fwk_thread_queue_stats *queue_stats)
+{
+    if (++queue_stats->depth > queue_stats->depth_max)
+        queue_stats->depth_max = queue_stats->depth;
+}
+
+/*
+ * Account an event put in the event queue of a thread to the statistics of the
+ * queue and of all the thread queues.
+ *
+ * \param thread_ctx Pointer to the context of the thread.
+ */
+static void account_thread_queued_event(struct __fwk_thread_ctx *thread_ctx)
+{
+    account_queued_event(&thread_ctx->event_queue_stats);
+    account_queued_event(&ctx.stats.event_queue);
+}
+
+/*
+ * Account an event removed from the event queue of a thread to the statistics
+ * of the queue and of all the thread queues.
+ *
+ * \param thread_ctx Pointer to the context of the thread.
+ */
+static void account_thread_dequeued_event(struct __fwk_thread_ctx *thread_ctx)
+{
+    thread_ctx->event_queue_stats.depth--;
+    ctx.stats.event_queue.depth--;
+}
+
 /*
  * Duplicate an event.
  *
@@ -94,6 +162,10 @@ static struct fwk_event *duplicate_event(struct fwk_event *event)
     fwk_interrupt_global_disable();
     allocated_event = FWK_LIST_GET(fwk_list_pop_head(&ctx.event_free_queue),
                                    struct fwk_event, slist_node);
+    if (allocated_event == NULL)
+        ctx.stats.failed_alloc_count++;
+    else if (++ctx.stats.used_event_count > ctx.stats.used_event_count_max)
+        ctx.stats.used_event_count_max = ctx.stats.used_event_count;
     fwk_interrupt_global_enable();
 
     if (allocated_event != NULL) {
@@ -138,6 +210,65 @@ static struct __fwk_thread_ctx *thread_get_ctx(fwk_id_t id)
     return NULL;
 }
 
+/*
+ * Check the validity of an event put by a thread or an ISR.
+ *
+ * \details When called from a thread processing an event, the source of the
+ *      event is set to the target of the event being processed.
+ *
+ * \param event Pointer to the event.
+ *
+ * \retval FWK_SUCCESS The event is valid.
+ * \retval FWK_E_PARAM The event is not valid.
+ */
+static int check_event(struct fwk_event *event)
+{
+    unsigned int interrupt;
+
+    if (event == NULL)
+        goto error;
+
+    if (thread_get_ctx(event->target_id) == NULL)
+        goto error;
+
+    if ((fwk_interrupt_get_current(&interrupt) != FWK_SUCCESS) &&
+        (ctx.current_event != NULL))
+        event->source_id = ctx.current_event->target_id;
+    else {
+        if (!fwk_module_is_valid_entity_id(event->source_id))
+            goto error;
+    }
+
+    if (event->is_notification) {
+        if (!fwk_module_is_valid_notification_id(event->id))
+            goto error;
+        if ((!event->is_response) || (event->response_requested))
+            goto error;
+        if (fwk_id_get_module_idx(event->target_id) !=
+            fwk_id_get_module_idx(event->id))
+             goto error;
+    } else {
+        if (!fwk_module_is_valid_event_id(event->id))
+            goto error;
+        if (event->is_response) {
+            if (fwk_id_get_module_idx(event->source_id) !=
+                fwk_id_get_module_idx(event->id))
+                goto error;
+            if (event->response_requested)
+                goto error;
+        } else {
+            if (fwk_id_get_module_idx(event->target_id) !=
+                fwk_id_get_module_idx(event->id))
+                goto error;
+        }
+    }
+
+    return FWK_SUCCESS;
+
+error:
+    return FWK_E_PARAM;
+}
+
 /*
  * Get the list of delayed responses for a given module or element.
  *
@@ -189,6 +320,62 @@ static struct fwk_event *search_delayed_response(fwk_id_t id, uint32_t cookie)
     return NULL;
 }
 
+/*
+ * Search the event queue of a thread for an event awaiting processing that a
+ * new event can be coalesced with.
+ *
+ * \param thread_ctx Pointer to the context of the thread.
+ * \param event Pointer to the new event.
+ *
+ * \return A pointer to the pending event, NULL if there is none.
+ */
+static struct fwk_event *search_pending_event(
+    struct __fwk_thread_ctx *thread_ctx, const struct fwk_event *event)
+{
+    struct fwk_slist_node *node;
+    struct fwk_event *pending_event;
+
+    if (!event->coalesce)
+        return NULL;
+
+    node = fwk_list_head(&thread_ctx->event_queue);
+
+    while (node != NULL) {
+        pending_event = FWK_LIST_GET(node, struct fwk_event, slist_node);
+        if (!pending_event->is_thread_wakeup_event &&
+            __FWK_THREAD_CAN_COALESCE(pending_event, event))
+            return pending_event;
+
+        node = fwk_list_next(&thread_ctx->event_queue, node);
+    }
+
+    return NULL;
+}
+
+/*
+ * Coalesce a new event with an event awaiting processing.
+ *
+ * \details The source and the parameters of the pending event are replaced by
+ *      the ones of the new event. The ownership of the out-of-line parameters
+ *      of the new event, if any, is transferred to the pending event.
+ *
+ * \param pending_event Pointer to the event awaiting processing.
+ * \param event Pointer to the new event.
+ */
+static void coalesce_event(struct fwk_event *pending_event,
+                           const struct fwk_event *event)
+{
+    fwk_interrupt_global_disable();
+    free_ext_params(pending_event);
+    fwk_interrupt_global_enable();
+
+    pending_event->source_id = event->source_id;
+    memcpy(pending_event->params, event->params, sizeof(event->params));
+    pending_event->ext_params = event->ext_params;
+
+    ctx.stats.coalesced_event_count++;
+}
+
 /*
  * Put an event in the ISR event queue.
  *
@@ -206,8 +393,14 @@ static int put_isr_event(struct fwk_event *event)
     uint32_t flags;
 
     allocated_event = duplicate_event(event);
-    if (allocated_event == NULL)
+    if (allocated_event == NULL) {
+        ctx.stats.isr_event_queue.failed_put_count++;
         return FWK_E_NOMEM;
+    }
+
+    #ifdef BUILD_HAS_EVENT_PROFILING
+    __fwk_profiling_stamp(allocated_event);
+    #endif
 
     FWK_HOST_PRINT("[THR] Add ISR event (%s,%s,%s)\n",
                    FWK_ID_STR(event->source_id),
@@ -221,6 +414,7 @@ static int put_isr_event(struct fwk_event *event)
      * an interrupt context.
      */
     fwk_list_push_tail(&ctx.event_isr_queue, &allocated_event->slist_node);
+    account_queued_event(&ctx.stats.isr_event_queue);
     if (ctx.waiting_for_isr_event) {
         flags = osThreadFlagsSet(ctx.common_thread_ctx.os_thread_id,
                                  SIGNAL_ISR_EVENT);
@@ -297,13 +491,28 @@ static int put_event(struct __fwk_thread_ctx *target_thread_ctx,
 
         memcpy(allocated_event->params, event->params,
                sizeof(allocated_event->params));
+        allocated_event->ext_params = event->ext_params;
         allocated_event->is_thread_wakeup_event = event->is_thread_wakeup_event;
     } else {
+        allocated_event = search_pending_event(target_thread_ctx, event);
+        if (allocated_event != NULL) {
+            coalesce_event(allocated_event, event);
+            event->cookie = allocated_event->cookie;
+            return FWK_SUCCESS;
+        }
+
         allocated_event = duplicate_event(event);
-        if (allocated_event == NULL)
+        if (allocated_event == NULL) {
+            target_thread_ctx->event_queue_stats.failed_put_count++;
+            ctx.stats.event_queue.failed_put_count++;
             return FWK_E_NOMEM;
+        }
     }
 
+    #ifdef BUILD_HAS_EVENT_PROFILING
+    __fwk_profiling_stamp(allocated_event);
+    #endif
+
     allocated_event->cookie = event->cookie = ctx.event_cookie_counter++;
 
     if (allocated_event->is_thread_wakeup_event) {
@@ -323,6 +532,8 @@ static int put_event(struct __fwk_thread_ctx *target_thread_ctx,
                                &target_thread_ctx->slist_node);
     }
 
+    account_thread_queued_event(target_thread_ctx);
+
     return FWK_SUCCESS;
 
 error:
@@ -356,6 +567,8 @@ static void process_event_requiring_response(struct fwk_event *event)
     resp_event.source_id = event->target_id;
     resp_event.target_id = event->source_id;
     resp_event.is_delayed_response = false;
+    /* The block of the event is released along with the event */
+    resp_event.ext_params = NULL;
 
     status = process_event(event, &resp_event);
     if (status != FWK_SUCCESS)
@@ -363,9 +576,17 @@ static void process_event_requiring_response(struct fwk_event *event)
 
     resp_event.is_response = true;
     resp_event.response_requested = false;
-    if (!resp_event.is_delayed_response)
-        put_event(source_thread_ctx, &resp_event);
-    else {
+    if (!resp_event.is_delayed_response) {
+        if (put_event(source_thread_ctx, &resp_event) != FWK_SUCCESS) {
+            fwk_interrupt_global_disable();
+            free_ext_params(&resp_event);
+            fwk_interrupt_global_enable();
+        }
+    } else {
+        /* The block is provided along with the delayed response */
+        fwk_interrupt_global_disable();
+        free_ext_params(&resp_event);
+        fwk_interrupt_global_enable();
         allocated_event = duplicate_event(&resp_event);
         if (allocated_event != NULL) {
             fwk_list_push_tail(get_delayed_response_list(resp_event.source_id),
@@ -387,6 +608,9 @@ static void process_next_thread_event(struct __fwk_thread_ctx *thread_ctx)
     int status;
     struct fwk_event *event, async_resp_event;
     const struct fwk_module *module;
+    #ifdef BUILD_HAS_EVENT_PROFILING
+    uint32_t dispatch_timestamp;
+    #endif
 
     /*
      * Extract the event from the thread event queue and update the pointer to
@@ -398,12 +622,22 @@ static void process_next_thread_event(struct __fwk_thread_ctx *thread_ctx)
         FWK_LIST_GET(fwk_list_pop_head(&thread_ctx->event_queue),
                      struct fwk_event, slist_node);
     assert(event != NULL);
+    account_thread_dequeued_event(thread_ctx);
 
     FWK_HOST_PRINT("[THR] Process thread event (%s,%s,%s)\n",
                    FWK_ID_STR(event->source_id),
                    FWK_ID_STR(event->target_id), FWK_ID_STR(event->id));
 
-    if (event->response_requested)
+    /* The target may be an element initialized lazily and not active yet */
+    status = __fwk_module_activate(event->target_id);
+
+    #ifdef BUILD_HAS_EVENT_PROFILING
+    dispatch_timestamp = __fwk_profiling_get_timestamp();
+    #endif
+
+    if (status != FWK_SUCCESS)
+        FWK_HOST_PRINT(err_msg_line, status, __LINE__);
+    else if (event->response_requested)
         process_event_requiring_response(event);
     else {
         module = __fwk_module_get_ctx(event->target_id)->desc;
@@ -419,6 +653,10 @@ static void process_next_thread_event(struct __fwk_thread_ctx *thread_ctx)
     ctx.current_event = NULL;
     ctx.current_thread_ctx = NULL;
 
+    #ifdef BUILD_HAS_EVENT_PROFILING
+    __fwk_profiling_record(event, dispatch_timestamp);
+    #endif
+
     free_event(event);
 
     if (!fwk_list_is_empty(&thread_ctx->event_queue))
@@ -457,13 +695,19 @@ static struct __fwk_thread_ctx *launch_next_event_processing(
                              struct fwk_event, slist_node);
 
         if (event->is_thread_wakeup_event) {
+            /*
+             * The waiting thread gets a copy of the response, the block of
+             * the response being released along with it.
+             */
             *next_thread_ctx->response_event = *event;
+            next_thread_ctx->response_event->ext_params = NULL;
             flags = osThreadFlagsSet(next_thread_ctx->os_thread_id,
                                      SIGNAL_EVENT_PROCESSED);
             if ((int32_t)flags >= 0) {
                 event = FWK_LIST_GET(fwk_list_pop_head(
                     &next_thread_ctx->event_queue), struct fwk_event,
                     slist_node);
+                account_thread_dequeued_event(next_thread_ctx);
                 free_event(event);
                 return next_thread_ctx;
             }
@@ -477,6 +721,7 @@ static struct __fwk_thread_ctx *launch_next_event_processing(
         FWK_HOST_PRINT(err_msg_line, FWK_E_OS, __LINE__);
         event = FWK_LIST_GET(fwk_list_pop_head(&next_thread_ctx->event_queue),
                              struct fwk_event, slist_node);
+        account_thread_dequeued_event(next_thread_ctx);
         free_event(event);
 
         if (!fwk_list_is_empty(&next_thread_ctx->event_queue)) {
@@ -555,121 +800,425 @@ static void specific_thread_function(void *arg)
     thread_function((struct __fwk_thread_ctx *)arg, NULL);
 }
 
-static void get_next_isr_event(void)
+/*
+ * Move an ISR event or a delayed event that is due to the queue of its target
+ * thread.
+ *
+ * \details The events are moved once no thread is ready. A thread with events
+ *      awaiting processing thus waits for the completion of the processing of
+ *      an event.
+ *
+ * \param event Pointer to the event.
+ *
+ * \retval true The target thread of the event is now ready.
+ * \retval false The target thread of the event is not ready.
+ */
+static bool dispatch_event(struct fwk_event *event)
 {
-    uint32_t flags;
-    struct fwk_event *isr_event;
+    struct fwk_event *pending_event;
     struct __fwk_thread_ctx *target_thread_ctx;
+    bool is_empty, waiting;
 
-    for (;;) {
-        fwk_interrupt_global_disable();
-        if (fwk_list_is_empty(&ctx.event_isr_queue)) {
-            /* Wait for an ISR event. */
-            ctx.waiting_for_isr_event = true;
-            fwk_interrupt_global_enable();
-            flags = osThreadFlagsWait(
-                SIGNAL_ISR_EVENT, osFlagsWaitAll, osWaitForever);
-            if (flags != SIGNAL_ISR_EVENT)
-                FWK_HOST_PRINT(err_msg_line, FWK_E_OS, __LINE__);
-            continue;
-        }
+    target_thread_ctx = thread_get_ctx(event->target_id);
+    waiting = target_thread_ctx->waiting_event_processing_completion;
 
-        isr_event = FWK_LIST_GET(fwk_list_pop_head(&ctx.event_isr_queue),
-                                 struct fwk_event, slist_node);
-        fwk_interrupt_global_enable();
+    event->is_thread_wakeup_event = is_thread_wakeup_event(
+        target_thread_ctx, event);
 
-        assert(isr_event != NULL);
-        FWK_HOST_PRINT("[THR] Get ISR event (%s,%s,%s)\n",
-                       FWK_ID_STR(isr_event->source_id),
-                       FWK_ID_STR(isr_event->target_id),
-                       FWK_ID_STR(isr_event->id));
+    /* The pending event keeps its position in the queue of the thread */
+    pending_event = search_pending_event(target_thread_ctx, event);
+    if (pending_event != NULL) {
+        coalesce_event(pending_event, event);
+        event->ext_params = NULL;
+        free_event(event);
+        return false;
+    }
 
-        target_thread_ctx = thread_get_ctx(isr_event->target_id);
+    event->cookie = ctx.event_cookie_counter++;
 
-        isr_event->is_thread_wakeup_event = is_thread_wakeup_event(
-            target_thread_ctx, isr_event);
-        isr_event->cookie = ctx.event_cookie_counter++;
+    is_empty = fwk_list_is_empty(&target_thread_ctx->event_queue);
+    if (event->is_thread_wakeup_event) {
+        fwk_list_push_head(&target_thread_ctx->event_queue,
+                           &event->slist_node);
+    } else {
+        fwk_list_push_tail(&target_thread_ctx->event_queue,
+                           &event->slist_node);
+    }
+    account_thread_queued_event(target_thread_ctx);
 
-        if (isr_event->is_thread_wakeup_event) {
-            fwk_list_push_head(&target_thread_ctx->event_queue,
-                               &isr_event->slist_node);
-        } else {
-            fwk_list_push_tail(&target_thread_ctx->event_queue,
-                               &isr_event->slist_node);
-        }
+    /* A thread that is not waiting with pending events is already ready */
+    if (event->is_thread_wakeup_event || (is_empty && !waiting)) {
+        fwk_list_push_head(&ctx.thread_ready_queue,
+                           &target_thread_ctx->slist_node);
+        return true;
+    }
 
-        if (!(target_thread_ctx->waiting_event_processing_completion) ||
-            isr_event->is_thread_wakeup_event) {
-            fwk_list_push_head(&ctx.thread_ready_queue,
-                               &target_thread_ctx->slist_node);
+    return false;
+}
+
+/*
+ * Move a delayed event towards the root of the heap of delayed events until
+ * the heap is ordered.
+ *
+ * \param idx Index of the delayed event in the heap.
+ */
+static void sift_delayed_event_up(unsigned int idx)
+{
+    struct __fwk_thread_delayed_event *heap = ctx.delayed_event_heap;
+    struct __fwk_thread_delayed_event delayed_event = heap[idx];
+    unsigned int parent_idx;
+
+    while (idx > 0) {
+        parent_idx = (idx - 1) / 2;
+        if (heap[parent_idx].timestamp <= delayed_event.timestamp)
             break;
-        }
+
+        heap[idx] = heap[parent_idx];
+        idx = parent_idx;
     }
+
+    heap[idx] = delayed_event;
 }
 
-static void common_thread_function(void *arg)
+/*
+ * Move a delayed event towards the leaves of the heap of delayed events until
+ * the heap is ordered.
+ *
+ * \param idx Index of the delayed event in the heap.
+ */
+static void sift_delayed_event_down(unsigned int idx)
 {
-    struct __fwk_thread_ctx *next_thread_ctx;
-
-    ctx.running = true;
+    struct __fwk_thread_delayed_event *heap = ctx.delayed_event_heap;
+    struct __fwk_thread_delayed_event delayed_event = heap[idx];
+    unsigned int child_idx;
 
     for (;;) {
-        next_thread_ctx = launch_next_event_processing(&ctx.common_thread_ctx);
+        child_idx = (2 * idx) + 1;
+        if (child_idx >= ctx.delayed_event_count)
+            break;
 
-        if (next_thread_ctx != NULL)
-            thread_function(&ctx.common_thread_ctx, next_thread_ctx);
+        if (((child_idx + 1) < ctx.delayed_event_count) &&
+            (heap[child_idx + 1].timestamp < heap[child_idx].timestamp))
+            child_idx++;
 
-        get_next_isr_event();
+        if (delayed_event.timestamp <= heap[child_idx].timestamp)
+            break;
+
+        heap[idx] = heap[child_idx];
+        idx = child_idx;
     }
+
+    heap[idx] = delayed_event;
 }
 
 /*
- * Private interface functions
+ * Remove a delayed event from the heap of delayed events.
+ *
+ * \param idx Index of the delayed event in the heap.
  */
+static void remove_delayed_event(unsigned int idx)
+{
+    struct __fwk_thread_delayed_event *heap = ctx.delayed_event_heap;
 
-int __fwk_thread_init(size_t event_count)
+    if (idx == --ctx.delayed_event_count)
+        return;
+
+    heap[idx] = heap[ctx.delayed_event_count];
+    sift_delayed_event_down(idx);
+    sift_delayed_event_up(idx);
+}
+
+/*
+ * Hold an event until a delay has elapsed.
+ *
+ * \param event Pointer to the event to hold.
+ * \param microseconds Delay in microseconds.
+ * \param periodic Flag indicating whether the event is put every delay until
+ *      it is cancelled.
+ *
+ * \retval FWK_SUCCESS The event is held until the delay has elapsed.
+ * \retval FWK_E_NOMEM All the event structures are in use.
+ * \return One of the error codes of the timer driver.
+ */
+static int hold_event(struct fwk_event *event, uint32_t microseconds,
+                      bool periodic)
 {
     int status;
-    struct fwk_event *event_table, *event_table_end, *event;
-    osThreadAttr_t thread_attr;
+    uint64_t counter, ticks;
+    struct fwk_event *allocated_event;
+    struct __fwk_thread_delayed_event *delayed_event;
 
-    fwk_interrupt_global_enable();
-    status = osKernelInitialize();
-    if (status != osOK) {
-        status = FWK_E_OS;
-        goto error;
-    }
+    status = ctx.timer_driver->get_counter(&counter);
+    if (status != FWK_SUCCESS)
+        return status;
 
-    event_table = fwk_mm_calloc(event_count, sizeof(struct fwk_event));
-    if (event_table == NULL) {
-        status = FWK_E_NOMEM;
-        goto error;
-    }
+    allocated_event = duplicate_event(event);
+    if (allocated_event == NULL)
+        return FWK_E_NOMEM;
 
-    /* All the event structures are free to be used. */
-    fwk_list_init(&ctx.event_free_queue);
-    fwk_list_init(&(ctx.thread_ready_queue));
-    fwk_list_init(&(ctx.event_isr_queue));
-    fwk_list_init(&(ctx.common_thread_ctx.event_queue));
-    for (event = event_table, event_table_end = event_table + event_count;
-         event < event_table_end; event++)
-        fwk_list_push_tail(&ctx.event_free_queue,
-                           &event->slist_node);
+    ticks = ((uint64_t)ctx.timer_driver->frequency * microseconds) / 1000000;
 
-    status = init_thread_attr(&thread_attr);
-    if (status != FWK_SUCCESS)
-        goto error;
+    delayed_event = &ctx.delayed_event_heap[ctx.delayed_event_count];
+    delayed_event->timestamp = counter + ticks;
+    delayed_event->period = periodic ? FWK_MAX(ticks, (uint64_t)1) : 0;
+    delayed_event->event = allocated_event;
+    sift_delayed_event_up(ctx.delayed_event_count++);
 
-    ctx.common_thread_ctx.os_thread_id = osThreadNew(common_thread_function,
-        &ctx.common_thread_ctx, &thread_attr);
-    if (ctx.common_thread_ctx.os_thread_id == NULL) {
-        status = FWK_E_OS;
-        goto error;
+    /* The alarm only has to be moved if the event is the first one due */
+    if (ctx.delayed_event_heap[0].event != allocated_event)
+        return FWK_SUCCESS;
+
+    status = ctx.timer_driver->set_alarm(ctx.delayed_event_heap[0].timestamp);
+    if (status != FWK_SUCCESS) {
+        remove_delayed_event(0);
+        /* The out-of-line parameters are still owned by the caller */
+        allocated_event->ext_params = NULL;
+        free_event(allocated_event);
     }
 
-    ctx.initialized = true;
+    return status;
+}
 
-    return FWK_SUCCESS;
+/*
+ * Move the delayed events that are due to the queues of their target thread.
+ *
+ * \note The alarm may expire with no event due, for instance when the events
+ *      it was set for have been cancelled.
+ *
+ * \retval true At least one thread is now ready.
+ * \retval false No thread is ready.
+ */
+static bool process_timer(void)
+{
+    int status;
+    bool ready = false;
+    uint64_t counter;
+    struct __fwk_thread_delayed_event *delayed_event;
+    struct fwk_event *event;
+
+    status = ctx.timer_driver->get_counter(&counter);
+    if (status != FWK_SUCCESS)
+        goto error;
+
+    while (ctx.delayed_event_count != 0) {
+        delayed_event = &ctx.delayed_event_heap[0];
+        if (delayed_event->timestamp > counter)
+            break;
+
+        if (delayed_event->period == 0) {
+            event = delayed_event->event;
+            remove_delayed_event(0);
+        } else {
+            event = duplicate_event(delayed_event->event);
+
+            /* Skip the occurrences the processing of events fell behind on */
+            delayed_event->timestamp += delayed_event->period *
+                (((counter - delayed_event->timestamp) /
+                  delayed_event->period) + 1);
+            sift_delayed_event_down(0);
+        }
+
+        if (event == NULL)
+            continue;
+
+        #ifdef BUILD_HAS_EVENT_PROFILING
+        __fwk_profiling_stamp(event);
+        #endif
+
+        if (dispatch_event(event))
+            ready = true;
+    }
+
+    if (ctx.delayed_event_count == 0)
+        return ready;
+
+    status = ctx.timer_driver->set_alarm(ctx.delayed_event_heap[0].timestamp);
+    if (status != FWK_SUCCESS)
+        goto error;
+
+    return ready;
+
+error:
+    FWK_HOST_PRINT(err_msg_func, status, __func__);
+    return ready;
+}
+
+static void get_next_isr_event(void)
+{
+    uint32_t flags;
+    struct fwk_event *isr_event;
+
+    for (;;) {
+        fwk_interrupt_global_disable();
+        if (ctx.timer_signaled) {
+            ctx.timer_signaled = false;
+            fwk_interrupt_global_enable();
+            if (process_timer())
+                break;
+            continue;
+        }
+
+        if (fwk_list_is_empty(&ctx.event_isr_queue)) {
+            /* Wait for an ISR event. */
+            ctx.waiting_for_isr_event = true;
+            fwk_interrupt_global_enable();
+            flags = osThreadFlagsWait(
+                SIGNAL_ISR_EVENT, osFlagsWaitAll, osWaitForever);
+            if (flags != SIGNAL_ISR_EVENT)
+                FWK_HOST_PRINT(err_msg_line, FWK_E_OS, __LINE__);
+            continue;
+        }
+
+        isr_event = FWK_LIST_GET(fwk_list_pop_head(&ctx.event_isr_queue),
+                                 struct fwk_event, slist_node);
+        ctx.stats.isr_event_queue.depth--;
+        fwk_interrupt_global_enable();
+
+        assert(isr_event != NULL);
+        FWK_HOST_PRINT("[THR] Get ISR event (%s,%s,%s)\n",
+                       FWK_ID_STR(isr_event->source_id),
+                       FWK_ID_STR(isr_event->target_id),
+                       FWK_ID_STR(isr_event->id));
+
+        if (dispatch_event(isr_event))
+            break;
+    }
+}
+
+static void common_thread_function(void *arg)
+{
+    struct __fwk_thread_ctx *next_thread_ctx;
+
+    ctx.running = true;
+
+    for (;;) {
+        next_thread_ctx = launch_next_event_processing(&ctx.common_thread_ctx);
+
+        if (next_thread_ctx != NULL)
+            thread_function(&ctx.common_thread_ctx, next_thread_ctx);
+
+        get_next_isr_event();
+    }
+}
+
+/*
+ * Put an event in the event queues after a delay, once or periodically.
+ *
+ * \param event Pointer to the event.
+ * \param microseconds Delay in microseconds.
+ * \param periodic Flag indicating whether the event is put every delay until
+ *      it is cancelled.
+ *
+ * \return See fwk_thread_put_event_delayed() and
+ *      fwk_thread_put_event_periodic().
+ */
+static int put_delayed_event(struct fwk_event *event, uint32_t microseconds,
+                             bool periodic)
+{
+    int status;
+    unsigned int interrupt;
+
+    if (!ctx.initialized) {
+        status = FWK_E_INIT;
+        goto error;
+    }
+
+    if (fwk_interrupt_get_current(&interrupt) == FWK_SUCCESS) {
+        status = FWK_E_ACCESS;
+        goto error;
+    }
+
+    status = check_event(event);
+    if (status != FWK_SUCCESS)
+        goto error;
+
+    if (event->is_response) {
+        status = FWK_E_PARAM;
+        goto error;
+    }
+
+    /* Each occurrence of a periodic event would share the parameter block */
+    if (periodic && ((event->ext_params != NULL) || (microseconds == 0))) {
+        status = FWK_E_PARAM;
+        goto error;
+    }
+
+    if (ctx.timer_driver == NULL) {
+        status = FWK_E_SUPPORT;
+        goto error;
+    }
+
+    status = hold_event(event, microseconds, periodic);
+    if (status != FWK_SUCCESS)
+        goto error;
+
+    return FWK_SUCCESS;
+
+error:
+    FWK_HOST_PRINT(err_msg_func, status, __func__);
+    return status;
+}
+
+/*
+ * Private interface functions
+ */
+
+int __fwk_thread_init(size_t event_count)
+{
+    int status;
+    struct fwk_event *event_table, *event_table_end, *event;
+    osThreadAttr_t thread_attr;
+
+    fwk_interrupt_global_enable();
+    status = osKernelInitialize();
+    if (status != osOK) {
+        status = FWK_E_OS;
+        goto error;
+    }
+
+    event_table = fwk_mm_calloc(event_count, sizeof(struct fwk_event));
+    if (event_table == NULL) {
+        status = FWK_E_NOMEM;
+        goto error;
+    }
+
+    #if BUILD_EVENT_EXT_PARAMS_COUNT > 0
+    ctx.ext_params_pool = fwk_mm_pool_create(FWK_EVENT_EXT_PARAMETERS_SIZE,
+                                             BUILD_EVENT_EXT_PARAMS_COUNT);
+    if (ctx.ext_params_pool == NULL) {
+        status = FWK_E_NOMEM;
+        goto error;
+    }
+    #else
+    ctx.ext_params_pool = NULL;
+    #endif
+
+    ctx.stats = (struct fwk_thread_stats) { .event_count = event_count };
+
+    /* All the event structures are free to be used. */
+    fwk_list_init(&ctx.event_free_queue);
+    fwk_list_init(&(ctx.thread_ready_queue));
+    fwk_list_init(&(ctx.event_isr_queue));
+    fwk_list_init(&(ctx.common_thread_ctx.event_queue));
+    for (event = event_table, event_table_end = event_table + event_count;
+         event < event_table_end; event++)
+        fwk_list_push_tail(&ctx.event_free_queue,
+                           &event->slist_node);
+
+    status = init_thread_attr(&thread_attr);
+    if (status != FWK_SUCCESS)
+        goto error;
+
+    ctx.common_thread_ctx.os_thread_id = osThreadNew(common_thread_function,
+        &ctx.common_thread_ctx, &thread_attr);
+    if (ctx.common_thread_ctx.os_thread_id == NULL) {
+        status = FWK_E_OS;
+        goto error;
+    }
+
+    ctx.initialized = true;
+
+    return FWK_SUCCESS;
 
 error:
     FWK_HOST_PRINT(err_msg_func, status, __func__);
@@ -775,8 +1324,7 @@ error:
 
 int fwk_thread_put_event(struct fwk_event *event)
 {
-    int status = FWK_E_PARAM;
-    struct __fwk_thread_ctx *thread_ctx;
+    int status;
     unsigned int interrupt;
 
     if (!ctx.initialized) {
@@ -784,49 +1332,14 @@ int fwk_thread_put_event(struct fwk_event *event)
         goto error;
     }
 
-    if (event == NULL)
-        goto error;
-
-    thread_ctx = thread_get_ctx(event->target_id);
-    if (thread_ctx == NULL)
+    status = check_event(event);
+    if (status != FWK_SUCCESS)
         goto error;
 
-    if ((fwk_interrupt_get_current(&interrupt) != FWK_SUCCESS) &&
-        (ctx.current_event != NULL))
-        event->source_id = ctx.current_event->target_id;
-    else {
-        if (!fwk_module_is_valid_entity_id(event->source_id))
-            goto error;
-    }
-
-    if (event->is_notification) {
-        if (!fwk_module_is_valid_notification_id(event->id))
-            goto error;
-        if ((!event->is_response) || (event->response_requested))
-            goto error;
-        if (fwk_id_get_module_idx(event->target_id) !=
-            fwk_id_get_module_idx(event->id))
-             goto error;
-    } else {
-        if (!fwk_module_is_valid_event_id(event->id))
-            goto error;
-        if (event->is_response) {
-            if (fwk_id_get_module_idx(event->source_id) !=
-                fwk_id_get_module_idx(event->id))
-                goto error;
-            if (event->response_requested)
-                goto error;
-        } else {
-            if (fwk_id_get_module_idx(event->target_id) !=
-                fwk_id_get_module_idx(event->id))
-                goto error;
-        }
-    }
-
     /* Call from a thread */
     if (fwk_interrupt_get_current(&interrupt) != FWK_SUCCESS) {
         event->is_delayed_response = event->is_response;
-        return put_event(thread_ctx, event);
+        return put_event(thread_get_ctx(event->target_id), event);
     }
 
     /* Call from an ISR */
@@ -918,6 +1431,56 @@ error:
     return status;
 }
 
+int fwk_thread_get_stats(struct fwk_thread_stats *stats)
+{
+    int status = FWK_E_PARAM;
+
+    if (!ctx.initialized) {
+        status = FWK_E_INIT;
+        goto error;
+    }
+
+    if (stats == NULL)
+        goto error;
+
+    fwk_interrupt_global_disable();
+    *stats = ctx.stats;
+    fwk_interrupt_global_enable();
+
+    return FWK_SUCCESS;
+
+error:
+    FWK_HOST_PRINT(err_msg_func, status, __func__);
+    return status;
+}
+
+int fwk_thread_get_queue_stats(fwk_id_t id,
+                               struct fwk_thread_queue_stats *stats)
+{
+    int status = FWK_E_PARAM;
+    struct __fwk_thread_ctx *thread_ctx;
+
+    if (!ctx.initialized) {
+        status = FWK_E_INIT;
+        goto error;
+    }
+
+    if (stats == NULL)
+        goto error;
+
+    thread_ctx = thread_get_ctx(id);
+    if (thread_ctx == NULL)
+        goto error;
+
+    *stats = thread_ctx->event_queue_stats;
+
+    return FWK_SUCCESS;
+
+error:
+    FWK_HOST_PRINT(err_msg_func, status, __func__);
+    return status;
+}
+
 int fwk_thread_get_delayed_response(fwk_id_t id, uint32_t cookie,
                                     struct fwk_event *event)
 {
@@ -953,3 +1516,193 @@ error:
     FWK_HOST_PRINT(err_msg_func, status, __func__);
     return status;
 }
+
+int fwk_thread_alloc_ext_params(struct fwk_event *event, size_t size)
+{
+    int status = FWK_E_PARAM;
+    void *ext_params;
+
+    if (!ctx.initialized) {
+        status = FWK_E_INIT;
+        goto error;
+    }
+
+    if ((event == NULL) || (size == 0) ||
+        (size > FWK_EVENT_EXT_PARAMETERS_SIZE))
+        goto error;
+
+    if (event->ext_params != NULL) {
+        status = FWK_E_STATE;
+        goto error;
+    }
+
+    if (ctx.ext_params_pool == NULL) {
+        status = FWK_E_SUPPORT;
+        goto error;
+    }
+
+    fwk_interrupt_global_disable();
+    ext_params = fwk_mm_pool_alloc(ctx.ext_params_pool);
+    fwk_interrupt_global_enable();
+    if (ext_params == NULL) {
+        status = FWK_E_NOMEM;
+        goto error;
+    }
+
+    event->ext_params = ext_params;
+
+    return FWK_SUCCESS;
+
+error:
+    FWK_HOST_PRINT(err_msg_func, status, __func__);
+    return status;
+}
+
+int fwk_thread_free_ext_params(struct fwk_event *event)
+{
+    int status = FWK_E_PARAM;
+
+    if (!ctx.initialized) {
+        status = FWK_E_INIT;
+        goto error;
+    }
+
+    if (event == NULL)
+        goto error;
+
+    if (event->ext_params == NULL)
+        return FWK_SUCCESS;
+
+    fwk_interrupt_global_disable();
+    status = fwk_mm_pool_free(ctx.ext_params_pool, event->ext_params);
+    fwk_interrupt_global_enable();
+    if (status != FWK_SUCCESS)
+        goto error;
+
+    event->ext_params = NULL;
+
+    return FWK_SUCCESS;
+
+error:
+    FWK_HOST_PRINT(err_msg_func, status, __func__);
+    return status;
+}
+
+int fwk_thread_put_event_delayed(struct fwk_event *event,
+                                 uint32_t microseconds)
+{
+    return put_delayed_event(event, microseconds, false);
+}
+
+int fwk_thread_put_event_periodic(struct fwk_event *event,
+                                  uint32_t microseconds)
+{
+    return put_delayed_event(event, microseconds, true);
+}
+
+int fwk_thread_cancel_delayed_event(fwk_id_t target_id, fwk_id_t event_id)
+{
+    int status = FWK_E_STATE;
+    unsigned int interrupt, idx;
+    struct fwk_event *event;
+
+    if (!ctx.initialized) {
+        status = FWK_E_INIT;
+        goto error;
+    }
+
+    if (fwk_interrupt_get_current(&interrupt) == FWK_SUCCESS) {
+        status = FWK_E_ACCESS;
+        goto error;
+    }
+
+    idx = 0;
+    while (idx < ctx.delayed_event_count) {
+        event = ctx.delayed_event_heap[idx].event;
+        if (!fwk_id_is_equal(event->target_id, target_id) ||
+            !fwk_id_is_equal(event->id, event_id)) {
+            idx++;
+            continue;
+        }
+
+        remove_delayed_event(idx);
+        free_event(event);
+        status = FWK_SUCCESS;
+
+        /* The removal reorders the heap, scan it again from its root */
+        idx = 0;
+    }
+
+    if (status != FWK_SUCCESS)
+        goto error;
+
+    return FWK_SUCCESS;
+
+error:
+    FWK_HOST_PRINT(err_msg_func, status, __func__);
+    return status;
+}
+
+int fwk_thread_set_timer_driver(const struct fwk_thread_timer_driver *driver)
+{
+    int status = FWK_E_PARAM;
+
+    if (!ctx.initialized) {
+        status = FWK_E_INIT;
+        goto error;
+    }
+
+    if ((driver == NULL) || (driver->frequency == 0) ||
+        (driver->get_counter == NULL) || (driver->set_alarm == NULL))
+        goto error;
+
+    if (ctx.timer_driver != NULL) {
+        status = FWK_E_STATE;
+        goto error;
+    }
+
+    ctx.delayed_event_heap = fwk_mm_calloc(ctx.stats.event_count,
+        sizeof(struct __fwk_thread_delayed_event));
+    if (ctx.delayed_event_heap == NULL) {
+        status = FWK_E_NOMEM;
+        goto error;
+    }
+
+    ctx.delayed_event_count = 0;
+    ctx.timer_driver = driver;
+
+    return FWK_SUCCESS;
+
+error:
+    FWK_HOST_PRINT(err_msg_func, status, __func__);
+    return status;
+}
+
+void fwk_thread_signal_timer(void)
+{
+    uint32_t flags;
+
+    fwk_interrupt_global_disable();
+
+    ctx.timer_signaled = true;
+
+    /* The due events are moved by the common thread */
+    if (ctx.waiting_for_isr_event) {
+        flags = osThreadFlagsSet(ctx.common_thread_ctx.os_thread_id,
+                                 SIGNAL_ISR_EVENT);
+        if ((int32_t)flags < 0)
+            FWK_HOST_PRINT(err_msg_func, FWK_E_OS, __func__);
+        else
+            ctx.waiting_for_isr_event = false;
+    }
+
+    fwk_interrupt_global_enable();
+}
+
+void fwk_thread_begin_exclusive(void)
+{
+}
+
+void fwk_thread_end_exclusive(void)
+{
+}
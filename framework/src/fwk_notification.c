@@ -8,6 +8,7 @@
  *     Notification facilities.
  */
 
+#include <string.h>
 #include <fwk_assert.h>
 #include <fwk_host.h>
 #include <fwk_interrupt.h>
@@ -16,6 +17,7 @@
 #include <internal/fwk_module.h>
 #include <internal/fwk_notification.h>
 #include <internal/fwk_thread.h>
+#include <internal/fwk_worker_pool.h>
 
 struct notification_ctx {
     /*
@@ -48,7 +50,9 @@ static const char err_msg_func[] = "[NOT] Error %d in %s\n";
  * \param notification_id Identifier of the notification.
  * \param source_id Identifier of the emitter of the notification.
  *
- * \return A pointer to the doubly-linked list of subscriptions.
+ * \return A pointer to the doubly-linked list of subscriptions, NULL if the
+ *      source is an element initialized lazily that has not been activated
+ *      yet.
  */
 static struct fwk_dlist *get_subscription_dlist(
     fwk_id_t notification_id, fwk_id_t source_id)
@@ -63,10 +67,146 @@ static struct fwk_dlist *get_subscription_dlist(
             __fwk_module_get_element_ctx(source_id)->subscription_dlist_table;
     }
 
+    if (subscription_dlist_table == NULL)
+        return NULL;
+
     return &subscription_dlist_table[
                fwk_id_get_notification_idx(notification_id)];
 }
 
+/*
+ * Get the table of frozen subscriptions for a given notification emitted by a
+ * given source.
+ *
+ * \note The function assumes the validity of all its input parameters.
+ *
+ * \param notification_id Identifier of the notification.
+ * \param source_id Identifier of the emitter of the notification.
+ *
+ * \return A pointer to the table of frozen subscriptions, NULL if the
+ *      subscriptions have not been frozen yet.
+ */
+static struct __fwk_notification_frozen_list *get_frozen_list(
+    fwk_id_t notification_id, fwk_id_t source_id)
+{
+    struct __fwk_notification_frozen_list *frozen_subscription_table;
+
+    if (fwk_id_is_type(source_id, FWK_ID_TYPE_MODULE)) {
+        frozen_subscription_table =
+            __fwk_module_get_ctx(source_id)->frozen_subscription_table;
+    } else {
+        frozen_subscription_table = __fwk_module_get_element_ctx(source_id)->
+            frozen_subscription_table;
+    }
+
+    if (frozen_subscription_table == NULL)
+        return NULL;
+
+    return &frozen_subscription_table[
+               fwk_id_get_notification_idx(notification_id)];
+}
+
+/*
+ * Search for a subscriber with a given source and target identifier in a table
+ * of frozen subscriptions.
+ *
+ * \note The function assumes the validity of all its input parameters.
+ *
+ * \param frozen_list Pointer to the table of frozen subscriptions to search.
+ * \param source_id Identifier of the emitter of the notification.
+ * \param target_id Identifier of the target of the notification.
+ *
+ * \return The index of the subscriber in the table if found, the number of
+ *      subscribers in the table otherwise.
+ */
+static unsigned int search_subscriber(
+    const struct __fwk_notification_frozen_list *frozen_list,
+    fwk_id_t source_id, fwk_id_t target_id)
+{
+    unsigned int subscriber_idx;
+    const struct __fwk_notification_subscriber *subscriber;
+
+    for (subscriber_idx = 0; subscriber_idx < frozen_list->subscriber_count;
+         subscriber_idx++) {
+        subscriber = &frozen_list->subscriber_table[subscriber_idx];
+
+        if (fwk_id_is_equal(subscriber->source_id, source_id) &&
+            fwk_id_is_equal(subscriber->target_id, target_id))
+            break;
+    }
+
+    return subscriber_idx;
+}
+
+/*
+ * Freeze the subscriptions to the notifications emitted by an entity.
+ *
+ * \param subscription_dlist_table Table of the subscription lists of the
+ *      entity, one per notification.
+ * \param notification_count Number of notifications.
+ * \param [out] frozen_subscription_table Table of frozen subscriptions of the
+ *      entity, one per notification.
+ *
+ * \retval FWK_SUCCESS The subscriptions were frozen.
+ * \retval FWK_E_NOMEM Insufficient memory available to allocate the tables of
+ *      subscriptions.
+ */
+static int freeze_subscriptions(struct fwk_dlist *subscription_dlist_table,
+    unsigned int notification_count,
+    struct __fwk_notification_frozen_list **frozen_subscription_table)
+{
+    unsigned int notification_idx, subscriber_count;
+    struct fwk_dlist *subscription_dlist;
+    struct fwk_dlist_node *node;
+    struct __fwk_notification_subscription *subscription;
+    struct __fwk_notification_frozen_list *frozen_list_table, *frozen_list;
+
+    frozen_list_table = fwk_mm_calloc(notification_count,
+        sizeof(struct __fwk_notification_frozen_list));
+    if (frozen_list_table == NULL)
+        return FWK_E_NOMEM;
+
+    for (notification_idx = 0; notification_idx < notification_count;
+         notification_idx++) {
+        subscription_dlist = &subscription_dlist_table[notification_idx];
+        frozen_list = &frozen_list_table[notification_idx];
+
+        subscriber_count = 0;
+        for (node = fwk_list_head(subscription_dlist); node != NULL;
+             node = fwk_list_next(subscription_dlist, node))
+            subscriber_count++;
+
+        if (subscriber_count == 0)
+            continue;
+
+        frozen_list->subscriber_table = fwk_mm_calloc(subscriber_count,
+            sizeof(struct __fwk_notification_subscriber));
+        if (frozen_list->subscriber_table == NULL)
+            return FWK_E_NOMEM;
+
+        /*
+         * Once moved to the table, the subscription structures are free to be
+         * used by the subscriptions made afterwards.
+         */
+        while ((node = fwk_list_pop_head(subscription_dlist)) != NULL) {
+            subscription = FWK_LIST_GET(node,
+                struct __fwk_notification_subscription, dlist_node);
+
+            frozen_list->subscriber_table[frozen_list->subscriber_count++] =
+                (struct __fwk_notification_subscriber) {
+                    .source_id = subscription->source_id,
+                    .target_id = subscription->target_id,
+                };
+
+            fwk_list_push_tail(&ctx.free_subscription_dlist, node);
+        }
+    }
+
+    *frozen_subscription_table = frozen_list_table;
+
+    return FWK_SUCCESS;
+}
+
 /*
  * Search for a subscription with a given source and target identifier in a list
  * of subscriptions.
@@ -114,16 +254,50 @@ static void send_notifications(struct fwk_event *notification_event,
                                unsigned int *count)
 {
     int status;
+    unsigned int subscriber_idx;
+    const struct __fwk_notification_frozen_list *frozen_list;
+    const struct __fwk_notification_subscriber *subscriber;
     struct fwk_dlist *subscription_dlist;
     struct fwk_dlist_node *node;
     struct __fwk_notification_subscription *subscription;
 
-    subscription_dlist = get_subscription_dlist(notification_event->id,
-                                                notification_event->source_id);
     notification_event->is_response = false;
     notification_event->is_notification = true;
 
-    for (node = fwk_list_head(subscription_dlist); node != NULL;
+    #ifndef BUILD_HAS_MULTITHREADING
+    /*
+     * Store the notification payload once for all the subscribers if
+     * possible, otherwise it is copied for each of them.
+     */
+    __fwk_thread_share_notification(notification_event);
+    #endif
+
+    frozen_list = get_frozen_list(notification_event->id,
+                                  notification_event->source_id);
+    if (frozen_list != NULL) {
+        for (subscriber_idx = 0;
+             subscriber_idx < frozen_list->subscriber_count;
+             subscriber_idx++) {
+            subscriber = &frozen_list->subscriber_table[subscriber_idx];
+
+            if (!fwk_id_is_equal(subscriber->source_id,
+                                 notification_event->source_id))
+                continue;
+
+            notification_event->target_id = subscriber->target_id;
+
+            status = __fwk_thread_put_notification(notification_event);
+            if (status == FWK_SUCCESS)
+                (*count)++;
+        }
+    }
+
+    /* Subscriptions made after the subscriptions were frozen */
+    subscription_dlist = get_subscription_dlist(notification_event->id,
+                                                notification_event->source_id);
+
+    for (node = (subscription_dlist == NULL) ? NULL :
+                fwk_list_head(subscription_dlist); node != NULL;
          node = fwk_list_next(subscription_dlist, node)) {
         subscription = FWK_LIST_GET(node,
             struct __fwk_notification_subscription, dlist_node);
@@ -138,6 +312,10 @@ static void send_notifications(struct fwk_event *notification_event,
         if (status == FWK_SUCCESS)
             (*count)++;
     }
+
+    #ifndef BUILD_HAS_MULTITHREADING
+    __fwk_thread_unshare_notification();
+    #endif
 }
 
 /*
@@ -170,6 +348,54 @@ int __fwk_notification_init(size_t notification_count)
     return FWK_SUCCESS;
 }
 
+int __fwk_notification_freeze(void)
+{
+    int status;
+    unsigned int module_idx, element_idx, notification_count;
+    struct fwk_module_ctx *module_ctx;
+    struct fwk_element_ctx *element_ctx;
+
+    if (!ctx.initialized) {
+        status = FWK_E_INIT;
+        goto error;
+    }
+
+    for (module_idx = 0;
+         fwk_module_is_valid_module_id(FWK_ID_MODULE(module_idx));
+         module_idx++) {
+        module_ctx = __fwk_module_get_ctx(FWK_ID_MODULE(module_idx));
+
+        notification_count = module_ctx->desc->notification_count;
+        if (notification_count == 0)
+            continue;
+
+        status = freeze_subscriptions(module_ctx->subscription_dlist_table,
+            notification_count, &module_ctx->frozen_subscription_table);
+        if (status != FWK_SUCCESS)
+            goto error;
+
+        for (element_idx = 0; element_idx < module_ctx->element_count;
+             element_idx++) {
+            element_ctx = &module_ctx->element_ctx_table[element_idx];
+
+            /* Element initialized lazily and not activated yet */
+            if (element_ctx->subscription_dlist_table == NULL)
+                continue;
+
+            status = freeze_subscriptions(element_ctx->subscription_dlist_table,
+                notification_count, &element_ctx->frozen_subscription_table);
+            if (status != FWK_SUCCESS)
+                goto error;
+        }
+    }
+
+    return FWK_SUCCESS;
+
+error:
+    FWK_HOST_PRINT(err_msg_func, status, __func__);
+    return status;
+}
+
 void __fwk_notification_reset(void)
 {
     ctx = (struct notification_ctx){ 0 };
@@ -184,9 +410,12 @@ int fwk_notification_subscribe(fwk_id_t notification_id, fwk_id_t source_id,
 {
     int status;
     unsigned int interrupt;
+    struct __fwk_notification_frozen_list *frozen_list;
     struct fwk_dlist *subscription_dlist;
     struct __fwk_notification_subscription *subscription;
 
+    __FWK_WORKER_POOL_LOCK();
+
     if (!ctx.initialized) {
         status = FWK_E_INIT;
         goto error;
@@ -206,6 +435,19 @@ int fwk_notification_subscribe(fwk_id_t notification_id, fwk_id_t source_id,
         goto error;
     }
 
+    /* The subscriptions are recorded in the context of the source */
+    status = __fwk_module_activate(source_id);
+    if (status != FWK_SUCCESS)
+        goto error;
+
+    frozen_list = get_frozen_list(notification_id, source_id);
+    if ((frozen_list != NULL) &&
+        (search_subscriber(frozen_list, source_id, target_id) <
+         frozen_list->subscriber_count)) {
+        status = FWK_E_STATE;
+        goto error;
+    }
+
     subscription_dlist = get_subscription_dlist(notification_id, source_id);
     if (search_subscription(subscription_dlist, source_id, target_id) != NULL) {
         status = FWK_E_STATE;
@@ -229,9 +471,12 @@ int fwk_notification_subscribe(fwk_id_t notification_id, fwk_id_t source_id,
     fwk_list_push_tail(subscription_dlist, &subscription->dlist_node);
     fwk_interrupt_global_enable();
 
+    __FWK_WORKER_POOL_UNLOCK();
+
     return FWK_SUCCESS;
 
 error:
+    __FWK_WORKER_POOL_UNLOCK();
     FWK_HOST_PRINT(err_msg_func, status, __func__);
     return status;
 }
@@ -240,10 +485,13 @@ int fwk_notification_unsubscribe(fwk_id_t notification_id, fwk_id_t source_id,
                                  fwk_id_t target_id)
 {
     int status;
-    unsigned int interrupt;
+    unsigned int interrupt, subscriber_idx;
+    struct __fwk_notification_frozen_list *frozen_list;
     struct fwk_dlist *subscription_dlist;
     struct __fwk_notification_subscription *subscription;
 
+    __FWK_WORKER_POOL_LOCK();
+
     if (!ctx.initialized) {
         status = FWK_E_INIT;
         goto error;
@@ -263,7 +511,31 @@ int fwk_notification_unsubscribe(fwk_id_t notification_id, fwk_id_t source_id,
         goto error;
     }
 
+    frozen_list = get_frozen_list(notification_id, source_id);
+    if (frozen_list != NULL) {
+        subscriber_idx = search_subscriber(frozen_list, source_id, target_id);
+        if (subscriber_idx < frozen_list->subscriber_count) {
+            /* Keep the remaining subscribers in subscription order */
+            fwk_interrupt_global_disable();
+            frozen_list->subscriber_count--;
+            memmove(&frozen_list->subscriber_table[subscriber_idx],
+                    &frozen_list->subscriber_table[subscriber_idx + 1],
+                    (frozen_list->subscriber_count - subscriber_idx) *
+                    sizeof(struct __fwk_notification_subscriber));
+            fwk_interrupt_global_enable();
+
+            __FWK_WORKER_POOL_UNLOCK();
+
+            return FWK_SUCCESS;
+        }
+    }
+
     subscription_dlist = get_subscription_dlist(notification_id, source_id);
+    if (subscription_dlist == NULL) {
+        status = FWK_E_STATE;
+        goto error;
+    }
+
     subscription = search_subscription(subscription_dlist,
                                        source_id, target_id);
     if (subscription == NULL) {
@@ -276,9 +548,12 @@ int fwk_notification_unsubscribe(fwk_id_t notification_id, fwk_id_t source_id,
     fwk_interrupt_global_enable();
     fwk_list_push_tail(&ctx.free_subscription_dlist, &subscription->dlist_node);
 
+    __FWK_WORKER_POOL_UNLOCK();
+
     return FWK_SUCCESS;
 
 error:
+    __FWK_WORKER_POOL_UNLOCK();
     FWK_HOST_PRINT(err_msg_func, status, __func__);
     return status;
 }
@@ -298,6 +573,12 @@ int fwk_notification_notify(struct fwk_event *notification_event,
     if ((notification_event == NULL) || (count == NULL))
         return FWK_E_PARAM;
 
+    if ((notification_event->priority >= FWK_EVENT_PRIORITY_COUNT) ||
+        (notification_event->ext_params != NULL)) {
+        status = FWK_E_PARAM;
+        goto error;
+    }
+
     if (fwk_interrupt_get_current(&interrupt) == FWK_SUCCESS) {
         if (!fwk_module_is_valid_entity_id(notification_event->source_id)) {
             status = FWK_E_PARAM;
@@ -317,7 +598,9 @@ int fwk_notification_notify(struct fwk_event *notification_event,
     }
 
     *count = 0;
+    __FWK_WORKER_POOL_LOCK();
     send_notifications(notification_event, count);
+    __FWK_WORKER_POOL_UNLOCK();
 
     return FWK_SUCCESS;
 
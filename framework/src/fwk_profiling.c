@@ -0,0 +1,295 @@
+/*
+ * Arm SCP/MCP Software
+ * Copyright (c) 2015-2019, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Description:
+ *     Event processing and boot profiling.
+ */
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <fwk_errno.h>
+#include <fwk_host.h>
+#include <fwk_id.h>
+#include <fwk_math.h>
+#include <fwk_module.h>
+#include <fwk_profiling.h>
+#include <internal/fwk_module.h>
+#include <internal/fwk_profiling.h>
+
+#if defined(BUILD_HAS_EVENT_PROFILING) || defined(BUILD_HAS_BOOT_PROFILING)
+static struct {
+    /* Function returning the current value of the profiling counter */
+    uint32_t (*read_counter)(void);
+} ctx;
+
+#ifdef BUILD_HOST
+static const char err_msg_func[] = "[PRF] Error %d in %s\n";
+#endif
+
+/*
+ * Private interface functions
+ */
+
+uint32_t __fwk_profiling_get_timestamp(void)
+{
+    return (ctx.read_counter == NULL) ? 0 : ctx.read_counter();
+}
+#endif
+
+#ifdef BUILD_HAS_EVENT_PROFILING
+/*
+ * Static functions
+ */
+
+static void add_duration(struct fwk_profiling_histogram *histogram,
+                         uint32_t duration)
+{
+    unsigned int bin;
+
+    histogram->count++;
+    histogram->total += duration;
+    if (duration > histogram->max)
+        histogram->max = duration;
+
+    bin = (duration == 0) ? 0 : (fwk_math_log2(duration) + 1);
+    if (bin >= FWK_PROFILING_BIN_COUNT)
+        bin = FWK_PROFILING_BIN_COUNT - 1;
+
+    histogram->bins[bin]++;
+}
+
+static void add_event(struct fwk_profiling_stats *stats, uint32_t wait_time,
+                      uint32_t handler_time)
+{
+    add_duration(&stats->wait, wait_time);
+    add_duration(&stats->handler, handler_time);
+}
+
+/*
+ * Private interface functions
+ */
+
+void __fwk_profiling_stamp(struct fwk_event *event)
+{
+    uint32_t (*read_counter)(void) = ctx.read_counter;
+
+    event->is_timestamped = (read_counter != NULL);
+    if (event->is_timestamped)
+        event->put_timestamp = read_counter();
+}
+
+void __fwk_profiling_record(const struct fwk_event *event,
+                            uint32_t dispatch_timestamp)
+{
+    struct fwk_module_ctx *module_ctx;
+    uint32_t wait_time, handler_time;
+
+    if ((ctx.read_counter == NULL) || !event->is_timestamped)
+        return;
+
+    /* Unsigned arithmetic, the counter may have wrapped around */
+    handler_time = ctx.read_counter() - dispatch_timestamp;
+    wait_time = dispatch_timestamp - event->put_timestamp;
+
+    module_ctx = __fwk_module_get_ctx(event->target_id);
+    add_event(&module_ctx->profiling_stats, wait_time, handler_time);
+
+    /*
+     * The target of an event that is neither a response nor a notification is
+     * the module that defines the event.
+     */
+    if (event->is_response || event->is_notification ||
+        (module_ctx->event_profiling_stats_table == NULL))
+        return;
+
+    add_event(
+        &module_ctx->event_profiling_stats_table[
+            fwk_id_get_event_idx(event->id)],
+        wait_time, handler_time);
+}
+#endif
+
+#ifdef BUILD_HAS_BOOT_PROFILING
+/*
+ * Static functions
+ */
+
+static struct fwk_profiling_boot_times *get_boot_times(fwk_id_t id)
+{
+    if (fwk_id_is_type(id, FWK_ID_TYPE_MODULE))
+        return &__fwk_module_get_ctx(id)->boot_times;
+
+    return &__fwk_module_get_element_ctx(id)->boot_times;
+}
+
+/*
+ * Insert an entry in a report sorted by decreasing total time. When the report
+ * is full, the entry with the shortest total time is dropped.
+ */
+static void insert_boot_entry(struct fwk_profiling_boot_entry *entry_table,
+                              unsigned int *entry_count,
+                              unsigned int max_entry_count,
+                              fwk_id_t id,
+                              const struct fwk_profiling_boot_times *times)
+{
+    unsigned int entry_idx = *entry_count;
+
+    if (entry_idx == max_entry_count) {
+        if ((max_entry_count == 0) ||
+            (entry_table[max_entry_count - 1].times.total >= times->total))
+            return;
+
+        entry_idx--;
+    } else
+        (*entry_count)++;
+
+    while ((entry_idx > 0) &&
+           (entry_table[entry_idx - 1].times.total < times->total)) {
+        entry_table[entry_idx] = entry_table[entry_idx - 1];
+        entry_idx--;
+    }
+
+    entry_table[entry_idx].id = id;
+    entry_table[entry_idx].times = *times;
+}
+
+/*
+ * Private interface functions
+ */
+
+void __fwk_profiling_record_boot_stage(fwk_id_t id,
+                                       enum fwk_profiling_boot_stage stage,
+                                       uint32_t begin_timestamp)
+{
+    struct fwk_profiling_boot_times *times;
+    uint32_t duration;
+
+    if (ctx.read_counter == NULL)
+        return;
+
+    /* Unsigned arithmetic, the counter may have wrapped around */
+    duration = ctx.read_counter() - begin_timestamp;
+
+    times = get_boot_times(id);
+    times->stage_times[stage] += duration;
+    times->total += duration;
+}
+#endif
+
+/*
+ * Public interface functions
+ */
+
+int fwk_profiling_set_counter(uint32_t (*read_counter)(void))
+{
+    #if defined(BUILD_HAS_EVENT_PROFILING) || defined(BUILD_HAS_BOOT_PROFILING)
+    ctx.read_counter = read_counter;
+
+    return FWK_SUCCESS;
+    #else
+    return FWK_E_SUPPORT;
+    #endif
+}
+
+int fwk_profiling_get_stats(fwk_id_t id, struct fwk_profiling_stats *stats)
+{
+    #ifdef BUILD_HAS_EVENT_PROFILING
+    int status = FWK_E_PARAM;
+    struct fwk_module_ctx *module_ctx;
+
+    if (stats == NULL)
+        goto error;
+
+    if (fwk_module_is_valid_module_id(id))
+        *stats = __fwk_module_get_ctx(id)->profiling_stats;
+    else if (fwk_module_is_valid_event_id(id)) {
+        module_ctx = __fwk_module_get_ctx(id);
+        if (module_ctx->event_profiling_stats_table == NULL)
+            goto error;
+
+        *stats = module_ctx->event_profiling_stats_table[
+            fwk_id_get_event_idx(id)];
+    } else
+        goto error;
+
+    return FWK_SUCCESS;
+
+error:
+    FWK_HOST_PRINT(err_msg_func, status, __func__);
+    return status;
+    #else
+    return FWK_E_SUPPORT;
+    #endif
+}
+
+int fwk_profiling_get_boot_times(fwk_id_t id,
+                                 struct fwk_profiling_boot_times *times)
+{
+    #ifdef BUILD_HAS_BOOT_PROFILING
+    int status;
+
+    if ((times == NULL) ||
+        (!fwk_module_is_valid_module_id(id) &&
+         !fwk_module_is_valid_element_id(id))) {
+        status = FWK_E_PARAM;
+        goto error;
+    }
+
+    *times = *get_boot_times(id);
+
+    return FWK_SUCCESS;
+
+error:
+    FWK_HOST_PRINT(err_msg_func, status, __func__);
+    return status;
+    #else
+    return FWK_E_SUPPORT;
+    #endif
+}
+
+int fwk_profiling_get_boot_report(struct fwk_profiling_boot_entry *entry_table,
+                                  unsigned int *entry_count)
+{
+    #ifdef BUILD_HAS_BOOT_PROFILING
+    int status;
+    unsigned int module_idx, element_idx;
+    unsigned int max_entry_count;
+    struct fwk_module_ctx *module_ctx;
+    fwk_id_t module_id;
+
+    if ((entry_table == NULL) || (entry_count == NULL)) {
+        status = FWK_E_PARAM;
+        goto error;
+    }
+
+    max_entry_count = *entry_count;
+    *entry_count = 0;
+
+    for (module_idx = 0;
+         fwk_module_is_valid_module_id(FWK_ID_MODULE(module_idx));
+         module_idx++) {
+        module_id = FWK_ID_MODULE(module_idx);
+        module_ctx = __fwk_module_get_ctx(module_id);
+        insert_boot_entry(entry_table, entry_count, max_entry_count,
+                          module_id, &module_ctx->boot_times);
+
+        for (element_idx = 0; element_idx < module_ctx->element_count;
+             element_idx++) {
+            insert_boot_entry(entry_table, entry_count, max_entry_count,
+                fwk_id_build_element_id(module_id, element_idx),
+                &module_ctx->element_ctx_table[element_idx].boot_times);
+        }
+    }
+
+    return FWK_SUCCESS;
+
+error:
+    FWK_HOST_PRINT(err_msg_func, status, __func__);
+    return status;
+    #else
+    return FWK_E_SUPPORT;
+    #endif
+}
@@ -8,6 +8,7 @@
  *     Single-thread facilities.
  */
 
+#include <stdatomic.h>
 #include <stdbool.h>
 #include <string.h>
 #include <fwk_assert.h>
@@ -16,14 +17,53 @@
 #include <fwk_host.h>
 #include <fwk_id.h>
 #include <fwk_interrupt.h>
+#include <fwk_macros.h>
 #include <fwk_mm.h>
 #include <internal/fwk_module.h>
 #include <internal/fwk_notification.h>
+#ifdef BUILD_HAS_EVENT_PROFILING
+#include <internal/fwk_profiling.h>
+#endif
 #include <internal/fwk_single_thread.h>
 #include <internal/fwk_thread.h>
+#include <internal/fwk_worker_pool.h>
+
+/* Number of out-of-line event parameter blocks, none unless configured */
+#ifndef BUILD_EVENT_EXT_PARAMS_COUNT
+#define BUILD_EVENT_EXT_PARAMS_COUNT 0
+#endif
+
+/* Number of events that can be pending from ISRs, a quarter of the pool */
+#ifndef BUILD_ISR_EVENT_COUNT
+#define BUILD_ISR_EVENT_COUNT 16
+#endif
+
+#ifdef BUILD_HAS_NOTIFICATION
+/*
+ * Number of event structures per handle to a shared notification payload, and
+ * number of handles per shared notification payload.
+ */
+#define EVENTS_PER_NOTIFICATION_HANDLE 2
+#define NOTIFICATION_HANDLES_PER_SHARED_NOTIFICATION 8
+#endif
 
 static struct __fwk_thread_ctx ctx;
 
+#ifdef BUILD_HAS_WORKER_POOL
+/* Event being processed by the calling worker */
+static _Thread_local struct fwk_event *current_event;
+#endif
+
+/* Order in which the event queues are serviced, most urgent first */
+static const enum fwk_event_priority priority_order[] = {
+    FWK_EVENT_PRIORITY_HIGH,
+    FWK_EVENT_PRIORITY_NORMAL,
+    FWK_EVENT_PRIORITY_LOW,
+};
+
+static_assert(FWK_ARRAY_SIZE(priority_order) == FWK_EVENT_PRIORITY_COUNT,
+    "Every event priority must be serviced");
+
 #ifdef BUILD_HOST
 static const char err_msg_line[] = "[THR] Error %d in %s @%d\n";
 static const char err_msg_func[] = "[THR] Error %d in %s\n";
@@ -33,41 +73,640 @@ static const char err_msg_func[] = "[THR] Error %d in %s\n";
  * Static functions
  */
 
+/*
+ * Set the event being processed.
+ *
+ * \param event Pointer to the event, NULL once its processing is completed.
+ */
+static void set_current_event(struct fwk_event *event)
+{
+    #ifdef BUILD_HAS_WORKER_POOL
+    current_event = event;
+    #else
+    ctx.current_event = event;
+    #endif
+}
+
+/*
+ * Put an event in the ring of ISR events.
+ *
+ * \note The function may be interrupted by another call to itself from a
+ *      nested interrupt. The slot is reserved atomically before being filled in
+ *      and is published last, once it holds the whole event.
+ *
+ * \param event Pointer to the event to queue.
+ *
+ * \retval FWK_SUCCESS The event was queued.
+ * \retval FWK_E_NOMEM The ring of ISR events is full.
+ */
+static int put_isr_event(struct fwk_event *event)
+{
+    struct __fwk_thread_isr_event_ring *ring = &ctx.isr_event_ring;
+    struct __fwk_thread_isr_event_slot *slot;
+    unsigned int head, tail;
+
+    head = atomic_load_explicit(&ring->head, memory_order_relaxed);
+    do {
+        tail = atomic_load_explicit(&ring->tail, memory_order_acquire);
+        if ((head - tail) > ring->mask) {
+            atomic_fetch_add_explicit(&ring->failed_put_count, 1,
+                                      memory_order_relaxed);
+            FWK_HOST_PRINT(err_msg_func, FWK_E_NOMEM, __func__);
+            assert(false);
+            return FWK_E_NOMEM;
+        }
+    } while (!atomic_compare_exchange_weak_explicit(&ring->head, &head,
+        head + 1, memory_order_relaxed, memory_order_relaxed));
+
+    slot = &ring->slots[head & ring->mask];
+    slot->event = *event;
+    atomic_store_explicit(&slot->ready, true, memory_order_release);
+
+    return FWK_SUCCESS;
+}
+
+/*
+ * Release the out-of-line parameter block of an event, if any.
+ *
+ * \param event Pointer to the event.
+ */
+static void free_ext_params(struct fwk_event *event)
+{
+    int status;
+
+    if (event->ext_params == NULL)
+        return;
+
+    status = fwk_mm_pool_free(ctx.ext_params_pool, event->ext_params);
+    if (status != FWK_SUCCESS)
+        FWK_HOST_PRINT(err_msg_func, status, __func__);
+
+    event->ext_params = NULL;
+}
+
+/*
+ * Take an event structure from the queue of free event structures.
+ *
+ * \return A pointer to the event structure, NULL if none is free.
+ */
+static struct fwk_event *alloc_event(void)
+{
+    struct fwk_event *event;
+
+    event = FWK_LIST_GET(fwk_list_pop_head(&ctx.free_event_queue),
+                         struct fwk_event, slist_node);
+    if (event == NULL) {
+        ctx.stats.failed_alloc_count++;
+        return NULL;
+    }
+
+    if (++ctx.stats.used_event_count > ctx.stats.used_event_count_max)
+        ctx.stats.used_event_count_max = ctx.stats.used_event_count;
+
+    return event;
+}
+
+/*
+ * Give an event structure back to the queue of free event structures.
+ *
+ * \param event Pointer to the event structure.
+ */
+static void free_event(struct fwk_event *event)
+{
+    free_ext_params(event);
+
+    ctx.stats.used_event_count--;
+    fwk_list_push_tail(&ctx.free_event_queue, &event->slist_node);
+}
+
+#ifdef BUILD_HAS_WORKER_POOL
+/*
+ * Get the worker pool context of the target of an event.
+ *
+ * \param target_id Identifier of the module, element or sub-element.
+ *
+ * \return A pointer to the worker pool context of the module or element.
+ */
+static struct __fwk_worker_pool_entity *get_worker_pool_entity(
+    fwk_id_t target_id)
+{
+    if (fwk_id_is_type(target_id, FWK_ID_TYPE_MODULE))
+        return &__fwk_module_get_ctx(target_id)->worker_pool_entity;
+
+    return &__fwk_module_get_element_ctx(target_id)->worker_pool_entity;
+}
+#endif
+
+/*
+ * Put an event, or a handle to a shared notification payload, at the tail of
+ * the event queue of a given priority.
+ *
+ * \note With the worker pool, the event is put at the tail of the event queue
+ *      of its target instead, whatever its priority.
+ *
+ * \param node Linked list node of the event or of the handle.
+ * \param target_id Identifier of the target of the event.
+ * \param priority Priority of the event.
+ */
+static void queue_event(struct fwk_slist_node *node, fwk_id_t target_id,
+                        enum fwk_event_priority priority)
+{
+    struct fwk_thread_queue_stats *queue_stats = &ctx.stats.event_queue;
+
+    #ifdef BUILD_HAS_WORKER_POOL
+    (void)priority;
+    __fwk_worker_pool_queue(get_worker_pool_entity(target_id), node);
+    #else
+    (void)target_id;
+    fwk_list_push_tail(&ctx.event_queue[priority], node);
+    #endif
+
+    if (++queue_stats->depth > queue_stats->depth_max)
+        queue_stats->depth_max = queue_stats->depth;
+}
+
+/*
+ * Get the event a node of one of the event queues refers to.
+ *
+ * \note The payload of a shared notification is not modified, its target is
+ *      the one of the first handle that was processed. The caller processing
+ *      the node is responsible for setting the target from the handle.
+ *
+ * \param node Node of one of the event queues.
+ * \param [out] handle Handle to a shared notification payload the node is the
+ *      node of, NULL if the node is the node of an event structure.
+ *
+ * \return A pointer to the event.
+ */
+static struct fwk_event *get_queued_event(struct fwk_slist_node *node,
+    struct __fwk_thread_notification_handle **handle)
+{
+    #ifdef BUILD_HAS_NOTIFICATION
+    uintptr_t table_start, table_end;
+    struct __fwk_thread_notification_handle *notification_handle;
+
+    table_start = (uintptr_t)ctx.notification_handle_table;
+    table_end = (uintptr_t)(ctx.notification_handle_table +
+                            ctx.notification_handle_count);
+
+    if (((uintptr_t)node >= table_start) && ((uintptr_t)node < table_end)) {
+        notification_handle = FWK_LIST_GET(node,
+            struct __fwk_thread_notification_handle, slist_node);
+
+        *handle = notification_handle;
+        return &notification_handle->notification->event;
+    }
+    #endif
+
+    *handle = NULL;
+    return FWK_LIST_GET(node, struct fwk_event, slist_node);
+}
+
+/*
+ * Search the event queues for an event awaiting processing that a new event can
+ * be coalesced with.
+ *
+ * \param event Pointer to the new event.
+ *
+ * \return A pointer to the pending event, NULL if there is none.
+ */
+static struct fwk_event *search_pending_event(const struct fwk_event *event)
+{
+    struct fwk_slist *event_queue;
+    struct fwk_slist_node *node;
+    struct fwk_event *pending_event;
+    struct __fwk_thread_notification_handle *handle;
+
+    if (!event->coalesce)
+        return NULL;
+
+    #ifdef BUILD_HAS_WORKER_POOL
+    event_queue = &get_worker_pool_entity(event->target_id)->event_queue;
+    #else
+    event_queue = &ctx.event_queue[event->priority];
+    #endif
+
+    for (node = fwk_list_head(event_queue); node != NULL;
+         node = fwk_list_next(event_queue, node)) {
+        pending_event = get_queued_event(node, &handle);
+        if ((handle == NULL) &&
+            __FWK_THREAD_CAN_COALESCE(pending_event, event))
+            return pending_event;
+    }
+
+    return NULL;
+}
+
+/*
+ * Coalesce a new event with an event awaiting processing.
+ *
+ * \details The source and the parameters of the pending event are replaced by
+ *      the ones of the new event. The ownership of the out-of-line parameters
+ *      of the new event, if any, is transferred to the pending event.
+ *
+ * \param pending_event Pointer to the event awaiting processing.
+ * \param event Pointer to the new event.
+ */
+static void coalesce_event(struct fwk_event *pending_event,
+                           const struct fwk_event *event)
+{
+    free_ext_params(pending_event);
+
+    pending_event->source_id = event->source_id;
+    memcpy(pending_event->params, event->params, sizeof(event->params));
+    pending_event->ext_params = event->ext_params;
+
+    ctx.stats.coalesced_event_count++;
+}
+
 static int put_event(struct fwk_event *event)
 {
-    struct fwk_event *free_event;
+    struct fwk_event *allocated_event, *pending_event;
     unsigned int interrupt;
 
-    free_event = FWK_LIST_GET(fwk_list_pop_head(&ctx.free_event_queue),
-        struct fwk_event, slist_node);
+    #ifdef BUILD_HAS_EVENT_PROFILING
+    __fwk_profiling_stamp(event);
+    #endif
+
+    if (fwk_interrupt_get_current(&interrupt) == FWK_SUCCESS)
+        return put_isr_event(event);
+
+    pending_event = search_pending_event(event);
+    if (pending_event != NULL) {
+        coalesce_event(pending_event, event);
+        return FWK_SUCCESS;
+    }
 
-    if (free_event == NULL) {
+    allocated_event = alloc_event();
+    if (allocated_event == NULL) {
+        ctx.stats.event_queue.failed_put_count++;
         FWK_HOST_PRINT(err_msg_func, FWK_E_NOMEM, __func__);
         assert(false);
         return FWK_E_NOMEM;
     }
 
-    *free_event = *event;
+    *allocated_event = *event;
 
-    if (fwk_interrupt_get_current(&interrupt) != FWK_SUCCESS)
-        fwk_list_push_tail(&ctx.event_queue, &free_event->slist_node);
-    else
-        fwk_list_push_tail(&ctx.isr_event_queue, &free_event->slist_node);
+    queue_event(&allocated_event->slist_node, allocated_event->target_id,
+                allocated_event->priority);
 
     return FWK_SUCCESS;
 }
 
-static void process_next_event(void)
+/*
+ * Put an event the delay of which has elapsed in the event queues.
+ *
+ * \param event Pointer to the event structure holding the event.
+ */
+static void queue_due_event(struct fwk_event *event)
+{
+    struct fwk_event *pending_event;
+
+    #ifdef BUILD_HAS_EVENT_PROFILING
+    __fwk_profiling_stamp(event);
+    #endif
+
+    pending_event = search_pending_event(event);
+    if (pending_event != NULL) {
+        coalesce_event(pending_event, event);
+        event->ext_params = NULL;
+        free_event(event);
+        return;
+    }
+
+    queue_event(&event->slist_node, event->target_id, event->priority);
+}
+
+/*
+ * Move a delayed event towards the root of the heap of delayed events until
+ * the heap is ordered.
+ *
+ * \param idx Index of the delayed event in the heap.
+ */
+static void sift_delayed_event_up(unsigned int idx)
+{
+    struct __fwk_thread_delayed_event *heap = ctx.delayed_event_heap;
+    struct __fwk_thread_delayed_event delayed_event = heap[idx];
+    unsigned int parent_idx;
+
+    while (idx > 0) {
+        parent_idx = (idx - 1) / 2;
+        if (heap[parent_idx].timestamp <= delayed_event.timestamp)
+            break;
+
+        heap[idx] = heap[parent_idx];
+        idx = parent_idx;
+    }
+
+    heap[idx] = delayed_event;
+}
+
+/*
+ * Move a delayed event towards the leaves of the heap of delayed events until
+ * the heap is ordered.
+ *
+ * \param idx Index of the delayed event in the heap.
+ */
+static void sift_delayed_event_down(unsigned int idx)
+{
+    struct __fwk_thread_delayed_event *heap = ctx.delayed_event_heap;
+    struct __fwk_thread_delayed_event delayed_event = heap[idx];
+    unsigned int child_idx;
+
+    for (;;) {
+        child_idx = (2 * idx) + 1;
+        if (child_idx >= ctx.delayed_event_count)
+            break;
+
+        if (((child_idx + 1) < ctx.delayed_event_count) &&
+            (heap[child_idx + 1].timestamp < heap[child_idx].timestamp))
+            child_idx++;
+
+        if (delayed_event.timestamp <= heap[child_idx].timestamp)
+            break;
+
+        heap[idx] = heap[child_idx];
+        idx = child_idx;
+    }
+
+    heap[idx] = delayed_event;
+}
+
+/*
+ * Remove a delayed event from the heap of delayed events.
+ *
+ * \param idx Index of the delayed event in the heap.
+ */
+static void remove_delayed_event(unsigned int idx)
+{
+    struct __fwk_thread_delayed_event *heap = ctx.delayed_event_heap;
+
+    if (idx == --ctx.delayed_event_count)
+        return;
+
+    heap[idx] = heap[ctx.delayed_event_count];
+    sift_delayed_event_down(idx);
+    sift_delayed_event_up(idx);
+}
+
+/*
+ * Hold an event until a delay has elapsed.
+ *
+ * \param event Pointer to the event to hold.
+ * \param microseconds Delay in microseconds.
+ * \param periodic Flag indicating whether the event is put every delay until
+ *      it is cancelled.
+ *
+ * \retval FWK_SUCCESS The event is held until the delay has elapsed.
+ * \retval FWK_E_NOMEM All the event structures are in use.
+ * \return One of the error codes of the timer driver.
+ */
+static int hold_event(struct fwk_event *event, uint32_t microseconds,
+                      bool periodic)
+{
+    int status;
+    uint64_t counter, ticks;
+    struct fwk_event *allocated_event;
+    struct __fwk_thread_delayed_event *delayed_event;
+
+    status = ctx.timer_driver->get_counter(&counter);
+    if (status != FWK_SUCCESS)
+        return status;
+
+    allocated_event = alloc_event();
+    if (allocated_event == NULL)
+        return FWK_E_NOMEM;
+
+    *allocated_event = *event;
+
+    ticks = ((uint64_t)ctx.timer_driver->frequency * microseconds) / 1000000;
+
+    delayed_event = &ctx.delayed_event_heap[ctx.delayed_event_count];
+    delayed_event->timestamp = counter + ticks;
+    delayed_event->period = periodic ? FWK_MAX(ticks, (uint64_t)1) : 0;
+    delayed_event->event = allocated_event;
+    sift_delayed_event_up(ctx.delayed_event_count++);
+
+    /* The alarm only has to be moved if the event is the first one due */
+    if (ctx.delayed_event_heap[0].event != allocated_event)
+        return FWK_SUCCESS;
+
+    status = ctx.timer_driver->set_alarm(ctx.delayed_event_heap[0].timestamp);
+    if (status != FWK_SUCCESS) {
+        remove_delayed_event(0);
+        /* The out-of-line parameters are still owned by the caller */
+        allocated_event->ext_params = NULL;
+        free_event(allocated_event);
+    }
+
+    return status;
+}
+
+/*
+ * Put the delayed events that are due in the event queues, if the alarm of the
+ * timer has expired.
+ *
+ * \note The alarm may expire with no event due, for instance when the events
+ *      it was set for have been cancelled.
+ *
+ * \retval true At least one event was put in the event queues.
+ * \retval false No event was put in the event queues.
+ */
+static bool process_timer(void)
+{
+    int status;
+    bool queued = false;
+    uint64_t counter;
+    struct __fwk_thread_delayed_event *delayed_event;
+    struct fwk_event *event;
+
+    if (!atomic_exchange_explicit(&ctx.timer_signaled, false,
+                                  memory_order_acquire))
+        return false;
+
+    status = ctx.timer_driver->get_counter(&counter);
+    if (status != FWK_SUCCESS)
+        goto error;
+
+    while (ctx.delayed_event_count != 0) {
+        delayed_event = &ctx.delayed_event_heap[0];
+        if (delayed_event->timestamp > counter)
+            break;
+
+        if (delayed_event->period == 0) {
+            event = delayed_event->event;
+            remove_delayed_event(0);
+        } else {
+            event = alloc_event();
+            if (event != NULL)
+                *event = *delayed_event->event;
+            else
+                FWK_HOST_PRINT(err_msg_func, FWK_E_NOMEM, __func__);
+
+            /* Skip the occurrences the processing of events fell behind on */
+            delayed_event->timestamp += delayed_event->period *
+                (((counter - delayed_event->timestamp) /
+                  delayed_event->period) + 1);
+            sift_delayed_event_down(0);
+        }
+
+        if (event != NULL) {
+            queue_due_event(event);
+            queued = true;
+        }
+    }
+
+    if (ctx.delayed_event_count == 0)
+        return queued;
+
+    status = ctx.timer_driver->set_alarm(ctx.delayed_event_heap[0].timestamp);
+    if (status != FWK_SUCCESS)
+        goto error;
+
+    return queued;
+
+error:
+    FWK_HOST_PRINT(err_msg_func, status, __func__);
+    return queued;
+}
+
+/*
+ * Release the storage of an event once it has been processed.
+ *
+ * \param event Pointer to the event.
+ * \param handle Handle to the shared notification payload the event is part
+ *      of, NULL if the event has its own event structure.
+ */
+static void release_queued_event(struct fwk_event *event,
+    struct __fwk_thread_notification_handle *handle)
+{
+    #ifdef BUILD_HAS_NOTIFICATION
+    struct __fwk_thread_shared_notification *notification;
+
+    if (handle != NULL) {
+        notification = handle->notification;
+        if (--notification->ref_count == 0) {
+            fwk_list_push_tail(&ctx.free_shared_notification_queue,
+                               &notification->event.slist_node);
+        }
+
+        fwk_list_push_tail(&ctx.free_notification_handle_queue,
+                           &handle->slist_node);
+        return;
+    }
+    #endif
+
+    free_event(event);
+}
+
+#ifndef BUILD_HAS_WORKER_POOL
+/*
+ * Get the highest priority queue with at least one event awaiting processing.
+ *
+ * \return A pointer to the event queue, NULL if all the queues are empty.
+ */
+static struct fwk_slist *get_next_event_queue(void)
+{
+    unsigned int i;
+    struct fwk_slist *event_queue;
+
+    for (i = 0; i < FWK_ARRAY_SIZE(priority_order); i++) {
+        event_queue = &ctx.event_queue[priority_order[i]];
+        if (!fwk_list_is_empty(event_queue))
+            return event_queue;
+    }
+
+    return NULL;
+}
+#endif
+
+/*
+ * Activate the target of an event, if it is an element initialized lazily and
+ * not active yet.
+ *
+ * \param target_id Identifier of the target of the event.
+ *
+ * \retval FWK_SUCCESS The target is active.
+ * \return One of the error codes of __fwk_module_activate().
+ */
+static int activate_target(fwk_id_t target_id)
+{
+    #ifdef BUILD_HAS_WORKER_POOL
+    int status;
+    enum fwk_module_state state;
+
+    if (fwk_id_is_type(target_id, FWK_ID_TYPE_MODULE) ||
+        (__fwk_module_get_state(target_id, &state) != FWK_SUCCESS) ||
+        (state != FWK_MODULE_STATE_UNINITIALIZED))
+        return FWK_SUCCESS;
+
+    /* The element handlers called on activation run alone */
+    __fwk_worker_pool_begin_handler(false);
+    __fwk_worker_pool_lock();
+    status = __fwk_module_activate(target_id);
+    __fwk_worker_pool_unlock();
+    __fwk_worker_pool_end_handler(false);
+
+    return status;
+    #else
+    return __fwk_module_activate(target_id);
+    #endif
+}
+
+/*
+ * Call the handler of an event.
+ *
+ * \note With the worker pool, the framework lock is released during the call.
+ *
+ * \param module Module the target of the event belongs to.
+ * \param process_event Handler of the event.
+ * \param event Pointer to the event.
+ * \param [out] resp_event Response event to the event, if any.
+ *
+ * \return The status returned by the handler.
+ */
+static int call_handler(const struct fwk_module *module,
+    int (*process_event)(const struct fwk_event *event,
+                         struct fwk_event *resp_event),
+    const struct fwk_event *event, struct fwk_event *resp_event)
+{
+    #ifdef BUILD_HAS_WORKER_POOL
+    int status;
+
+    __fwk_worker_pool_begin_handler(module->concurrent_event_processing);
+    status = process_event(event, resp_event);
+    __fwk_worker_pool_end_handler(module->concurrent_event_processing);
+
+    return status;
+    #else
+    (void)module;
+
+    return process_event(event, resp_event);
+    #endif
+}
+
+/*
+ * Process an event.
+ *
+ * \param node Node of the event, popped from one of the event queues.
+ */
+static void process_next_event(struct fwk_slist_node *node)
 {
     int status;
     struct fwk_event *event, async_response_event = {0};
+    struct __fwk_thread_notification_handle *handle;
     const struct fwk_module *module;
     int (*process_event)(const struct fwk_event *event,
                          struct fwk_event *resp_event);
+    #ifdef BUILD_HAS_EVENT_PROFILING
+    uint32_t dispatch_timestamp;
+    #endif
 
-
-    ctx.current_event = event = FWK_LIST_GET(
-        fwk_list_pop_head(&ctx.event_queue), struct fwk_event, slist_node);
+    event = get_queued_event(node, &handle);
+    if (handle != NULL)
+        event->target_id = handle->target_id;
+    set_current_event(event);
+    ctx.stats.event_queue.depth--;
 
     FWK_HOST_PRINT("[THR] Get event (%s,%s,%s)\n",
                    FWK_ID_STR(event->source_id), FWK_ID_STR(event->target_id),
@@ -77,53 +716,207 @@ static void process_next_event(void)
     process_event = event->is_notification ? module->process_notification :
                     module->process_event;
 
-    if (event->response_requested) {
+    /* The target may be an element initialized lazily and not active yet */
+    status = activate_target(event->target_id);
+
+    #ifdef BUILD_HAS_EVENT_PROFILING
+    dispatch_timestamp = __fwk_profiling_get_timestamp();
+    #endif
+
+    if (status != FWK_SUCCESS)
+        FWK_HOST_PRINT(err_msg_line, status, __func__, __LINE__);
+    else if (event->response_requested) {
         async_response_event.source_id = event->target_id;
         async_response_event.target_id = event->source_id;
         async_response_event.id = event->id;
+        async_response_event.priority = event->priority;
         memcpy(&async_response_event.params, &event->params,
                sizeof(async_response_event.params));
 
-        status = process_event(event, &async_response_event);
+        status = call_handler(module, process_event, event,
+                              &async_response_event);
         if (status != FWK_SUCCESS)
             FWK_HOST_PRINT(err_msg_line, status, __func__, __LINE__);
 
         async_response_event.is_response = true;
         async_response_event.response_requested = false;
         async_response_event.is_notification = event->is_notification;
-        if (!async_response_event.is_delayed_response)
-            put_event(&async_response_event);
+        if (async_response_event.is_delayed_response ||
+            (put_event(&async_response_event) != FWK_SUCCESS))
+            free_ext_params(&async_response_event);
     } else {
-        status = process_event(event, &async_response_event);
+        status = call_handler(module, process_event, event,
+                              &async_response_event);
         if (status != FWK_SUCCESS)
             FWK_HOST_PRINT(err_msg_line, status, __func__, __LINE__);
     }
 
-    ctx.current_event = NULL;
+    set_current_event(NULL);
 
-    fwk_interrupt_global_disable();
-    fwk_list_push_tail(&ctx.free_event_queue, &event->slist_node);
-    fwk_interrupt_global_enable();
+    #ifdef BUILD_HAS_EVENT_PROFILING
+    __fwk_profiling_record(event, dispatch_timestamp);
+    #endif
+
+    release_queued_event(event, handle);
 
     return;
 }
 
-static void process_isr(void)
-{
-    struct fwk_event *isr_event;
+/*
+ * Get the next event of the ring of ISR events if any.
+ *
+ * \return A pointer to the ring slot containing the event, NULL if there is no
+ *      ISR event awaiting processing.
+ */
+static struct __fwk_thread_isr_event_slot *get_next_isr_event_slot(void)
+{
+    struct __fwk_thread_isr_event_ring *ring = &ctx.isr_event_ring;
+    struct __fwk_thread_isr_event_slot *slot;
+    unsigned int tail;
+
+    tail = atomic_load_explicit(&ring->tail, memory_order_relaxed);
+    slot = &ring->slots[tail & ring->mask];
+
+    if (!atomic_load_explicit(&slot->ready, memory_order_acquire))
+        return NULL;
+
+    return slot;
+}
+
+/*
+ * Move all the events awaiting processing in the ring of ISR events to the
+ * event queues, preserving their order.
+ *
+ * \note The ISR events are moved as long as free event structures are
+ *      available. The remaining ones, if any, are left in the ring until the
+ *      processing of events releases event structures.
+ */
+static void process_isr(void)
+{
+    struct __fwk_thread_isr_event_ring *ring = &ctx.isr_event_ring;
+    struct __fwk_thread_isr_event_slot *slot;
+    struct fwk_event *isr_event, *pending_event;
+    unsigned int tail, count, depth;
+
+    tail = atomic_load_explicit(&ring->tail, memory_order_relaxed);
+
+    depth = atomic_load_explicit(&ring->head, memory_order_relaxed) - tail;
+    if (depth > ctx.stats.isr_event_queue.depth_max)
+        ctx.stats.isr_event_queue.depth_max = depth;
+
+    for (count = 0; ; count++) {
+        slot = &ring->slots[(tail + count) & ring->mask];
+        if (!atomic_load_explicit(&slot->ready, memory_order_acquire))
+            break;
+
+        pending_event = search_pending_event(&slot->event);
+        if (pending_event != NULL) {
+            coalesce_event(pending_event, &slot->event);
+            atomic_store_explicit(&slot->ready, false, memory_order_relaxed);
+            continue;
+        }
+
+        isr_event = alloc_event();
+        if (isr_event == NULL) {
+            FWK_HOST_PRINT(err_msg_func, FWK_E_NOMEM, __func__);
+            break;
+        }
+
+        *isr_event = slot->event;
+        atomic_store_explicit(&slot->ready, false, memory_order_relaxed);
+
+        FWK_HOST_PRINT("[THR] Get ISR event (%s,%s,%s)\n",
+                       FWK_ID_STR(isr_event->source_id),
+                       FWK_ID_STR(isr_event->target_id),
+                       FWK_ID_STR(isr_event->id));
+
+        queue_event(&isr_event->slist_node, isr_event->target_id,
+                    isr_event->priority);
+    }
+
+    /* Release all the consumed slots to the ISRs at once */
+    if (count != 0)
+        atomic_store_explicit(&ring->tail, tail + count, memory_order_release);
+
+    ctx.isr_event_batch_count = count;
+    if (count > ctx.isr_event_batch_count_max)
+        ctx.isr_event_batch_count_max = count;
+}
+
+#ifdef BUILD_HAS_WORKER_POOL
+/*
+ * Move the events awaiting processing in the ring of ISR events, if any, and
+ * the delayed events that are due to the event queues.
+ *
+ * \retval true At least one event was moved.
+ * \retval false No event was moved.
+ */
+static bool process_pending_isr(void)
+{
+    bool queued;
+
+    queued = process_timer();
+
+    if (get_next_isr_event_slot() == NULL)
+        return queued;
+
+    process_isr();
+
+    return queued || (ctx.isr_event_batch_count != 0);
+}
+#endif
+
+#ifdef BUILD_HAS_NOTIFICATION
+/*
+ * Allocate the shared notification payloads and their handles.
+ *
+ * \param event_count Number of event structures, the number of payloads and
+ *      handles is derived from. If it is too small for a payload to be
+ *      referenced by several handles, nothing is allocated and the
+ *      notifications are copied for each of their targets.
+ */
+static int init_shared_notifications(size_t event_count)
+{
+    struct __fwk_thread_shared_notification *notification_table;
+    unsigned int i, notification_count, handle_count;
+
+    handle_count = event_count / EVENTS_PER_NOTIFICATION_HANDLE;
+    notification_count =
+        handle_count / NOTIFICATION_HANDLES_PER_SHARED_NOTIFICATION;
+
+    fwk_list_init(&ctx.free_shared_notification_queue);
+    fwk_list_init(&ctx.free_notification_handle_queue);
+    ctx.notification_handle_table = NULL;
+    ctx.notification_handle_count = 0;
+
+    if (notification_count == 0)
+        return FWK_SUCCESS;
+
+    notification_table = fwk_mm_calloc(notification_count,
+        sizeof(struct __fwk_thread_shared_notification));
+    if (notification_table == NULL)
+        return FWK_E_NOMEM;
+
+    ctx.notification_handle_table = fwk_mm_calloc(handle_count,
+        sizeof(struct __fwk_thread_notification_handle));
+    if (ctx.notification_handle_table == NULL)
+        return FWK_E_NOMEM;
+
+    ctx.notification_handle_count = handle_count;
 
-    fwk_interrupt_global_disable();
-    isr_event = FWK_LIST_GET(fwk_list_pop_head(&ctx.isr_event_queue),
-                             struct fwk_event, slist_node);
-    fwk_interrupt_global_enable();
+    for (i = 0; i < notification_count; i++) {
+        fwk_list_push_tail(&ctx.free_shared_notification_queue,
+                           &notification_table[i].event.slist_node);
+    }
 
-    FWK_HOST_PRINT("[THR] Get ISR event (%s,%s,%s)\n",
-                   FWK_ID_STR(isr_event->source_id),
-                   FWK_ID_STR(isr_event->target_id),
-                   FWK_ID_STR(isr_event->id));
+    for (i = 0; i < handle_count; i++) {
+        fwk_list_push_tail(&ctx.free_notification_handle_queue,
+                           &ctx.notification_handle_table[i].slist_node);
+    }
 
-    fwk_list_push_tail(&ctx.event_queue, &isr_event->slist_node);
+    return FWK_SUCCESS;
 }
+#endif
 
 /*
  * Private interface functions
@@ -133,6 +926,49 @@ int __fwk_thread_init(size_t event_count)
 {
     int status;
     struct fwk_event *event_table, *event;
+    struct __fwk_thread_isr_event_slot *isr_event_slot_table;
+    unsigned int priority, isr_event_count;
+
+    /*
+     * The ring of ISR events is sized from the ISR event budget rather than
+     * from the event structures, each slot holding a full event. There is no
+     * point in having more slots than event structures to move the events
+     * to. The size is rounded up to a power of two.
+     */
+    isr_event_count = 1;
+    while ((isr_event_count < BUILD_ISR_EVENT_COUNT) &&
+           (isr_event_count < event_count))
+        isr_event_count <<= 1;
+
+    isr_event_slot_table = fwk_mm_calloc(isr_event_count,
+        sizeof(struct __fwk_thread_isr_event_slot));
+    if (isr_event_slot_table == NULL) {
+        status = FWK_E_NOMEM;
+        goto error;
+    }
+
+    #ifdef BUILD_HAS_NOTIFICATION
+    status = init_shared_notifications(event_count);
+    if (status != FWK_SUCCESS)
+        goto error;
+    #endif
+
+    #ifdef BUILD_HAS_WORKER_POOL
+    status = __fwk_worker_pool_init(0);
+    if (status != FWK_SUCCESS)
+        goto error;
+    #endif
+
+    #if BUILD_EVENT_EXT_PARAMS_COUNT > 0
+    ctx.ext_params_pool = fwk_mm_pool_create(FWK_EVENT_EXT_PARAMETERS_SIZE,
+                                             BUILD_EVENT_EXT_PARAMS_COUNT);
+    if (ctx.ext_params_pool == NULL) {
+        status = FWK_E_NOMEM;
+        goto error;
+    }
+    #else
+    ctx.ext_params_pool = NULL;
+    #endif
 
     event_table = fwk_mm_calloc(event_count, sizeof(struct fwk_event));
     if (event_table == NULL) {
@@ -142,8 +978,17 @@ int __fwk_thread_init(size_t event_count)
 
     /* All the event structures are free to be used. */
     fwk_list_init(&ctx.free_event_queue);
-    fwk_list_init(&ctx.event_queue);
-    fwk_list_init(&ctx.isr_event_queue);
+    for (priority = 0; priority < FWK_EVENT_PRIORITY_COUNT; priority++)
+        fwk_list_init(&ctx.event_queue[priority]);
+
+    ctx.isr_event_ring.slots = isr_event_slot_table;
+    ctx.isr_event_ring.mask = isr_event_count - 1;
+    atomic_init(&ctx.isr_event_ring.head, 0);
+    atomic_init(&ctx.isr_event_ring.tail, 0);
+    atomic_init(&ctx.isr_event_ring.failed_put_count, 0);
+    atomic_init(&ctx.timer_signaled, false);
+
+    ctx.stats = (struct fwk_thread_stats) { .event_count = event_count };
 
     for (event = event_table;
          event < (event_table + event_count);
@@ -161,15 +1006,24 @@ error:
 
 noreturn void __fwk_thread_run(void)
 {
+    #ifdef BUILD_HAS_WORKER_POOL
+    __fwk_worker_pool_run(process_next_event, process_pending_isr);
+    #else
+    struct fwk_slist *event_queue;
+
     for (;;) {
-        while (!fwk_list_is_empty(&ctx.event_queue))
-            process_next_event();
+        while ((event_queue = get_next_event_queue()) != NULL)
+            process_next_event(fwk_list_pop_head(event_queue));
 
-        while (fwk_list_is_empty(&ctx.isr_event_queue))
+        while ((get_next_isr_event_slot() == NULL) &&
+               !atomic_load_explicit(&ctx.timer_signaled,
+                                     memory_order_relaxed))
             continue;
 
         process_isr();
+        process_timer();
     }
+    #endif
 }
 
 struct __fwk_thread_ctx *__fwk_thread_get_ctx(void)
@@ -179,61 +1033,448 @@ struct __fwk_thread_ctx *__fwk_thread_get_ctx(void)
 
 const struct fwk_event *__fwk_thread_get_current_event(void)
 {
+    #ifdef BUILD_HAS_WORKER_POOL
+    return current_event;
+    #else
     return ctx.current_event;
+    #endif
 }
 
 #ifdef BUILD_HAS_NOTIFICATION
 int __fwk_thread_put_notification(struct fwk_event *event)
 {
+    unsigned int interrupt;
+    struct __fwk_thread_shared_notification *notification;
+    struct __fwk_thread_notification_handle *handle;
+
     event->is_response = false;
     event->is_notification = true;
 
-    return put_event(event);
+    notification = ctx.shared_notification;
+    if ((notification == NULL) ||
+        (fwk_interrupt_get_current(&interrupt) == FWK_SUCCESS))
+        return put_event(event);
+
+    handle = FWK_LIST_GET(
+        fwk_list_pop_head(&ctx.free_notification_handle_queue),
+        struct __fwk_thread_notification_handle, slist_node);
+    if (handle == NULL)
+        return put_event(event);
+
+    handle->target_id = event->target_id;
+    handle->notification = notification;
+    notification->ref_count++;
+
+    queue_event(&handle->slist_node, handle->target_id,
+                notification->event.priority);
+
+    return FWK_SUCCESS;
+}
+
+int __fwk_thread_share_notification(const struct fwk_event *event)
+{
+    unsigned int interrupt;
+    struct __fwk_thread_shared_notification *notification;
+
+    if (fwk_interrupt_get_current(&interrupt) == FWK_SUCCESS)
+        return FWK_E_HANDLER;
+
+    #ifdef BUILD_HAS_WORKER_POOL
+    /*
+     * The handlers of a notification may run concurrently on several workers
+     * and thus each need their own copy of the notification.
+     */
+    (void)event;
+    (void)notification;
+    return FWK_E_SUPPORT;
+    #else
+    if (ctx.shared_notification != NULL)
+        return FWK_E_STATE;
+
+    notification = FWK_LIST_GET(
+        fwk_list_pop_head(&ctx.free_shared_notification_queue),
+        struct __fwk_thread_shared_notification, event.slist_node);
+    if (notification == NULL)
+        return FWK_E_NOMEM;
+
+    notification->event = *event;
+    notification->event.is_response = false;
+    notification->event.is_notification = true;
+    notification->ref_count = 0;
+
+    #ifdef BUILD_HAS_EVENT_PROFILING
+    __fwk_profiling_stamp(&notification->event);
+    #endif
+
+    ctx.shared_notification = notification;
+
+    return FWK_SUCCESS;
+    #endif
+}
+
+void __fwk_thread_unshare_notification(void)
+{
+    struct __fwk_thread_shared_notification *notification;
+
+    notification = ctx.shared_notification;
+    if (notification == NULL)
+        return;
+
+    if (notification->ref_count == 0) {
+        fwk_list_push_tail(&ctx.free_shared_notification_queue,
+                           &notification->event.slist_node);
+    }
+
+    ctx.shared_notification = NULL;
 }
 #endif
 
 /*
- * Public interface functions
+ * Check an event put by an entity and populate its source identifier.
+ *
+ * \param event Pointer to the event.
+ *
+ * \retval FWK_SUCCESS The event is valid.
+ * \retval FWK_E_PARAM The event is invalid.
  */
-
-int fwk_thread_put_event(struct fwk_event *event)
+static int check_event(struct fwk_event *event)
 {
-    int status = FWK_E_PARAM;
     unsigned int interrupt;
-
-    if (!ctx.initialized) {
-        status = FWK_E_INIT;
-        goto error;
-    }
+    const struct fwk_event *processed_event;
 
     if (event == NULL)
-        goto error;
+        return FWK_E_PARAM;
 
+    if (event->priority >= FWK_EVENT_PRIORITY_COUNT)
+        return FWK_E_PARAM;
+
+    processed_event = __fwk_thread_get_current_event();
     if ((fwk_interrupt_get_current(&interrupt) != FWK_SUCCESS) &&
-        (ctx.current_event != NULL))
-        event->source_id = ctx.current_event->target_id;
+        (processed_event != NULL))
+        event->source_id = processed_event->target_id;
     else if (!fwk_module_is_valid_entity_id(event->source_id))
-        goto error;
+        return FWK_E_PARAM;
 
     if (!fwk_module_is_valid_entity_id(event->target_id) ||
         !fwk_module_is_valid_event_id(event->id))
-        goto error;
+        return FWK_E_PARAM;
 
     if (event->is_response) {
         if (fwk_id_get_module_idx(event->source_id) !=
             fwk_id_get_module_idx(event->id))
-            goto error;
+            return FWK_E_PARAM;
         if (event->response_requested)
-            goto error;
+            return FWK_E_PARAM;
     } else {
         if (fwk_id_get_module_idx(event->target_id) !=
             fwk_id_get_module_idx(event->id))
-             goto error;
+            return FWK_E_PARAM;
         if (event->is_notification)
-            goto error;
+            return FWK_E_PARAM;
+    }
+
+    return FWK_SUCCESS;
+}
+
+/*
+ * Check an event and hold it until a delay has elapsed.
+ *
+ * This function is a sub-routine of the fwk_thread_put_event_delayed() and
+ * fwk_thread_put_event_periodic() interface functions.
+ *
+ * \param event Pointer to the event.
+ * \param microseconds Delay in microseconds.
+ * \param periodic Flag indicating whether the event is put every delay until
+ *      it is cancelled.
+ *
+ * \return See fwk_thread_put_event_delayed() and
+ *      fwk_thread_put_event_periodic().
+ */
+static int put_delayed_event(struct fwk_event *event, uint32_t microseconds,
+                             bool periodic)
+{
+    int status = FWK_E_PARAM;
+    unsigned int interrupt;
+
+    if (!ctx.initialized) {
+        status = FWK_E_INIT;
+        goto error;
+    }
+
+    if (fwk_interrupt_get_current(&interrupt) == FWK_SUCCESS) {
+        status = FWK_E_ACCESS;
+        goto error;
+    }
+
+    status = check_event(event);
+    if (status != FWK_SUCCESS)
+        goto error;
+
+    if (event->is_response) {
+        status = FWK_E_PARAM;
+        goto error;
+    }
+
+    /* Each occurrence of a periodic event would share the parameter block */
+    if (periodic && ((event->ext_params != NULL) || (microseconds == 0))) {
+        status = FWK_E_PARAM;
+        goto error;
+    }
+
+    if (ctx.timer_driver == NULL) {
+        status = FWK_E_SUPPORT;
+        goto error;
+    }
+
+    __FWK_WORKER_POOL_LOCK();
+    status = hold_event(event, microseconds, periodic);
+    __FWK_WORKER_POOL_UNLOCK();
+    if (status != FWK_SUCCESS)
+        goto error;
+
+    return FWK_SUCCESS;
+
+error:
+    FWK_HOST_PRINT(err_msg_func, status, __func__);
+    return status;
+}
+
+/*
+ * Public interface functions
+ */
+
+int fwk_thread_put_event(struct fwk_event *event)
+{
+    int status;
+
+    if (!ctx.initialized) {
+        status = FWK_E_INIT;
+        goto error;
+    }
+
+    status = check_event(event);
+    if (status != FWK_SUCCESS)
+        goto error;
+
+    __FWK_WORKER_POOL_LOCK();
+    status = put_event(event);
+    __FWK_WORKER_POOL_UNLOCK();
+
+    return status;
+
+error:
+    FWK_HOST_PRINT(err_msg_func, status, __func__);
+    return status;
+}
+
+int fwk_thread_put_event_delayed(struct fwk_event *event,
+                                 uint32_t microseconds)
+{
+    return put_delayed_event(event, microseconds, false);
+}
+
+int fwk_thread_put_event_periodic(struct fwk_event *event,
+                                  uint32_t microseconds)
+{
+    return put_delayed_event(event, microseconds, true);
+}
+
+int fwk_thread_cancel_delayed_event(fwk_id_t target_id, fwk_id_t event_id)
+{
+    int status = FWK_E_STATE;
+    unsigned int interrupt, idx;
+    struct fwk_event *event;
+
+    if (!ctx.initialized) {
+        status = FWK_E_INIT;
+        goto error;
+    }
+
+    if (fwk_interrupt_get_current(&interrupt) == FWK_SUCCESS) {
+        status = FWK_E_ACCESS;
+        goto error;
+    }
+
+    __FWK_WORKER_POOL_LOCK();
+    idx = 0;
+    while (idx < ctx.delayed_event_count) {
+        event = ctx.delayed_event_heap[idx].event;
+        if (!fwk_id_is_equal(event->target_id, target_id) ||
+            !fwk_id_is_equal(event->id, event_id)) {
+            idx++;
+            continue;
+        }
+
+        remove_delayed_event(idx);
+        free_event(event);
+        status = FWK_SUCCESS;
+
+        /* The removal reorders the heap, scan it again from its root */
+        idx = 0;
+    }
+    __FWK_WORKER_POOL_UNLOCK();
+
+    if (status != FWK_SUCCESS)
+        goto error;
+
+    return FWK_SUCCESS;
+
+error:
+    FWK_HOST_PRINT(err_msg_func, status, __func__);
+    return status;
+}
+
+int fwk_thread_set_timer_driver(const struct fwk_thread_timer_driver *driver)
+{
+    int status = FWK_E_PARAM;
+
+    if (!ctx.initialized) {
+        status = FWK_E_INIT;
+        goto error;
+    }
+
+    if ((driver == NULL) || (driver->frequency == 0) ||
+        (driver->get_counter == NULL) || (driver->set_alarm == NULL))
+        goto error;
+
+    if (ctx.timer_driver != NULL) {
+        status = FWK_E_STATE;
+        goto error;
+    }
+
+    ctx.delayed_event_heap = fwk_mm_calloc(ctx.stats.event_count,
+        sizeof(struct __fwk_thread_delayed_event));
+    if (ctx.delayed_event_heap == NULL) {
+        status = FWK_E_NOMEM;
+        goto error;
+    }
+
+    ctx.delayed_event_count = 0;
+    ctx.timer_driver = driver;
+
+    return FWK_SUCCESS;
+
+error:
+    FWK_HOST_PRINT(err_msg_func, status, __func__);
+    return status;
+}
+
+void fwk_thread_signal_timer(void)
+{
+    atomic_store_explicit(&ctx.timer_signaled, true, memory_order_release);
+}
+
+void fwk_thread_begin_exclusive(void)
+{
+    #ifdef BUILD_HAS_WORKER_POOL
+    __fwk_worker_pool_begin_exclusive();
+    #endif
+}
+
+void fwk_thread_end_exclusive(void)
+{
+    #ifdef BUILD_HAS_WORKER_POOL
+    __fwk_worker_pool_end_exclusive();
+    #endif
+}
+
+int fwk_thread_get_stats(struct fwk_thread_stats *stats)
+{
+    int status = FWK_E_PARAM;
+    struct __fwk_thread_isr_event_ring *ring = &ctx.isr_event_ring;
+    struct fwk_thread_queue_stats *isr_queue_stats;
+
+    if (!ctx.initialized) {
+        status = FWK_E_INIT;
+        goto error;
+    }
+
+    if (stats == NULL)
+        goto error;
+
+    __FWK_WORKER_POOL_LOCK();
+    *stats = ctx.stats;
+    __FWK_WORKER_POOL_UNLOCK();
+
+    isr_queue_stats = &stats->isr_event_queue;
+    isr_queue_stats->depth = atomic_load(&ring->head) -
+                             atomic_load(&ring->tail);
+    if (isr_queue_stats->depth > isr_queue_stats->depth_max)
+        isr_queue_stats->depth_max = isr_queue_stats->depth;
+    isr_queue_stats->failed_put_count = atomic_load(&ring->failed_put_count);
+
+    return FWK_SUCCESS;
+
+error:
+    FWK_HOST_PRINT(err_msg_func, status, __func__);
+    return status;
+}
+
+int fwk_thread_alloc_ext_params(struct fwk_event *event, size_t size)
+{
+    int status = FWK_E_PARAM;
+    void *ext_params;
+
+    if (!ctx.initialized) {
+        status = FWK_E_INIT;
+        goto error;
+    }
+
+    if ((event == NULL) || (size == 0) ||
+        (size > FWK_EVENT_EXT_PARAMETERS_SIZE))
+        goto error;
+
+    if (event->ext_params != NULL) {
+        status = FWK_E_STATE;
+        goto error;
+    }
+
+    if (ctx.ext_params_pool == NULL) {
+        status = FWK_E_SUPPORT;
+        goto error;
+    }
+
+    __FWK_WORKER_POOL_LOCK();
+    ext_params = fwk_mm_pool_alloc(ctx.ext_params_pool);
+    __FWK_WORKER_POOL_UNLOCK();
+    if (ext_params == NULL) {
+        status = FWK_E_NOMEM;
+        goto error;
+    }
+
+    event->ext_params = ext_params;
+
+    return FWK_SUCCESS;
+
+error:
+    FWK_HOST_PRINT(err_msg_func, status, __func__);
+    return status;
+}
+
+int fwk_thread_free_ext_params(struct fwk_event *event)
+{
+    int status = FWK_E_PARAM;
+
+    if (!ctx.initialized) {
+        status = FWK_E_INIT;
+        goto error;
     }
 
-    return put_event(event);
+    if (event == NULL)
+        goto error;
+
+    if (event->ext_params == NULL)
+        return FWK_SUCCESS;
+
+    __FWK_WORKER_POOL_LOCK();
+    status = fwk_mm_pool_free(ctx.ext_params_pool, event->ext_params);
+    __FWK_WORKER_POOL_UNLOCK();
+    if (status != FWK_SUCCESS)
+        goto error;
+
+    event->ext_params = NULL;
+
+    return FWK_SUCCESS;
 
 error:
     FWK_HOST_PRINT(err_msg_func, status, __func__);
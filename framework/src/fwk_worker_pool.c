@@ -0,0 +1,395 @@
+/*
+ * Arm SCP/MCP Software
+ * Copyright (c) 2015-2019, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Description:
+ *     Pool of host worker threads processing the events of the modules and
+ *     elements with work stealing.
+ */
+
+/* The recursive mutexes and read-write locks are X/Open extensions */
+#define _XOPEN_SOURCE 700
+
+#include <limits.h>
+#include <pthread.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <time.h>
+#include <unistd.h>
+#include <fwk_assert.h>
+#include <fwk_errno.h>
+#include <fwk_host.h>
+#include <fwk_list.h>
+#include <fwk_mm.h>
+#include <internal/fwk_worker_pool.h>
+
+/* Index of the worker of a thread that is not a worker */
+#define NO_WORKER UINT_MAX
+
+/* Time an idle worker waits for events before polling the ISR events, in ns */
+#define IDLE_WAIT_NS (1000 * 1000)
+
+#define NS_PER_S (1000 * 1000 * 1000)
+
+/* Worker thread */
+struct worker {
+    /* Host thread identifier */
+    pthread_t thread;
+
+    /*
+     * Queue of the entities that are ready to be processed and not busy,
+     * most recently readied first.
+     */
+    struct fwk_dlist ready_queue;
+};
+
+struct worker_pool_ctx {
+    /* Flag indicating whether the worker pool has been initialized */
+    bool initialized;
+
+    /* Number of workers */
+    unsigned int worker_count;
+
+    /* Table of workers */
+    struct worker *worker_table;
+
+    /* Index of the next worker to queue the entities readied by non-workers */
+    unsigned int next_worker_idx;
+
+    /* Recursive lock of the framework state */
+    pthread_mutex_t lock;
+
+    /* Condition signalled when an entity is readied */
+    pthread_cond_t ready_cond;
+
+    /*
+     * Lock serializing the event handlers. The handlers that may run
+     * concurrently take it for reading, the other ones for writing.
+     */
+    pthread_rwlock_t handler_lock;
+
+    /* Function processing an event */
+    void (*process_event)(struct fwk_slist_node *node);
+
+    /* Function moving the ISR events to the event queues */
+    bool (*process_isr)(void);
+};
+
+static struct worker_pool_ctx ctx;
+
+/* Index of the worker the calling thread is */
+static _Thread_local unsigned int current_worker_idx = NO_WORKER;
+
+/* Whether the calling thread runs a handler that may run concurrently */
+static _Thread_local bool handler_concurrent;
+
+/* Nesting depth of the exclusive sections of the calling thread */
+static _Thread_local unsigned int exclusive_depth;
+
+#ifdef BUILD_HOST
+static const char err_msg_func[] = "[WKP] Error %d in %s\n";
+#endif
+
+/*
+ * Static functions
+ */
+
+static unsigned int get_default_worker_count(void)
+{
+    long cpu_count;
+
+    cpu_count = sysconf(_SC_NPROCESSORS_ONLN);
+    if (cpu_count < 1)
+        return 1;
+
+    if (cpu_count > __FWK_WORKER_POOL_WORKER_COUNT_MAX)
+        return __FWK_WORKER_POOL_WORKER_COUNT_MAX;
+
+    return (unsigned int)cpu_count;
+}
+
+static struct fwk_dlist_node *steal_entity(unsigned int worker_idx)
+{
+    unsigned int i;
+    struct fwk_dlist *ready_queue;
+    struct fwk_dlist_node *node;
+
+    for (i = 1; i < ctx.worker_count; i++) {
+        ready_queue = &ctx.worker_table[(worker_idx + i) %
+                                        ctx.worker_count].ready_queue;
+        if (fwk_list_is_empty(ready_queue))
+            continue;
+
+        /* Steal the entity that has been ready for the longest time */
+        node = ready_queue->tail;
+        fwk_list_remove(ready_queue, node);
+
+        return node;
+    }
+
+    return NULL;
+}
+
+static void wait_for_work(void)
+{
+    struct timespec timeout;
+
+    clock_gettime(CLOCK_REALTIME, &timeout);
+    timeout.tv_nsec += IDLE_WAIT_NS;
+    if (timeout.tv_nsec >= NS_PER_S) {
+        timeout.tv_sec++;
+        timeout.tv_nsec -= NS_PER_S;
+    }
+
+    pthread_cond_timedwait(&ctx.ready_cond, &ctx.lock, &timeout);
+}
+
+static noreturn void run_worker(unsigned int worker_idx)
+{
+    struct fwk_slist_node *node;
+    struct __fwk_worker_pool_entity *entity;
+
+    current_worker_idx = worker_idx;
+
+    pthread_mutex_lock(&ctx.lock);
+
+    for (;;) {
+        node = __fwk_worker_pool_get_next(worker_idx, &entity);
+        if (node != NULL) {
+            ctx.process_event(node);
+            __fwk_worker_pool_complete(worker_idx, entity);
+            continue;
+        }
+
+        if (!ctx.process_isr())
+            wait_for_work();
+    }
+}
+
+static void *worker_function(void *arg)
+{
+    run_worker((unsigned int)(uintptr_t)arg);
+}
+
+/*
+ * Private interface functions
+ */
+
+int __fwk_worker_pool_init(unsigned int worker_count)
+{
+    int status;
+    unsigned int worker_idx;
+    pthread_mutexattr_t lock_attr;
+
+    if (worker_count == 0)
+        worker_count = get_default_worker_count();
+
+    ctx.worker_table = fwk_mm_calloc(worker_count, sizeof(struct worker));
+    if (ctx.worker_table == NULL) {
+        status = FWK_E_NOMEM;
+        goto error;
+    }
+
+    for (worker_idx = 0; worker_idx < worker_count; worker_idx++)
+        fwk_list_init(&ctx.worker_table[worker_idx].ready_queue);
+
+    if ((pthread_mutexattr_init(&lock_attr) != 0) ||
+        (pthread_mutexattr_settype(&lock_attr,
+                                   PTHREAD_MUTEX_RECURSIVE) != 0) ||
+        (pthread_mutex_init(&ctx.lock, &lock_attr) != 0) ||
+        (pthread_cond_init(&ctx.ready_cond, NULL) != 0) ||
+        (pthread_rwlock_init(&ctx.handler_lock, NULL) != 0)) {
+        status = FWK_E_OS;
+        goto error;
+    }
+
+    ctx.worker_count = worker_count;
+    ctx.initialized = true;
+
+    return FWK_SUCCESS;
+
+error:
+    FWK_HOST_PRINT(err_msg_func, status, __func__);
+    return status;
+}
+
+void __fwk_worker_pool_init_entity(struct __fwk_worker_pool_entity *entity)
+{
+    fwk_list_init(&entity->event_queue);
+    entity->ready = false;
+    entity->busy = false;
+}
+
+void __fwk_worker_pool_lock(void)
+{
+    if (ctx.initialized)
+        pthread_mutex_lock(&ctx.lock);
+}
+
+void __fwk_worker_pool_unlock(void)
+{
+    if (ctx.initialized)
+        pthread_mutex_unlock(&ctx.lock);
+}
+
+void __fwk_worker_pool_queue(struct __fwk_worker_pool_entity *entity,
+                             struct fwk_slist_node *node)
+{
+    unsigned int worker_idx;
+
+    fwk_list_push_tail(&entity->event_queue, node);
+
+    if (entity->ready || entity->busy)
+        return;
+
+    /*
+     * The entity is readied on the calling worker, where the data the event
+     * was built from is likely to be cached. The entities readied by other
+     * threads are spread over the workers.
+     */
+    worker_idx = current_worker_idx;
+    if (worker_idx == NO_WORKER) {
+        worker_idx = ctx.next_worker_idx;
+        ctx.next_worker_idx = (worker_idx + 1) % ctx.worker_count;
+    }
+
+    fwk_list_push_head(&ctx.worker_table[worker_idx].ready_queue,
+                       &entity->dlist_node);
+    entity->ready = true;
+
+    pthread_cond_signal(&ctx.ready_cond);
+}
+
+struct fwk_slist_node *__fwk_worker_pool_get_next(unsigned int worker_idx,
+    struct __fwk_worker_pool_entity **entity)
+{
+    struct fwk_dlist_node *node;
+    struct __fwk_worker_pool_entity *ready_entity;
+
+    assert(worker_idx < ctx.worker_count);
+
+    node = fwk_list_pop_head(&ctx.worker_table[worker_idx].ready_queue);
+    if (node == NULL) {
+        node = steal_entity(worker_idx);
+        if (node == NULL)
+            return NULL;
+    }
+
+    ready_entity = FWK_LIST_GET(node, struct __fwk_worker_pool_entity,
+                                dlist_node);
+    ready_entity->ready = false;
+    ready_entity->busy = true;
+
+    *entity = ready_entity;
+
+    return fwk_list_pop_head(&ready_entity->event_queue);
+}
+
+void __fwk_worker_pool_complete(unsigned int worker_idx,
+                                struct __fwk_worker_pool_entity *entity)
+{
+    assert(worker_idx < ctx.worker_count);
+
+    entity->busy = false;
+
+    if (fwk_list_is_empty(&entity->event_queue))
+        return;
+
+    fwk_list_push_head(&ctx.worker_table[worker_idx].ready_queue,
+                       &entity->dlist_node);
+    entity->ready = true;
+
+    /* Let an idle worker steal one of the other ready entities */
+    if (fwk_list_next(&ctx.worker_table[worker_idx].ready_queue,
+                      &entity->dlist_node) != NULL)
+        pthread_cond_signal(&ctx.ready_cond);
+}
+
+void __fwk_worker_pool_begin_handler(bool concurrent)
+{
+    pthread_mutex_unlock(&ctx.lock);
+
+    if (concurrent)
+        pthread_rwlock_rdlock(&ctx.handler_lock);
+    else
+        pthread_rwlock_wrlock(&ctx.handler_lock);
+
+    handler_concurrent = concurrent;
+}
+
+void __fwk_worker_pool_end_handler(bool concurrent)
+{
+    (void)concurrent;
+
+    assert(exclusive_depth == 0);
+    handler_concurrent = false;
+
+    pthread_rwlock_unlock(&ctx.handler_lock);
+    pthread_mutex_lock(&ctx.lock);
+}
+
+void __fwk_worker_pool_begin_exclusive(void)
+{
+    /* The handlers that run alone already are exclusive */
+    if (!handler_concurrent)
+        return;
+
+    if (exclusive_depth++ != 0)
+        return;
+
+    /*
+     * The target of the handler stays busy in the meantime, so its events are
+     * still processed one at a time.
+     */
+    pthread_rwlock_unlock(&ctx.handler_lock);
+    pthread_rwlock_wrlock(&ctx.handler_lock);
+}
+
+void __fwk_worker_pool_end_exclusive(void)
+{
+    if (!handler_concurrent)
+        return;
+
+    assert(exclusive_depth != 0);
+    if (--exclusive_depth != 0)
+        return;
+
+    pthread_rwlock_unlock(&ctx.handler_lock);
+    pthread_rwlock_rdlock(&ctx.handler_lock);
+}
+
+noreturn void __fwk_worker_pool_run(
+    void (*process_event)(struct fwk_slist_node *node),
+    bool (*process_isr)(void))
+{
+    unsigned int worker_idx;
+    int status;
+
+    ctx.process_event = process_event;
+    ctx.process_isr = process_isr;
+
+    for (worker_idx = 1; worker_idx < ctx.worker_count; worker_idx++) {
+        status = pthread_create(&ctx.worker_table[worker_idx].thread, NULL,
+                                worker_function,
+                                (void *)(uintptr_t)worker_idx);
+        if (status != 0) {
+            /* The workers already started are enough to process the events */
+            FWK_HOST_PRINT(err_msg_func, FWK_E_OS, __func__);
+            break;
+        }
+    }
+
+    FWK_HOST_PRINT("[WKP] %u workers started\n", worker_idx);
+
+    run_worker(0);
+}
+
+void __fwk_worker_pool_reset(void)
+{
+    ctx = (struct worker_pool_ctx){ 0 };
+    current_worker_idx = NO_WORKER;
+    handler_concurrent = false;
+    exclusive_depth = 0;
+}
@@ -0,0 +1,97 @@
+/*
+ * Arm SCP/MCP Software
+ * Copyright (c) 2015-2019, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <fwk_assert.h>
+#include <fwk_bench.h>
+#include <fwk_errno.h>
+#include <fwk_macros.h>
+#include <fwk_mm.h>
+
+#define HEAP_SIZE (64 * 1024 * 1024)
+#define ALLOC_SIZE 32
+#define ALLOC_COUNT 1000000
+#define POOL_BLOCK_SIZE 64
+#define POOL_BLOCK_COUNT 64
+#define POOL_ROUND_COUNT 100000
+
+extern int fwk_mm_init(uintptr_t start, size_t size);
+
+static void *pool_block_table[POOL_BLOCK_COUNT];
+
+static void bench_fwk_mm_alloc(void)
+{
+    unsigned int i;
+    uint64_t start, time;
+    void *block;
+
+    start = fwk_bench_get_time();
+    for (i = 0; i < ALLOC_COUNT; i++) {
+        block = fwk_mm_alloc(1, ALLOC_SIZE);
+        assert(block != NULL);
+    }
+    time = fwk_bench_get_time() - start;
+
+    fwk_bench_report("alloc_time", time / ALLOC_COUNT, "ns/allocation");
+    fwk_bench_report("alloc_rate", ((uint64_t)ALLOC_COUNT * 1000000000) / time,
+                     "allocations/s");
+}
+
+static void bench_fwk_mm_pool(void)
+{
+    int status;
+    unsigned int round, i;
+    uint64_t start, time, alloc_count;
+    struct fwk_mm_pool *pool;
+
+    pool = fwk_mm_pool_create(POOL_BLOCK_SIZE, POOL_BLOCK_COUNT);
+    assert(pool != NULL);
+
+    start = fwk_bench_get_time();
+    for (round = 0; round < POOL_ROUND_COUNT; round++) {
+        for (i = 0; i < POOL_BLOCK_COUNT; i++) {
+            pool_block_table[i] = fwk_mm_pool_alloc(pool);
+            assert(pool_block_table[i] != NULL);
+        }
+
+        for (i = 0; i < POOL_BLOCK_COUNT; i++) {
+            status = fwk_mm_pool_free(pool, pool_block_table[i]);
+            assert(status == FWK_SUCCESS);
+        }
+    }
+    time = fwk_bench_get_time() - start;
+
+    alloc_count = (uint64_t)POOL_ROUND_COUNT * POOL_BLOCK_COUNT;
+
+    fwk_bench_report("alloc_free_time", time / alloc_count, "ns/allocation");
+    fwk_bench_report("alloc_free_rate", (alloc_count * 1000000000) / time,
+                     "allocations/s");
+}
+
+static int bench_suite_setup(void)
+{
+    void *heap;
+
+    heap = malloc(HEAP_SIZE);
+    if (heap == NULL)
+        return FWK_E_NOMEM;
+
+    return fwk_mm_init((uintptr_t)heap, HEAP_SIZE);
+}
+
+static const struct fwk_bench_case_desc bench_case_table[] = {
+    FWK_BENCH_CASE(bench_fwk_mm_alloc),
+    FWK_BENCH_CASE(bench_fwk_mm_pool),
+};
+
+struct fwk_bench_suite_desc bench_suite = {
+    .name = "fwk_mm",
+    .bench_suite_setup = bench_suite_setup,
+    .bench_case_count = FWK_ARRAY_SIZE(bench_case_table),
+    .bench_case_table = bench_case_table,
+};
@@ -0,0 +1,247 @@
+/*
+ * Arm SCP/MCP Software
+ * Copyright (c) 2015-2019, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <setjmp.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <fwk_assert.h>
+#include <fwk_bench.h>
+#include <fwk_errno.h>
+#include <fwk_id.h>
+#include <fwk_list.h>
+#include <fwk_macros.h>
+#include <fwk_mm.h>
+#include <fwk_notification.h>
+#include <fwk_slist.h>
+#include <internal/fwk_module.h>
+#include <internal/fwk_notification.h>
+#include <internal/fwk_single_thread.h>
+#include <internal/fwk_thread.h>
+
+#define EVENT_COUNT 64
+#define SUBSCRIBER_COUNT_MAX 32
+#define NOTIFY_ITERATIONS 10000
+
+/* Module 0 emits the notification, the elements of module 1 subscribe to it */
+#define MODULE_COUNT 2
+#define SOURCE_MODULE_IDX 0
+#define SUBSCRIBER_MODULE_IDX 1
+
+static struct __fwk_thread_ctx *ctx;
+static struct fwk_module fake_module_desc_table[MODULE_COUNT];
+static struct fwk_module_ctx fake_module_ctx_table[MODULE_COUNT];
+static struct fwk_element_ctx fake_element_ctx_table[SUBSCRIBER_COUNT_MAX];
+static struct fwk_dlist fake_subscription_dlist;
+
+static jmp_buf run_context;
+static unsigned int pending_event_count;
+static bool stop_requested;
+
+/* Mock functions */
+void *__wrap_fwk_mm_calloc(size_t num, size_t size)
+{
+    return calloc(num, size);
+}
+
+/* The notifications of the benchmarks have no out-of-line parameters */
+static struct fwk_mm_pool *fake_ext_params_pool = (struct fwk_mm_pool *)1;
+struct fwk_mm_pool *__wrap_fwk_mm_pool_create(size_t block_size,
+                                              unsigned int block_count)
+{
+    return fake_ext_params_pool;
+}
+
+void *__wrap_fwk_mm_pool_alloc(struct fwk_mm_pool *pool)
+{
+    return NULL;
+}
+
+int __wrap_fwk_mm_pool_free(struct fwk_mm_pool *pool, void *block)
+{
+    return FWK_E_PARAM;
+}
+
+struct fwk_module_ctx *__wrap___fwk_module_get_ctx(fwk_id_t id)
+{
+    return &fake_module_ctx_table[fwk_id_get_module_idx(id)];
+}
+
+struct fwk_element_ctx *__wrap___fwk_module_get_element_ctx(fwk_id_t id)
+{
+    return &fake_element_ctx_table[fwk_id_get_element_idx(id)];
+}
+
+int __wrap___fwk_module_activate(fwk_id_t id)
+{
+    return FWK_SUCCESS;
+}
+
+bool __wrap_fwk_module_is_valid_module_id(fwk_id_t id)
+{
+    return fwk_id_get_module_idx(id) < MODULE_COUNT;
+}
+
+bool __wrap_fwk_module_is_valid_entity_id(fwk_id_t id)
+{
+    return true;
+}
+
+bool __wrap_fwk_module_is_valid_event_id(fwk_id_t id)
+{
+    return true;
+}
+
+bool __wrap_fwk_module_is_valid_notification_id(fwk_id_t id)
+{
+    return true;
+}
+
+/*
+ * Leave the event loop once the last expected notification has been processed
+ * and its storage released.
+ */
+void __real___fwk_slist_push_tail(struct fwk_slist *list,
+                                  struct fwk_slist_node *new);
+void __wrap___fwk_slist_push_tail(struct fwk_slist *list,
+                                  struct fwk_slist_node *new)
+{
+    __real___fwk_slist_push_tail(list, new);
+
+    if (stop_requested &&
+        ((list == &ctx->free_event_queue) ||
+         (list == &ctx->free_notification_handle_queue))) {
+        stop_requested = false;
+        longjmp(run_context, 1);
+    }
+}
+
+static int process_notification(const struct fwk_event *event,
+                                struct fwk_event *resp_event)
+{
+    if (--pending_event_count == 0)
+        stop_requested = true;
+
+    return FWK_SUCCESS;
+}
+
+/* Process events until a given number of them have been processed */
+static void run_events(unsigned int count)
+{
+    pending_event_count = count;
+
+    if (setjmp(run_context) == 0)
+        __fwk_thread_run();
+}
+
+/* Subscribe a given number of elements and freeze the subscriptions */
+static void subscribe(unsigned int subscriber_count)
+{
+    int status;
+    unsigned int i;
+    struct fwk_module_ctx *source_ctx;
+
+    __fwk_notification_reset();
+    status = __fwk_notification_init(subscriber_count);
+    assert(status == FWK_SUCCESS);
+
+    source_ctx = &fake_module_ctx_table[SOURCE_MODULE_IDX];
+    fwk_list_init(&fake_subscription_dlist);
+    source_ctx->subscription_dlist_table = &fake_subscription_dlist;
+    source_ctx->frozen_subscription_table = NULL;
+
+    for (i = 0; i < subscriber_count; i++) {
+        status = fwk_notification_subscribe(
+            FWK_ID_NOTIFICATION(SOURCE_MODULE_IDX, 0),
+            FWK_ID_MODULE(SOURCE_MODULE_IDX),
+            FWK_ID_ELEMENT(SUBSCRIBER_MODULE_IDX, i));
+        assert(status == FWK_SUCCESS);
+    }
+
+    status = __fwk_notification_freeze();
+    assert(status == FWK_SUCCESS);
+}
+
+static void bench_case_setup(void)
+{
+    int status;
+    unsigned int i;
+
+    status = __fwk_thread_init(EVENT_COUNT);
+    assert(status == FWK_SUCCESS);
+
+    ctx = __fwk_thread_get_ctx();
+
+    fake_module_desc_table[SOURCE_MODULE_IDX].notification_count = 1;
+    fake_module_desc_table[SUBSCRIBER_MODULE_IDX].process_notification =
+        process_notification;
+
+    for (i = 0; i < MODULE_COUNT; i++)
+        fake_module_ctx_table[i].desc = &fake_module_desc_table[i];
+
+    fake_module_ctx_table[SUBSCRIBER_MODULE_IDX].element_count =
+        SUBSCRIBER_COUNT_MAX;
+    fake_module_ctx_table[SUBSCRIBER_MODULE_IDX].element_ctx_table =
+        fake_element_ctx_table;
+
+    stop_requested = false;
+}
+
+static void bench_fwk_notification_fan_out(void)
+{
+    int status;
+    unsigned int subscriber_count, i, count;
+    uint64_t start, notify_end, notify_time, process_time;
+    char metric[64];
+    struct fwk_event notification = {
+        .source_id = FWK_ID_MODULE(SOURCE_MODULE_IDX),
+        .id = FWK_ID_NOTIFICATION(SOURCE_MODULE_IDX, 0),
+    };
+
+    for (subscriber_count = 1; subscriber_count <= SUBSCRIBER_COUNT_MAX;
+         subscriber_count *= 2) {
+        subscribe(subscriber_count);
+
+        notify_time = 0;
+        process_time = 0;
+
+        for (i = 0; i < NOTIFY_ITERATIONS; i++) {
+            start = fwk_bench_get_time();
+            status = fwk_notification_notify(&notification, &count);
+            notify_end = fwk_bench_get_time();
+            assert(status == FWK_SUCCESS);
+            assert(count == subscriber_count);
+
+            run_events(subscriber_count);
+
+            notify_time += notify_end - start;
+            process_time += fwk_bench_get_time() - notify_end;
+        }
+
+        snprintf(metric, sizeof(metric), "notify_time_%u_subscribers",
+                 subscriber_count);
+        fwk_bench_report(metric, notify_time / NOTIFY_ITERATIONS,
+                         "ns/notification");
+
+        snprintf(metric, sizeof(metric), "process_time_%u_subscribers",
+                 subscriber_count);
+        fwk_bench_report(metric, process_time / NOTIFY_ITERATIONS,
+                         "ns/notification");
+    }
+}
+
+static const struct fwk_bench_case_desc bench_case_table[] = {
+    FWK_BENCH_CASE(bench_fwk_notification_fan_out),
+};
+
+struct fwk_bench_suite_desc bench_suite = {
+    .name = "fwk_notification",
+    .bench_case_setup = bench_case_setup,
+    .bench_case_count = FWK_ARRAY_SIZE(bench_case_table),
+    .bench_case_table = bench_case_table,
+};
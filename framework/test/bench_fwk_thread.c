@@ -0,0 +1,235 @@
+/*
+ * Arm SCP/MCP Software
+ * Copyright (c) 2015-2019, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <setjmp.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fwk_assert.h>
+#include <fwk_bench.h>
+#include <fwk_errno.h>
+#include <fwk_id.h>
+#include <fwk_macros.h>
+#include <fwk_mm.h>
+#include <fwk_slist.h>
+#include <fwk_thread.h>
+#include <internal/fwk_module.h>
+#include <internal/fwk_single_thread.h>
+#include <internal/fwk_thread.h>
+
+#define EVENT_COUNT 64
+#define BATCH_SIZE 32
+#define BATCH_COUNT 10000
+#define ISR_EVENT_ITERATIONS 100000
+
+static struct __fwk_thread_ctx *ctx;
+static struct fwk_module fake_module_desc;
+static struct fwk_module_ctx fake_module_ctx;
+
+static jmp_buf run_context;
+static unsigned int pending_event_count;
+static bool stop_requested;
+static bool in_isr;
+
+static uint64_t latency_min, latency_max, latency_total;
+
+/* Mock functions */
+void *__wrap_fwk_mm_calloc(size_t num, size_t size)
+{
+    return calloc(num, size);
+}
+
+/* The events of the benchmarks have no out-of-line parameters */
+static struct fwk_mm_pool *fake_ext_params_pool = (struct fwk_mm_pool *)1;
+struct fwk_mm_pool *__wrap_fwk_mm_pool_create(size_t block_size,
+                                              unsigned int block_count)
+{
+    return fake_ext_params_pool;
+}
+
+void *__wrap_fwk_mm_pool_alloc(struct fwk_mm_pool *pool)
+{
+    return NULL;
+}
+
+int __wrap_fwk_mm_pool_free(struct fwk_mm_pool *pool, void *block)
+{
+    return FWK_E_PARAM;
+}
+
+struct fwk_module_ctx *__wrap___fwk_module_get_ctx(fwk_id_t id)
+{
+    return &fake_module_ctx;
+}
+
+int __wrap___fwk_module_activate(fwk_id_t id)
+{
+    return FWK_SUCCESS;
+}
+
+bool __wrap_fwk_module_is_valid_entity_id(fwk_id_t id)
+{
+    return true;
+}
+
+bool __wrap_fwk_module_is_valid_event_id(fwk_id_t id)
+{
+    return true;
+}
+
+int __wrap_fwk_interrupt_get_current(unsigned int *interrupt)
+{
+    return in_isr ? FWK_SUCCESS : FWK_E_STATE;
+}
+
+/*
+ * Leave the event loop once the last expected event has been processed and
+ * its event structure released.
+ */
+void __real___fwk_slist_push_tail(struct fwk_slist *list,
+                                  struct fwk_slist_node *new);
+void __wrap___fwk_slist_push_tail(struct fwk_slist *list,
+                                  struct fwk_slist_node *new)
+{
+    __real___fwk_slist_push_tail(list, new);
+
+    if (stop_requested && (list == &ctx->free_event_queue)) {
+        stop_requested = false;
+        longjmp(run_context, 1);
+    }
+}
+
+static int process_event(const struct fwk_event *event,
+                         struct fwk_event *resp_event)
+{
+    if (--pending_event_count == 0)
+        stop_requested = true;
+
+    return FWK_SUCCESS;
+}
+
+static int process_isr_event(const struct fwk_event *event,
+                             struct fwk_event *resp_event)
+{
+    uint64_t put_time, latency;
+
+    memcpy(&put_time, event->params, sizeof(put_time));
+    latency = fwk_bench_get_time() - put_time;
+
+    if (latency < latency_min)
+        latency_min = latency;
+    if (latency > latency_max)
+        latency_max = latency;
+    latency_total += latency;
+
+    return process_event(event, resp_event);
+}
+
+/* Process events until a given number of them have been processed */
+static void run_events(unsigned int count)
+{
+    pending_event_count = count;
+
+    if (setjmp(run_context) == 0)
+        __fwk_thread_run();
+}
+
+static void bench_case_setup(void)
+{
+    int status;
+
+    status = __fwk_thread_init(EVENT_COUNT);
+    assert(status == FWK_SUCCESS);
+
+    ctx = __fwk_thread_get_ctx();
+
+    fake_module_desc.process_event = process_event;
+    fake_module_ctx.desc = &fake_module_desc;
+    stop_requested = false;
+    in_isr = false;
+}
+
+static void bench_fwk_thread_event_throughput(void)
+{
+    int status;
+    unsigned int batch, i;
+    uint64_t start, put_end, put_time = 0, process_time = 0, event_count;
+    struct fwk_event event = {
+        .source_id = FWK_ID_MODULE(0),
+        .target_id = FWK_ID_MODULE(0),
+        .id = FWK_ID_EVENT(0, 0),
+    };
+
+    for (batch = 0; batch < BATCH_COUNT; batch++) {
+        start = fwk_bench_get_time();
+        for (i = 0; i < BATCH_SIZE; i++) {
+            status = fwk_thread_put_event(&event);
+            assert(status == FWK_SUCCESS);
+        }
+        put_end = fwk_bench_get_time();
+
+        run_events(BATCH_SIZE);
+
+        put_time += put_end - start;
+        process_time += fwk_bench_get_time() - put_end;
+    }
+
+    event_count = (uint64_t)BATCH_COUNT * BATCH_SIZE;
+
+    fwk_bench_report("put_time", put_time / event_count, "ns/event");
+    fwk_bench_report("process_time", process_time / event_count, "ns/event");
+    fwk_bench_report("throughput",
+                     (event_count * 1000000000) / (put_time + process_time),
+                     "events/s");
+}
+
+static void bench_fwk_thread_isr_event_latency(void)
+{
+    int status;
+    unsigned int i;
+    uint64_t put_time;
+    struct fwk_event event = {
+        .source_id = FWK_ID_MODULE(0),
+        .target_id = FWK_ID_MODULE(0),
+        .id = FWK_ID_EVENT(0, 0),
+    };
+
+    fake_module_desc.process_event = process_isr_event;
+    latency_min = UINT64_MAX;
+    latency_max = 0;
+    latency_total = 0;
+
+    for (i = 0; i < ISR_EVENT_ITERATIONS; i++) {
+        put_time = fwk_bench_get_time();
+        memcpy(event.params, &put_time, sizeof(put_time));
+
+        in_isr = true;
+        status = fwk_thread_put_event(&event);
+        in_isr = false;
+        assert(status == FWK_SUCCESS);
+
+        run_events(1);
+    }
+
+    fwk_bench_report("latency_min", latency_min, "ns");
+    fwk_bench_report("latency_mean", latency_total / ISR_EVENT_ITERATIONS,
+                     "ns");
+    fwk_bench_report("latency_max", latency_max, "ns");
+}
+
+static const struct fwk_bench_case_desc bench_case_table[] = {
+    FWK_BENCH_CASE(bench_fwk_thread_event_throughput),
+    FWK_BENCH_CASE(bench_fwk_thread_isr_event_latency),
+};
+
+struct fwk_bench_suite_desc bench_suite = {
+    .name = "fwk_thread",
+    .bench_case_setup = bench_case_setup,
+    .bench_case_count = FWK_ARRAY_SIZE(bench_case_table),
+    .bench_case_table = bench_case_table,
+};
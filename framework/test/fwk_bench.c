@@ -0,0 +1,63 @@
+/*
+ * Arm SCP/MCP Software
+ * Copyright (c) 2015-2019, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/* The monotonic clock is a POSIX extension */
+#define _POSIX_C_SOURCE 199309L
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <fwk_bench.h>
+#include <fwk_errno.h>
+
+/* Benchmark information provided by the benchmark suite */
+extern struct fwk_bench_suite_desc bench_suite;
+
+static const char *current_case_name;
+
+uint64_t fwk_bench_get_time(void)
+{
+    struct timespec time;
+
+    clock_gettime(CLOCK_MONOTONIC, &time);
+
+    return ((uint64_t)time.tv_sec * 1000000000) + (uint64_t)time.tv_nsec;
+}
+
+void fwk_bench_report(const char *metric, uint64_t value, const char *unit)
+{
+    printf("{\"suite\": \"%s\", \"case\": \"%s\", \"metric\": \"%s\", "
+           "\"value\": %" PRIu64 ", \"unit\": \"%s\"}\n",
+           bench_suite.name, current_case_name, metric, value, unit);
+}
+
+int main(void)
+{
+    unsigned int i;
+    const struct fwk_bench_case_desc *bench_case;
+
+    if (bench_suite.bench_suite_setup != NULL) {
+        if (bench_suite.bench_suite_setup() != FWK_SUCCESS) {
+            fprintf(stderr, "Setup of the %s benchmarks failed\n",
+                    bench_suite.name);
+            return EXIT_FAILURE;
+        }
+    }
+
+    for (i = 0; i < bench_suite.bench_case_count; i++) {
+        bench_case = &bench_suite.bench_case_table[i];
+
+        if (bench_suite.bench_case_setup != NULL)
+            bench_suite.bench_case_setup();
+
+        current_case_name = bench_case->name;
+        bench_case->bench_execute();
+    }
+
+    return EXIT_SUCCESS;
+}
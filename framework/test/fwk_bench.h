@@ -0,0 +1,121 @@
+/*
+ * Arm SCP/MCP Software
+ * Copyright (c) 2015-2019, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef FWK_BENCH_H
+#define FWK_BENCH_H
+
+#include <stdint.h>
+
+/*!
+ * \addtogroup GroupLibFramework Framework
+ * @{
+ */
+
+/*!
+ * \defgroup GroupBench Benchmark
+ *
+ * \details The benchmarks run on the host. Each result is printed on its own
+ *      line as a JSON object with the following members:
+ *      - "suite": Name of the benchmark suite.
+ *      - "case": Name of the benchmark case.
+ *      - "metric": Name of the measured quantity.
+ *      - "value": Measured value, an unsigned integer.
+ *      - "unit": Unit of the value.
+ *
+ * @{
+ */
+
+/*!
+ * \brief Define a benchmark case description.
+ *
+ * \param FUNC Benchmark case function name.
+ *
+ * \return A benchmark case description.
+ */
+#define FWK_BENCH_CASE(FUNC) { .name = #FUNC, .bench_execute = FUNC }
+
+/*!
+ * \brief Benchmark case description.
+ */
+struct fwk_bench_case_desc {
+    /*! Benchmark case name */
+    const char *name;
+
+    /*!
+     * \brief Pointer to the benchmark case execution function.
+     *
+     * \details The function reports its results with fwk_bench_report().
+     *
+     * \return None.
+     */
+    void (*bench_execute)(void);
+};
+
+/*!
+ * \brief Benchmark suite description.
+ */
+struct fwk_bench_suite_desc {
+    /*! Benchmark suite name */
+    const char *name;
+
+    /*!
+     * \brief Pointer to a benchmark suite setup function.
+     *
+     * \retval FWK_SUCCESS The benchmark suite environment was successfully set
+     *      up.
+     * \return Any of the other error codes defined by the framework.
+     *
+     * \note May be NULL, in which case the benchmark suite is considered to
+     *      have no setup function. In the event that benchmark suite setup
+     *      fails, the benchmark suite is not executed.
+     */
+    int (*bench_suite_setup)(void);
+
+    /*!
+     * \brief Pointer to a benchmark case setup function.
+     *
+     * \return None.
+     *
+     * \note May be NULL, in which case the benchmark cases are considered to
+     *      have no setup function.
+     */
+    void (*bench_case_setup)(void);
+
+    /*! Number of benchmark cases */
+    unsigned int bench_case_count;
+
+    /*! Pointer to array of benchmark cases */
+    const struct fwk_bench_case_desc *bench_case_table;
+};
+
+/*!
+ * \brief Get the current time of a monotonic host clock.
+ *
+ * \return The current time in nanoseconds.
+ */
+uint64_t fwk_bench_get_time(void);
+
+/*!
+ * \brief Report a result of the running benchmark case.
+ *
+ * \param metric Name of the measured quantity.
+ * \param value Measured value.
+ * \param unit Unit of the value.
+ *
+ * \return None.
+ */
+void fwk_bench_report(const char *metric, uint64_t value, const char *unit);
+
+/*!
+ * @}
+ */
+
+/*!
+ * @}
+ */
+
+#endif /* FWK_BENCH_H */
@@ -13,6 +13,7 @@
 #include <fwk_macros.h>
 #include <fwk_mm.h>
 #include <fwk_test.h>
+#include <internal/fwk_mm.h>
 
 #define SIZE_MEM            (1024 * 1024)
 #define ALLOC_NUM           5
@@ -30,6 +31,8 @@ static void test_fwk_mm_alloc(void);
 static void test_fwk_mm_alloc_aligned(void);
 static void test_fwk_mm_calloc(void);
 static void test_fwk_mm_calloc_aligned(void);
+static void test_fwk_mm_get_stats(void);
+static void test_fwk_mm_pool(void);
 static void test_fwk_mm_lock(void);
 
 static const struct fwk_test_case_desc test_case_table[] = {
@@ -39,6 +42,8 @@ static const struct fwk_test_case_desc test_case_table[] = {
     FWK_TEST_CASE(test_fwk_mm_alloc_aligned),
     FWK_TEST_CASE(test_fwk_mm_calloc),
     FWK_TEST_CASE(test_fwk_mm_calloc_aligned),
+    FWK_TEST_CASE(test_fwk_mm_get_stats),
+    FWK_TEST_CASE(test_fwk_mm_pool),
     FWK_TEST_CASE(test_fwk_mm_lock)
 };
 
@@ -59,6 +64,9 @@ static void test_fwk_mm_alloc_before_init(void)
     size_t num = ALLOC_NUM;
     size_t size = ALLOC_SIZE;
     unsigned int alignment = ALLOC_ALIGN;
+    struct fwk_mm_stats stats;
+
+    assert(fwk_mm_get_stats(&stats) == FWK_E_STATE);
 
     result = fwk_mm_alloc(num, size);
     assert(result == NULL);
@@ -290,9 +298,179 @@ static void test_fwk_mm_calloc_aligned(void)
 
 }
 
+static void test_fwk_mm_get_stats(void)
+{
+    int status;
+    char *result, *aligned_result;
+    uintptr_t heap_free;
+    struct fwk_mm_stats stats, prev_stats;
+    struct fwk_mm_usage usage = { 0 };
+
+    status = fwk_mm_get_stats(NULL);
+    assert(status == FWK_E_PARAM);
+
+    status = fwk_mm_get_stats(&prev_stats);
+    assert(status == FWK_SUCCESS);
+    assert(prev_stats.heap_size == SIZE_MEM);
+    heap_free = (uintptr_t)start + SIZE_MEM - prev_stats.free_size;
+
+    #ifdef BUILD_HAS_MM_ACCOUNTING
+    /* Allocations accounted to an entity */
+    __fwk_mm_set_usage(&usage);
+    #endif
+
+    result = fwk_mm_alloc(1, ALLOC_ODD_SIZE);
+    assert(result != NULL);
+    aligned_result = fwk_mm_alloc_aligned(1, ALLOC_SIZE, ALLOC_ALIGN);
+    assert(aligned_result != NULL);
+
+    #ifdef BUILD_HAS_MM_ACCOUNTING
+    assert(usage.allocated_size == (ALLOC_ODD_SIZE + ALLOC_SIZE));
+    assert(usage.padding_size ==
+           ((uintptr_t)aligned_result - heap_free - ALLOC_ODD_SIZE));
+    assert(usage.alloc_count == 2);
+    #else
+    /* Without accounting, the allocations are only recorded for the heap */
+    assert(usage.alloc_count == 0);
+    usage = (struct fwk_mm_usage) {
+        .allocated_size = ALLOC_ODD_SIZE + ALLOC_SIZE,
+        .padding_size = (uintptr_t)aligned_result - heap_free -
+                        ALLOC_ODD_SIZE,
+        .alloc_count = 2,
+    };
+    #endif
+
+    /* Failed allocations are not accounted to the entity */
+    result = fwk_mm_alloc(1, SIZE_MEM + 1);
+    assert(result == NULL);
+    assert(usage.alloc_count == 2);
+
+    #ifdef BUILD_HAS_MM_ACCOUNTING
+    /* Allocations not accounted to any entity */
+    __fwk_mm_set_usage(NULL);
+    #endif
+
+    result = fwk_mm_calloc(ALLOC_NUM, ALLOC_SIZE);
+    assert(result != NULL);
+    assert(usage.alloc_count == 2);
+
+    status = fwk_mm_get_stats(&stats);
+    assert(status == FWK_SUCCESS);
+    assert(stats.heap_size == SIZE_MEM);
+    assert(stats.free_size == ((uintptr_t)start + SIZE_MEM -
+                               (uintptr_t)result - ALLOC_TOTAL_SIZE));
+    assert(stats.failed_alloc_count == (prev_stats.failed_alloc_count + 1));
+    assert(stats.usage.allocated_size ==
+           (prev_stats.usage.allocated_size + usage.allocated_size +
+            ALLOC_TOTAL_SIZE));
+    assert((stats.usage.padding_size - prev_stats.usage.padding_size) ==
+           ((uintptr_t)result - heap_free - usage.allocated_size));
+    assert(stats.usage.alloc_count == (prev_stats.usage.alloc_count + 3));
+    assert((stats.usage.allocated_size + stats.usage.padding_size +
+            stats.free_size) == SIZE_MEM);
+}
+
+static void test_fwk_mm_pool(void)
+{
+    int status;
+    unsigned int i;
+    struct fwk_mm_pool *pool;
+    struct fwk_mm_pool_stats stats;
+    char *block_table[ALLOC_NUM];
+    char *block;
+
+    /* Bad parameters */
+    pool = fwk_mm_pool_create(0, ALLOC_NUM);
+    assert(pool == NULL);
+
+    pool = fwk_mm_pool_create(ALLOC_ODD_SIZE, 0);
+    assert(pool == NULL);
+
+    pool = fwk_mm_pool_create(SIZE_MAX, ALLOC_NUM);
+    assert(pool == NULL);
+
+    /* Pool of blocks smaller than a pointer */
+    pool = fwk_mm_pool_create(ALLOC_ODD_SIZE, ALLOC_NUM);
+    assert(pool != NULL);
+
+    for (i = 0; i < ALLOC_NUM; i++) {
+        block_table[i] = fwk_mm_pool_alloc(pool);
+        assert(block_table[i] != NULL);
+        assert(((uintptr_t)block_table[i] &
+                (FWK_MM_DEFAULT_ALIGNMENT - 1)) == 0);
+        memset(block_table[i], MEM_PATTERN, ALLOC_ODD_SIZE);
+    }
+
+    /* The blocks do not overlap */
+    for (i = 0; i < (ALLOC_NUM - 1); i++)
+        assert((block_table[i + 1] - block_table[i]) >= ALLOC_ODD_SIZE);
+
+    /* The pool is empty */
+    block = fwk_mm_pool_alloc(pool);
+    assert(block == NULL);
+
+    status = fwk_mm_pool_get_stats(pool, &stats);
+    assert(status == FWK_SUCCESS);
+    assert(stats.block_size == ALLOC_ODD_SIZE);
+    assert(stats.block_count == ALLOC_NUM);
+    assert(stats.used_count == ALLOC_NUM);
+    assert(stats.used_count_max == ALLOC_NUM);
+    assert(stats.failed_alloc_count == 1);
+
+    /* Free blocks that do not belong to the pool */
+    status = fwk_mm_pool_free(pool, NULL);
+    assert(status == FWK_E_PARAM);
+
+    status = fwk_mm_pool_free(pool, block_table[0] + 1);
+    assert(status == FWK_E_PARAM);
+
+    status = fwk_mm_pool_free(pool, block_table[ALLOC_NUM - 1] +
+                              (block_table[1] - block_table[0]));
+    assert(status == FWK_E_PARAM);
+
+    /* Free two blocks, the last freed block is the first reallocated */
+    status = fwk_mm_pool_free(pool, block_table[1]);
+    assert(status == FWK_SUCCESS);
+    status = fwk_mm_pool_free(pool, block_table[3]);
+    assert(status == FWK_SUCCESS);
+
+    /* Double free */
+    status = fwk_mm_pool_free(pool, block_table[3]);
+    assert(status == FWK_E_STATE);
+
+    status = fwk_mm_pool_get_stats(pool, &stats);
+    assert(status == FWK_SUCCESS);
+    assert(stats.used_count == (ALLOC_NUM - 2));
+    assert(stats.used_count_max == ALLOC_NUM);
+
+    block = fwk_mm_pool_alloc(pool);
+    assert(block == block_table[3]);
+    block = fwk_mm_pool_alloc(pool);
+    assert(block == block_table[1]);
+
+    /* Double free with no block allocated */
+    for (i = 0; i < ALLOC_NUM; i++) {
+        status = fwk_mm_pool_free(pool, block_table[i]);
+        assert(status == FWK_SUCCESS);
+    }
+    status = fwk_mm_pool_free(pool, block_table[0]);
+    assert(status == FWK_E_STATE);
+
+    status = fwk_mm_pool_get_stats(pool, &stats);
+    assert(status == FWK_SUCCESS);
+    assert(stats.used_count == 0);
+
+    /* Bad parameters */
+    status = fwk_mm_pool_get_stats(NULL, &stats);
+    assert(status == FWK_E_PARAM);
+    status = fwk_mm_pool_get_stats(pool, NULL);
+    assert(status == FWK_E_PARAM);
+}
+
 static void test_fwk_mm_lock(void)
 {
     void *result;
+    struct fwk_mm_pool *pool, *late_pool;
 
     /*
      * Make sure that memory allocation works properly before the
@@ -310,6 +488,9 @@ static void test_fwk_mm_lock(void)
     result = fwk_mm_calloc_aligned(ALLOC_NUM, ALLOC_SIZE, ALLOC_ALIGN);
     assert(result != NULL);
 
+    pool = fwk_mm_pool_create(ALLOC_SIZE, 1);
+    assert(pool != NULL);
+
     fwk_mm_lock();
 
     /*
@@ -327,4 +508,12 @@ static void test_fwk_mm_lock(void)
 
     result = fwk_mm_calloc_aligned(ALLOC_NUM, ALLOC_SIZE, ALLOC_ALIGN);
     assert(result == NULL);
+
+    late_pool = fwk_mm_pool_create(ALLOC_SIZE, 1);
+    assert(late_pool == NULL);
+
+    /* Pools created before the lock remain usable */
+    result = fwk_mm_pool_alloc(pool);
+    assert(result != NULL);
+    assert(fwk_mm_pool_free(pool, result) == FWK_SUCCESS);
 }
@@ -72,14 +72,16 @@ struct config_module_data {
 static struct config_module_data config_module0;
 static struct config_module_data config_module1;
 
-struct fwk_module *module_table[3];
-struct fwk_module_config *module_config_table[3];
+struct fwk_module *module_table[4];
+struct fwk_module_config *module_config_table[4];
 
 static struct fwk_module fake_module_desc0;
 static struct fwk_module fake_module_desc1;
+static struct fwk_module fake_module_desc2;
 
 static struct fwk_module_config fake_module_config0;
 static struct fwk_module_config fake_module_config1;
+static struct fwk_module_config fake_module_config2;
 
 /* Mock functions */
 static int init_return_val;
@@ -89,6 +91,8 @@ static int bind_return_val;
 static int bind_count_call;
 static int start_return_val;
 static int start_count_call;
+static unsigned int start_module_count;
+static fwk_id_t start_module_id_table[2];
 static int process_bind_request_return_val;
 static bool process_bind_request_return_api;
 static bool get_element_table0_return_val;
@@ -129,7 +133,10 @@ static int bind(fwk_id_t id, unsigned int round_number)
 
 static int start(fwk_id_t id)
 {
-    (void) id;
+    if (fwk_id_is_type(id, FWK_ID_TYPE_MODULE) &&
+        (start_module_count < FWK_ARRAY_SIZE(start_module_id_table)))
+        start_module_id_table[start_module_count++] = id;
+
     start_count_call++;
     return start_return_val;
 }
@@ -179,19 +186,52 @@ static const struct fwk_element *get_element_table1(fwk_id_t module_id)
  * If 2, fwk_mm_calloc(num, size) returns NULL.
  */
 static int fwk_mm_calloc_return;
+
+/* Memory allocated through fwk_mm_calloc(), in total and per entity */
+static struct fwk_mm_usage mm_usage;
+static struct fwk_mm_usage *current_mm_usage;
+
+static void account_mm_calloc(size_t num, size_t size)
+{
+    mm_usage.allocated_size += num * size;
+    mm_usage.alloc_count++;
+
+    if (current_mm_usage != NULL) {
+        current_mm_usage->allocated_size += num * size;
+        current_mm_usage->alloc_count++;
+    }
+}
+
 void * __wrap_fwk_mm_calloc(size_t num, size_t size)
 {
     if (num == 0)
         return NULL;
-    if (fwk_mm_calloc_return == 0)
+    if (fwk_mm_calloc_return == 0) {
+        account_mm_calloc(num, size);
         return calloc(num, size);
-    else if (fwk_mm_calloc_return <= 4) {
+    } else if (fwk_mm_calloc_return <= 4) {
         fwk_mm_calloc_return++;
+        account_mm_calloc(num, size);
         return calloc(num, size);
     }
     return NULL;
 }
 
+void __wrap___fwk_mm_set_usage(struct fwk_mm_usage *usage)
+{
+    current_mm_usage = usage;
+}
+
+int __wrap_fwk_mm_get_stats(struct fwk_mm_stats *stats)
+{
+    *stats = (struct fwk_mm_stats) {
+        .heap_size = mm_usage.allocated_size,
+        .usage = mm_usage,
+    };
+
+    return FWK_SUCCESS;
+}
+
 int __wrap___fwk_thread_init(size_t event_count)
 {
     (void) event_count;
@@ -208,6 +248,11 @@ int __wrap___fwk_notification_init(size_t notification_count)
     return FWK_SUCCESS;
 }
 
+int __wrap___fwk_notification_freeze(void)
+{
+    return FWK_SUCCESS;
+}
+
 static void test_case_setup(void)
 {
     /* Default values */
@@ -226,6 +271,7 @@ static void test_case_setup(void)
 
     bind_count_call = 0;
     start_count_call = 0;
+    start_module_count = 0;
 
     config_elem0.fake_val = 5;
     config_elem0.ref = fwk_id_build_element_id(MODULE0_ID, ELEM0_IDX);
@@ -249,6 +295,7 @@ static void test_case_setup(void)
     fake_module_desc0.post_init = post_init;
     fake_module_desc0.bind = bind;
     fake_module_desc0.start = start;
+    fake_module_desc0.async_start = false;
     fake_module_desc0.process_bind_request = process_bind_request;
 
     fake_module_desc1.name = "FAKE MODULE 1";
@@ -261,6 +308,7 @@ static void test_case_setup(void)
     fake_module_desc1.post_init = post_init;
     fake_module_desc1.bind = bind;
     fake_module_desc1.start = start;
+    fake_module_desc1.async_start = false;
 
     fake_element_desc_table0[0].name = "FAKE ELEM 0";
     fake_element_desc_table0[0].data = &config_elem0;
@@ -277,17 +325,25 @@ static void test_case_setup(void)
 
     fake_module_config0.get_element_table = get_element_table0;
     fake_module_config0.data = &config_module0;
+    fake_module_config0.start_dependency_count = 0;
+    fake_module_config0.start_dependency_table = NULL;
+    fake_module_config0.lazy_element_init = false;
 
     fake_module_config1.get_element_table = get_element_table1;
     fake_module_config1.data = &config_module1;
+    fake_module_config1.start_dependency_count = 0;
+    fake_module_config1.start_dependency_table = NULL;
+    fake_module_config1.lazy_element_init = false;
 
     module_table[0] = &fake_module_desc0;
     module_table[1] = &fake_module_desc1;
     module_table[2] = NULL;
+    module_table[3] = NULL;
 
     module_config_table[0] = &fake_module_config0;
     module_config_table[1] = &fake_module_config1;
     module_config_table[2] = NULL;
+    module_config_table[3] = NULL;
 
     __fwk_module_reset();
     __fwk_module_init();
@@ -624,6 +680,309 @@ static void test___fwk_module_init_succeed(void)
     check_correct_initialization();
 }
 
+static void test___fwk_module_init_start_dependencies(void)
+{
+    int result;
+    enum fwk_module_state state;
+    static const fwk_id_t dependency_table0[] = { MODULE1_ID };
+    static const fwk_id_t dependency_table1[] = { MODULE0_ID };
+    static const fwk_id_t dependency_table2[] = { FWK_ID_MODULE_INIT(2) };
+
+    /* Invalid dependencies */
+    fake_module_config0.start_dependency_count = 1;
+    __fwk_module_reset();
+    result = __fwk_module_init();
+    assert(result == FWK_E_PARAM);
+
+    fake_module_config0.start_dependency_table = dependency_table1;
+    __fwk_module_reset();
+    result = __fwk_module_init();
+    assert(result == FWK_E_PARAM);
+
+    /* Circular dependencies */
+    fake_module_config0.start_dependency_table = dependency_table0;
+    fake_module_config1.start_dependency_count = 1;
+    fake_module_config1.start_dependency_table = dependency_table1;
+    start_count_call = 0;
+    __fwk_module_reset();
+    result = __fwk_module_init();
+    assert(result == FWK_E_PARAM);
+    assert(start_count_call == 0);
+
+    /* Module 0 is started after module 1 */
+    fake_module_config1.start_dependency_count = 0;
+    start_module_count = 0;
+    __fwk_module_reset();
+    result = __fwk_module_init();
+    assert(result == FWK_SUCCESS);
+    assert(start_module_count == 2);
+    assert(fwk_id_is_equal(start_module_id_table[0], MODULE1_ID));
+    assert(fwk_id_is_equal(start_module_id_table[1], MODULE0_ID));
+
+    result = __fwk_module_get_state(MODULE0_ID, &state);
+    assert(result == FWK_SUCCESS);
+    assert(state == FWK_MODULE_STATE_STARTED);
+
+    /*
+     * Circular dependencies between modules 0 and 1, while the asynchronous
+     * start of a third module is in progress.
+     */
+    fake_module_desc2 = (struct fwk_module) {
+        .name = "FAKE MODULE 2",
+        .type = FWK_MODULE_TYPE_SERVICE,
+        .init = init,
+        .async_start = true,
+    };
+    module_table[2] = &fake_module_desc2;
+    module_config_table[2] = &fake_module_config2;
+    fake_module_config1.start_dependency_count = 1;
+    __fwk_module_reset();
+    result = __fwk_module_init();
+    assert(result == FWK_E_PARAM);
+
+    /* Module 0 only waits for the third module */
+    fake_module_config0.start_dependency_table = dependency_table2;
+    fake_module_config1.start_dependency_count = 0;
+    start_module_count = 0;
+    __fwk_module_reset();
+    result = __fwk_module_init();
+    assert(result == FWK_SUCCESS);
+    assert(start_module_count == 1);
+
+    result = fwk_module_start_complete(FWK_ID_MODULE(2));
+    assert(result == FWK_SUCCESS);
+    assert(start_module_count == 2);
+    assert(fwk_id_is_equal(start_module_id_table[1], MODULE0_ID));
+}
+
+static void test_fwk_module_start_complete(void)
+{
+    int result;
+    enum fwk_module_state state;
+    static const fwk_id_t dependency_table0[] = { MODULE1_ID };
+
+    /* Module 0 waits for the asynchronous start of module 1 */
+    fake_module_desc1.async_start = true;
+    fake_module_config0.start_dependency_count = 1;
+    fake_module_config0.start_dependency_table = dependency_table0;
+    start_module_count = 0;
+    __fwk_module_reset();
+    result = __fwk_module_init();
+    assert(result == FWK_SUCCESS);
+    assert(start_module_count == 1);
+
+    result = __fwk_module_get_state(MODULE1_ID, &state);
+    assert(result == FWK_SUCCESS);
+    assert(state == FWK_MODULE_STATE_BOUND);
+
+    result = __fwk_module_get_state(ELEM2_ID, &state);
+    assert(result == FWK_SUCCESS);
+    assert(state == FWK_MODULE_STATE_STARTED);
+
+    result = __fwk_module_get_state(MODULE0_ID, &state);
+    assert(result == FWK_SUCCESS);
+    assert(state == FWK_MODULE_STATE_BOUND);
+
+    /* Invalid identifier and module without start in progress */
+    result = fwk_module_start_complete(ELEM2_ID);
+    assert(result == FWK_E_PARAM);
+
+    result = fwk_module_start_complete(MODULE0_ID);
+    assert(result == FWK_E_STATE);
+
+    /* Completing the start of module 1 starts module 0 */
+    result = fwk_module_start_complete(MODULE1_ID);
+    assert(result == FWK_SUCCESS);
+    assert(start_module_count == 2);
+    assert(fwk_id_is_equal(start_module_id_table[1], MODULE0_ID));
+
+    result = __fwk_module_get_state(MODULE1_ID, &state);
+    assert(result == FWK_SUCCESS);
+    assert(state == FWK_MODULE_STATE_STARTED);
+
+    result = __fwk_module_get_state(MODULE0_ID, &state);
+    assert(result == FWK_SUCCESS);
+    assert(state == FWK_MODULE_STATE_STARTED);
+
+    result = __fwk_module_get_state(ELEM1_ID, &state);
+    assert(result == FWK_SUCCESS);
+    assert(state == FWK_MODULE_STATE_STARTED);
+
+    result = fwk_module_start_complete(MODULE1_ID);
+    assert(result == FWK_E_STATE);
+}
+
+static void test_fwk_module_lazy_element_init(void)
+{
+    int result;
+    enum fwk_module_state state;
+    #ifdef BUILD_HAS_MM_ACCOUNTING
+    struct fwk_mm_usage usage;
+    #endif
+
+    /* The elements of module 0 are not initialized */
+    fake_module_config0.lazy_element_init = true;
+    __fwk_module_reset();
+    result = __fwk_module_init();
+    assert(result == FWK_SUCCESS);
+
+    result = __fwk_module_get_state(ELEM0_ID, &state);
+    assert(result == FWK_SUCCESS);
+    assert(state == FWK_MODULE_STATE_UNINITIALIZED);
+
+    #ifdef BUILD_HAS_MM_ACCOUNTING
+    result = fwk_module_get_mm_usage(ELEM0_ID, &usage);
+    assert(result == FWK_SUCCESS);
+    assert(usage.alloc_count == 0);
+    #endif
+
+    result = __fwk_module_get_state(ELEM2_ID, &state);
+    assert(result == FWK_SUCCESS);
+    assert(state == FWK_MODULE_STATE_STARTED);
+
+    /* Invalid identifier */
+    result = fwk_module_activate_element(MODULE0_ID);
+    assert(result == FWK_E_PARAM);
+
+    /* The activation takes the element through all the stages */
+    bind_count_call = 0;
+    start_count_call = 0;
+    result = fwk_module_activate_element(SUB_ELEM0_ID);
+    assert(result == FWK_SUCCESS);
+    assert(bind_count_call == 2);
+    assert(start_count_call == 1);
+
+    result = __fwk_module_get_state(ELEM0_ID, &state);
+    assert(result == FWK_SUCCESS);
+    assert(state == FWK_MODULE_STATE_STARTED);
+
+    #ifdef BUILD_HAS_MM_ACCOUNTING
+    result = fwk_module_get_mm_usage(ELEM0_ID, &usage);
+    assert(result == FWK_SUCCESS);
+    assert(usage.alloc_count == 1);
+    #endif
+    assert(current_mm_usage == NULL);
+
+    result = fwk_module_check_call(ELEM0_ID);
+    assert(result == FWK_SUCCESS);
+
+    /* An active element is not activated again */
+    result = fwk_module_activate_element(ELEM0_ID);
+    assert(result == FWK_SUCCESS);
+    assert(bind_count_call == 2);
+    assert(start_count_call == 1);
+
+    result = __fwk_module_get_state(ELEM1_ID, &state);
+    assert(result == FWK_SUCCESS);
+    assert(state == FWK_MODULE_STATE_UNINITIALIZED);
+
+    /* Elements of modules initializing their elements at boot */
+    result = fwk_module_activate_element(ELEM2_ID);
+    assert(result == FWK_SUCCESS);
+    assert(start_count_call == 1);
+}
+
+static void test_fwk_module_lazy_element_bind(void)
+{
+    int result;
+    enum fwk_module_state state;
+    struct fake_api *api;
+
+    /* The framework component is forced into the bind stage */
+    fake_module_config0.lazy_element_init = true;
+    bind_return_val = FWK_E_PARAM;
+    __fwk_module_reset();
+    result = __fwk_module_init();
+    assert(result == FWK_E_PARAM);
+    bind_return_val = FWK_SUCCESS;
+
+    /* Binding to an element that is not active yet activates it */
+    bind_count_call = 0;
+    result = fwk_module_bind(ELEM1_ID, API1_ID, &api);
+    assert(result == FWK_SUCCESS);
+    assert(bind_count_call == 2);
+
+    result = __fwk_module_get_state(ELEM1_ID, &state);
+    assert(result == FWK_SUCCESS);
+    assert(state == FWK_MODULE_STATE_BOUND);
+
+    result = __fwk_module_get_state(ELEM0_ID, &state);
+    assert(result == FWK_SUCCESS);
+    assert(state == FWK_MODULE_STATE_UNINITIALIZED);
+
+    /* The element initialization fails */
+    element_init_return_val = FWK_E_DEVICE;
+    result = fwk_module_bind(ELEM0_ID, API1_ID, &api);
+    assert(result == FWK_E_DEVICE);
+
+    result = __fwk_module_get_state(ELEM0_ID, &state);
+    assert(result == FWK_SUCCESS);
+    assert(state == FWK_MODULE_STATE_UNINITIALIZED);
+}
+
+static void test_fwk_module_get_mm_usage(void)
+{
+    int result;
+    size_t dlist_table_size;
+    struct fwk_mm_usage usage;
+
+    dlist_table_size = fake_module_desc0.notification_count *
+                       sizeof(struct fwk_dlist);
+
+    /* Only the module and element handlers allocations are accounted */
+    mm_usage = (struct fwk_mm_usage){ 0 };
+    __fwk_module_reset();
+    result = __fwk_module_init();
+    assert(result == FWK_SUCCESS);
+    assert(current_mm_usage == NULL);
+
+    /*
+     * The table of module contexts and the map of callable entities are
+     * accounted to the framework only.
+     */
+    assert(mm_usage.allocated_size ==
+           ((3 * dlist_table_size) + (3 * sizeof(struct fwk_element_ctx)) +
+            (2 * sizeof(struct fwk_module_ctx)) + (3 * sizeof(unsigned int)) +
+            sizeof(uint32_t)));
+
+    #ifdef BUILD_HAS_MM_ACCOUNTING
+    /* Element 0 of module 0, its notification subscription lists */
+    result = fwk_module_get_mm_usage(ELEM0_ID, &usage);
+    assert(result == FWK_SUCCESS);
+    assert(usage.allocated_size == dlist_table_size);
+    assert(usage.padding_size == 0);
+    assert(usage.alloc_count == 1);
+
+    /*
+     * Module 0, its notification subscription lists, its table of element
+     * contexts and the memory allocated for its two elements.
+     */
+    result = fwk_module_get_mm_usage(MODULE0_ID, &usage);
+    assert(result == FWK_SUCCESS);
+    assert(usage.allocated_size == ((3 * dlist_table_size) +
+                                    (2 * sizeof(struct fwk_element_ctx))));
+    assert(usage.alloc_count == 4);
+
+    /* Module 1, its table of element contexts */
+    result = fwk_module_get_mm_usage(MODULE1_ID, &usage);
+    assert(result == FWK_SUCCESS);
+    assert(usage.allocated_size == sizeof(struct fwk_element_ctx));
+    assert(usage.alloc_count == 1);
+
+    /* Bad parameters */
+    result = fwk_module_get_mm_usage(MODULE0_ID, NULL);
+    assert(result == FWK_E_PARAM);
+    result = fwk_module_get_mm_usage(API0_ID, &usage);
+    assert(result == FWK_E_PARAM);
+    result = fwk_module_get_mm_usage(SUB_ELEM0_ID, &usage);
+    assert(result == FWK_E_PARAM);
+    #else
+    /* The memory allocated on behalf of the entities is not recorded */
+    result = fwk_module_get_mm_usage(ELEM0_ID, &usage);
+    assert(result == FWK_E_SUPPORT);
+    #endif
+}
+
 static void test___fwk_module_get_state(void)
 {
     int result;
@@ -1021,6 +1380,23 @@ static void test_fwk_module_check_call_succeed(void)
     id = ELEM0_ID;
     result = fwk_module_check_call(id);
     assert(result == FWK_SUCCESS);
+
+    id = ELEM2_ID;
+    result = fwk_module_check_call(id);
+    assert(result == FWK_SUCCESS);
+
+    id = SUB_ELEM0_ID;
+    result = fwk_module_check_call(id);
+    assert(result == FWK_SUCCESS);
+
+    /* Invalid element and sub-element of a valid module */
+    id = FWK_ID_ELEMENT(MODULE0_IDX, 0x02);
+    result = fwk_module_check_call(id);
+    assert(result == FWK_E_PARAM);
+
+    id = FWK_ID_SUB_ELEMENT(MODULE0_IDX, ELEM0_IDX, 0x01);
+    result = fwk_module_check_call(id);
+    assert(result == FWK_E_PARAM);
 }
 
 static void test_fwk_module_bind_stage_failure(void)
@@ -1130,6 +1506,11 @@ static const struct fwk_test_case_desc test_case_table[] = {
     FWK_TEST_CASE(test___fwk_module_init_start_failure),
     FWK_TEST_CASE(test_fwk_thread_failure),
     FWK_TEST_CASE(test___fwk_module_init_succeed),
+    FWK_TEST_CASE(test___fwk_module_init_start_dependencies),
+    FWK_TEST_CASE(test_fwk_module_start_complete),
+    FWK_TEST_CASE(test_fwk_module_lazy_element_init),
+    FWK_TEST_CASE(test_fwk_module_lazy_element_bind),
+    FWK_TEST_CASE(test_fwk_module_get_mm_usage),
     FWK_TEST_CASE(test___fwk_module_get_state),
     FWK_TEST_CASE(test_fwk_module_is_valid_module_id),
     FWK_TEST_CASE(test_fwk_module_is_valid_element_id),
@@ -225,6 +225,36 @@ int __wrap___fwk_module_get_state(fwk_id_t id, enum fwk_module_state *state)
     return FWK_SUCCESS;
 }
 
+/* Fake timer counting microseconds */
+static uint64_t fake_timer_counter;
+static uint64_t fake_timer_alarm;
+static int fake_timer_get_counter(uint64_t *counter)
+{
+    *counter = fake_timer_counter;
+    return FWK_SUCCESS;
+}
+
+static int fake_timer_set_alarm(uint64_t timestamp)
+{
+    fake_timer_alarm = timestamp;
+    return FWK_SUCCESS;
+}
+
+static const struct fwk_thread_timer_driver fake_timer_driver = {
+    .frequency = 1000000,
+    .get_counter = fake_timer_get_counter,
+    .set_alarm = fake_timer_set_alarm,
+};
+
+static struct __fwk_thread_delayed_event delayed_event_heap[2];
+
+static int module_activate_return_val;
+int __wrap___fwk_module_activate(fwk_id_t id)
+{
+    (void) id;
+    return module_activate_return_val;
+}
+
 static int test_suite_setup(void)
 {
     int status;
@@ -247,6 +277,7 @@ static void test_case_setup(void)
     event[0].is_response = false;
     event[0].response_requested = false;
     event[0].is_thread_wakeup_event = false;
+    event[0].coalesce = false;
     event[0].id = FWK_ID_EVENT(2, 7);
 
     event[1].slist_node = slist_node[1];
@@ -256,6 +287,7 @@ static void test_case_setup(void)
     event[1].is_response = false;
     event[1].response_requested = false;
     event[1].is_thread_wakeup_event = false;
+    event[1].coalesce = false;
     event[1].id = FWK_ID_EVENT(4, 8);
 
     event[2].slist_node = slist_node[2];
@@ -296,6 +328,7 @@ static void test_case_setup(void)
     fwk_interrupt_get_current_return_val = FWK_SUCCESS;
 
     process_event_call_count = 0;
+    module_activate_return_val = FWK_SUCCESS;
     process_event_event_to_put = NULL;
     process_notification_call_count = 0;
     process_event_delay_response = false;
@@ -318,6 +351,12 @@ static void test_case_setup(void)
 
     ctx->waiting_for_isr_event = false;
     ctx->event_cookie_counter = 0;
+    ctx->timer_driver = &fake_timer_driver;
+    ctx->delayed_event_heap = delayed_event_heap;
+    ctx->delayed_event_count = 0;
+    ctx->timer_signaled = false;
+    fake_timer_counter = 0;
+    fake_timer_alarm = UINT64_MAX;
     fwk_list_init(&ctx->event_free_queue);
     fwk_list_init(&ctx->thread_ready_queue);
     fwk_list_init(&ctx->event_isr_queue);
@@ -585,6 +624,116 @@ static void test_get_next_isr_event_6(void)
     assert(ctx->event_cookie_counter == 8);
 }
 
+static void test_get_next_isr_event_7(void)
+{
+    /*
+     * Test of get_next_isr_event() when:
+     * 1) there is an event in the ISR queue that may be coalesced
+     * 2) the thread target of the event is waiting for the processing
+     *    completion of an event.
+     * 3) an event the ISR event can be coalesced with is awaiting processing
+     *    in the queue of the thread.
+     *
+     * The ISR event is coalesced with the pending event and released. The
+     * execution proceeds to wait for an ISR event where the execution is
+     * stopped.
+     */
+    struct fwk_event response_event;
+    unsigned int coalesced_event_count;
+
+    ctx->event_cookie_counter = 7;
+    coalesced_event_count = ctx->stats.coalesced_event_count;
+
+    event[1].cookie = 3;
+    event[1].coalesce = true;
+    event[1].target_id = event[0].target_id;
+    event[1].id = event[0].id;
+    fwk_list_push_tail(&fake_thread_module_ctx.event_queue,
+                       &event[1].slist_node);
+
+    event[0].coalesce = true;
+    memset(event[0].params, 0x5A, sizeof(event[0].params));
+    fwk_list_push_tail(&ctx->event_isr_queue, &event[0].slist_node);
+
+    response_event.cookie = 4;
+    fake_thread_module_ctx.response_event = &response_event;
+    fake_thread_module_ctx.waiting_event_processing_completion = true;
+
+    osThreadFlagsWait_break = 1;
+    if (setjmp(test_context) == FWK_SUCCESS)
+        common_thread_function(NULL);
+
+    assert(process_event_call_count == 0);
+
+    assert(osThreadFlagsWait_param_flags[0] == SIGNAL_ISR_EVENT);
+    assert(osThreadFlagsSet_call_count == 0);
+
+    assert(ctx->event_free_queue.head == &event[0].slist_node);
+    assert(ctx->event_free_queue.tail == &event[0].slist_node);
+    assert(fwk_list_is_empty(&ctx->thread_ready_queue));
+    assert(fwk_list_is_empty(&ctx->event_isr_queue));
+    assert(fake_thread_module_ctx.event_queue.head == &event[1].slist_node);
+    assert(fake_thread_module_ctx.event_queue.tail == &event[1].slist_node);
+
+    assert(fwk_id_is_equal(event[1].source_id, event[0].source_id));
+    assert(!memcmp(event[1].params, event[0].params,
+                   sizeof(event[1].params)));
+    assert(event[1].cookie == 3);
+    assert(ctx->stats.coalesced_event_count == (coalesced_event_count + 1));
+
+    assert(ctx->waiting_for_isr_event == true);
+    assert(ctx->event_cookie_counter == 7);
+}
+
+static void test_get_next_isr_event_8(void)
+{
+    /*
+     * Test of get_next_isr_event() when:
+     * 1) the alarm of the timer has expired
+     * 2) one of the two delayed events is due
+     * 3) the thread target of the event is not waiting for the processing
+     *    completion of an event.
+     *
+     * The due event is removed from the heap of delayed events and put into
+     * the thread event queue. The alarm is set for the other event. The thread
+     * is put into the queue of the ready to process an event thread. The
+     * execution proceeds to wait for the SIGNAL_EVENT_TO_PROCESS or
+     * SIGNAL_NO_READY_THREAD signal.
+     */
+    delayed_event_heap[0] = (struct __fwk_thread_delayed_event) {
+        .timestamp = 10,
+        .event = &event[0],
+    };
+    delayed_event_heap[1] = (struct __fwk_thread_delayed_event) {
+        .timestamp = 30,
+        .event = &event[1],
+    };
+    ctx->delayed_event_count = 2;
+    fake_timer_counter = 20;
+    fwk_thread_signal_timer();
+
+    osThreadFlagsWait_break = 1;
+    if (setjmp(test_context) == FWK_SUCCESS)
+        common_thread_function(NULL);
+
+    assert(process_event_call_count == 0);
+
+    assert(osThreadFlagsWait_param_flags[0] == (SIGNAL_EVENT_TO_PROCESS |
+                                                SIGNAL_NO_READY_THREAD));
+
+    assert(osThreadFlagsSet_call_count == 1);
+    assert(osThreadFlagsSet_param_flags[0] == SIGNAL_EVENT_TO_PROCESS);
+    assert(osThreadFlagsSet_param_thread_id[0] ==
+        (osThreadId_t)MODULE_THREAD_ID);
+
+    assert(fake_thread_module_ctx.event_queue.head == &event[0].slist_node);
+    assert(ctx->delayed_event_count == 1);
+    assert(delayed_event_heap[0].event == &event[1]);
+    assert(fake_timer_alarm == 30);
+    assert(ctx->timer_signaled == false);
+    assert(ctx->event_cookie_counter == 1);
+}
+
 static void test_launch_next_event_processing_1(void)
 {
     /*
@@ -1502,6 +1651,32 @@ static void test_process_next_thread_event_5(void)
     assert(ctx->waiting_for_isr_event == true);
 }
 
+static void test_process_next_thread_event_6(void)
+{
+    /*
+     * Test of process_next_thread_event() with an event targeting an element
+     * initialized lazily, the activation of which fails.
+     *
+     * 1) The event is not processed and is released.
+     * 2) The execution proceeds to wait for an ISR event.
+     */
+    module_activate_return_val = FWK_E_INIT;
+    fwk_list_push_tail(&ctx->thread_ready_queue,
+        &ctx->common_thread_ctx.slist_node);
+    fwk_list_push_tail(&ctx->common_thread_ctx.event_queue,
+        &event[0].slist_node);
+    osThreadFlagsWait_break = 1;
+    if (setjmp(test_context) == FWK_SUCCESS)
+        common_thread_function(NULL);
+
+    assert(process_event_call_count == 0);
+    assert(process_notification_call_count == 0);
+    assert(osThreadFlagsWait_param_flags[0] == SIGNAL_ISR_EVENT);
+
+    assert(ctx->event_free_queue.head == &event[0].slist_node);
+    assert(fwk_list_is_empty(&ctx->common_thread_ctx.event_queue));
+}
+
 static const struct fwk_test_case_desc test_case_table[] = {
     FWK_TEST_CASE(test_get_next_isr_event_1),
     FWK_TEST_CASE(test_get_next_isr_event_2),
@@ -1509,6 +1684,8 @@ static const struct fwk_test_case_desc test_case_table[] = {
     FWK_TEST_CASE(test_get_next_isr_event_4),
     FWK_TEST_CASE(test_get_next_isr_event_5),
     FWK_TEST_CASE(test_get_next_isr_event_6),
+    FWK_TEST_CASE(test_get_next_isr_event_7),
+    FWK_TEST_CASE(test_get_next_isr_event_8),
     FWK_TEST_CASE(test_launch_next_event_processing_1),
     FWK_TEST_CASE(test_launch_next_event_processing_2),
     FWK_TEST_CASE(test_launch_next_event_processing_3),
@@ -1529,6 +1706,7 @@ static const struct fwk_test_case_desc test_case_table[] = {
     FWK_TEST_CASE(test_process_next_thread_event_3),
     FWK_TEST_CASE(test_process_next_thread_event_4),
     FWK_TEST_CASE(test_process_next_thread_event_5),
+    FWK_TEST_CASE(test_process_next_thread_event_6),
 };
 
 struct fwk_test_suite_desc test_suite = {
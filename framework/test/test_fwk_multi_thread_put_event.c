@@ -195,6 +195,12 @@ int __wrap___fwk_module_get_state(fwk_id_t id, enum fwk_module_state *state)
     return FWK_SUCCESS;
 }
 
+int __wrap___fwk_module_activate(fwk_id_t id)
+{
+    (void) id;
+    return FWK_SUCCESS;
+}
+
 static int test_suite_setup(void)
 {
     int status;
@@ -15,6 +15,7 @@
 #include <fwk_list.h>
 #include <fwk_macros.h>
 #include <fwk_test.h>
+#include <fwk_thread.h>
 #include <internal/fwk_id.h>
 #include <internal/fwk_module.h>
 #include <internal/fwk_multi_thread.h>
@@ -94,6 +95,38 @@ void *__wrap_fwk_mm_calloc(size_t num, size_t size)
     return fwk_mm_calloc_val;
 }
 
+/* Fake pool of a single out-of-line parameter block */
+static struct fwk_mm_pool *fake_ext_params_pool = (struct fwk_mm_pool *)1;
+static uint8_t fake_ext_params_block[FWK_EVENT_EXT_PARAMETERS_SIZE];
+static bool fake_ext_params_block_used;
+struct fwk_mm_pool *__wrap_fwk_mm_pool_create(size_t block_size,
+                                              unsigned int block_count)
+{
+    return fake_ext_params_pool;
+}
+
+void *__wrap_fwk_mm_pool_alloc(struct fwk_mm_pool *pool)
+{
+    assert(pool == fake_ext_params_pool);
+
+    if (fake_ext_params_block_used)
+        return NULL;
+
+    fake_ext_params_block_used = true;
+    return fake_ext_params_block;
+}
+
+int __wrap_fwk_mm_pool_free(struct fwk_mm_pool *pool, void *block)
+{
+    assert(pool == fake_ext_params_pool);
+
+    if ((block != fake_ext_params_block) || !fake_ext_params_block_used)
+        return FWK_E_PARAM;
+
+    fake_ext_params_block_used = false;
+    return FWK_SUCCESS;
+}
+
 int __wrap_fwk_interrupt_global_disable(void)
 {
     return 0;
@@ -104,6 +137,26 @@ int __wrap_fwk_interrupt_global_enable(void)
     return 0;
 }
 
+/* Fake timer counting microseconds */
+static uint64_t fake_timer_alarm;
+static int fake_timer_get_counter(uint64_t *counter)
+{
+    *counter = 0;
+    return FWK_SUCCESS;
+}
+
+static int fake_timer_set_alarm(uint64_t timestamp)
+{
+    fake_timer_alarm = timestamp;
+    return FWK_SUCCESS;
+}
+
+static const struct fwk_thread_timer_driver fake_timer_driver = {
+    .frequency = 1000000,
+    .get_counter = fake_timer_get_counter,
+    .set_alarm = fake_timer_set_alarm,
+};
+
 static bool fwk_module_is_valid_element_id_return_val;
 bool __wrap_fwk_module_is_valid_element_id(fwk_id_t id)
 {
@@ -150,6 +203,12 @@ int __wrap___fwk_module_get_state(fwk_id_t id, enum fwk_module_state *state)
     return FWK_SUCCESS;
 }
 
+int __wrap___fwk_module_activate(fwk_id_t id)
+{
+    (void) id;
+    return FWK_SUCCESS;
+}
+
 static struct __fwk_multi_thread_ctx *ctx;
 
 static int test_suite_setup(void)
@@ -284,6 +343,102 @@ static void test_put_event_waiting_on_completion(void)
     assert(fwk_list_is_empty(&ctx->event_free_queue));
 }
 
+static void test_thread_ext_params(void)
+{
+    int status;
+
+    fwk_interrupt_get_current_return_val = FWK_E_STATE;
+    fake_module_ctx.thread_ctx->waiting_event_processing_completion = false;
+
+    #ifdef BUILD_EVENT_EXT_PARAMS_COUNT
+    status = fwk_thread_alloc_ext_params(&event[0], 8);
+    assert(status == FWK_SUCCESS);
+    assert(event[0].ext_params == fake_ext_params_block);
+
+    /* No block left */
+    status = fwk_thread_alloc_ext_params(&event[2], 8);
+    assert(status == FWK_E_NOMEM);
+
+    /* The block is passed along with the event */
+    event[0].coalesce = true;
+    fwk_list_push_tail(&ctx->event_free_queue, &event[1].slist_node);
+    status = fwk_thread_put_event(&event[0]);
+    assert(status == FWK_SUCCESS);
+    assert(event[1].ext_params == fake_ext_params_block);
+    assert(fake_ext_params_block_used);
+
+    /* An event coalesced with the pending one releases its block */
+    event[0].ext_params = NULL;
+    status = fwk_thread_put_event(&event[0]);
+    assert(status == FWK_SUCCESS);
+    assert(event[1].ext_params == NULL);
+    assert(!fake_ext_params_block_used);
+    event[0].coalesce = false;
+    #else
+    status = fwk_thread_alloc_ext_params(&event[0], 8);
+    assert(status == FWK_E_SUPPORT);
+    assert(event[0].ext_params == NULL);
+    #endif
+
+    status = fwk_thread_free_ext_params(&event[0]);
+    assert(status == FWK_SUCCESS);
+}
+
+static void test_thread_put_event_delayed(void)
+{
+    int status;
+
+    fwk_interrupt_get_current_return_val = FWK_E_STATE;
+    fake_module_ctx.thread_ctx->waiting_event_processing_completion = false;
+
+    /* No timer driver */
+    status = fwk_thread_put_event_delayed(&event[0], 100);
+    assert(status == FWK_E_SUPPORT);
+
+    status = fwk_thread_set_timer_driver(&fake_timer_driver);
+    assert(status == FWK_SUCCESS);
+    status = fwk_thread_set_timer_driver(&fake_timer_driver);
+    assert(status == FWK_E_STATE);
+
+    /* Called from an ISR */
+    fwk_interrupt_get_current_return_val = FWK_SUCCESS;
+    status = fwk_thread_put_event_delayed(&event[0], 100);
+    assert(status == FWK_E_ACCESS);
+    fwk_interrupt_get_current_return_val = FWK_E_STATE;
+
+    fwk_list_push_tail(&ctx->event_free_queue, &event[1].slist_node);
+    fwk_list_push_tail(&ctx->event_free_queue, &event[2].slist_node);
+
+    event[0].params[0] = 1;
+    status = fwk_thread_put_event_delayed(&event[0], 100);
+    assert(status == FWK_SUCCESS);
+    assert(fake_timer_alarm == 100);
+
+    event[0].params[0] = 2;
+    status = fwk_thread_put_event_delayed(&event[0], 50);
+    assert(status == FWK_SUCCESS);
+    assert(fake_timer_alarm == 50);
+
+    /* The events are held, not queued */
+    assert(fwk_list_is_empty(&fake_thread_module_ctx.event_queue));
+    assert(fwk_list_is_empty(&ctx->thread_ready_queue));
+    assert(fwk_list_is_empty(&ctx->event_free_queue));
+    assert(ctx->delayed_event_count == 2);
+    assert(ctx->delayed_event_heap[0].event == &event[2]);
+    assert(event[2].params[0] == 2);
+
+    /* Periodic events need a period */
+    status = fwk_thread_put_event_periodic(&event[0], 0);
+    assert(status == FWK_E_PARAM);
+
+    status = fwk_thread_cancel_delayed_event(event[0].target_id, event[0].id);
+    assert(status == FWK_SUCCESS);
+    assert(ctx->delayed_event_count == 0);
+    assert(!fwk_list_is_empty(&ctx->event_free_queue));
+    status = fwk_thread_cancel_delayed_event(event[0].target_id, event[0].id);
+    assert(status == FWK_E_STATE);
+}
+
 static void test_thread_get_ctx_invalid_id(void)
 {
     int status;
@@ -362,16 +517,62 @@ static void test_thread_get_ctx_invalid_module_from_element_id(void)
     assert(status == FWK_E_PARAM);
 }
 
+static void test_thread_get_stats(void)
+{
+    int status;
+    struct fwk_thread_stats stats;
+    struct fwk_thread_queue_stats queue_stats;
+
+    fwk_interrupt_get_current_return_val = FWK_E_STATE;
+    fake_module_ctx.thread_ctx->waiting_event_processing_completion = false;
+    fake_thread_module_ctx.event_queue_stats =
+        (struct fwk_thread_queue_stats) { 0 };
+    ctx->stats = (struct fwk_thread_stats) { .event_count = 2 };
+
+    status = fwk_thread_get_stats(NULL);
+    assert(status == FWK_E_PARAM);
+    status = fwk_thread_get_queue_stats(FWK_ID_MODULE(0x2), NULL);
+    assert(status == FWK_E_PARAM);
+
+    fwk_list_push_tail(&ctx->event_free_queue, &event[1].slist_node);
+    status = fwk_thread_put_event(&event[0]);
+    assert(status == FWK_SUCCESS);
+
+    status = fwk_thread_get_stats(&stats);
+    assert(status == FWK_SUCCESS);
+    assert(stats.event_count == 2);
+    assert(stats.used_event_count == 1);
+    assert(stats.used_event_count_max == 1);
+    assert(stats.failed_alloc_count == 0);
+    assert(stats.event_queue.depth == 1);
+    assert(stats.event_queue.depth_max == 1);
+    assert(stats.isr_event_queue.depth == 0);
+
+    status = fwk_thread_get_queue_stats(FWK_ID_MODULE(0x2), &queue_stats);
+    assert(status == FWK_SUCCESS);
+    assert(queue_stats.depth == 1);
+    assert(queue_stats.depth_max == 1);
+    assert(queue_stats.failed_put_count == 0);
+
+    /* Invalid identifier */
+    fwk_module_is_valid_module_id_return_val = false;
+    status = fwk_thread_get_queue_stats(FWK_ID_MODULE(0x2), &queue_stats);
+    assert(status == FWK_E_PARAM);
+}
+
 static const struct fwk_test_case_desc test_case_table[] = {
     FWK_TEST_CASE(test_put_event_thread_ctx_in_thread_ready_queue),
     FWK_TEST_CASE(test_put_event_not_empty_target_list),
     FWK_TEST_CASE(test_put_event_waiting_on_completion),
+    FWK_TEST_CASE(test_thread_ext_params),
+    FWK_TEST_CASE(test_thread_put_event_delayed),
     FWK_TEST_CASE(test_thread_get_ctx_invalid_id),
     FWK_TEST_CASE(test_thread_get_ctx_common_thread),
     FWK_TEST_CASE(test_thread_get_ctx_module_context),
     FWK_TEST_CASE(test_thread_get_ctx_element_context),
     FWK_TEST_CASE(test_thread_get_ctx_module_from_element_id),
-    FWK_TEST_CASE(test_thread_get_ctx_invalid_module_from_element_id)
+    FWK_TEST_CASE(test_thread_get_ctx_invalid_module_from_element_id),
+    FWK_TEST_CASE(test_thread_get_stats)
 };
 
 struct fwk_test_suite_desc test_suite = {
@@ -39,6 +39,10 @@ void *__wrap_fwk_mm_calloc(size_t num, size_t size)
     return NULL;
 }
 
+static struct fwk_module fake_module_desc = {
+    .notification_count = 4,
+};
+
 static struct fwk_module_ctx fake_module_ctx;
 static struct fwk_dlist fake_module_dlist_table[4];
 struct fwk_module_ctx *__wrap___fwk_module_get_ctx(fwk_id_t id)
@@ -55,6 +59,17 @@ struct fwk_element_ctx *__wrap___fwk_module_get_element_ctx(fwk_id_t id)
     return &fake_element_ctx;
 }
 
+int __wrap___fwk_module_activate(fwk_id_t id)
+{
+    return FWK_SUCCESS;
+}
+
+static unsigned int valid_module_count;
+bool __wrap_fwk_module_is_valid_module_id(fwk_id_t id)
+{
+    return fwk_id_get_module_idx(id) < valid_module_count;
+}
+
 static bool is_valid_entity_id_return_val;
 bool __wrap_fwk_module_is_valid_entity_id(fwk_id_t id)
 {
@@ -94,6 +109,15 @@ int __wrap___fwk_thread_put_notification(struct fwk_event *event)
     return FWK_SUCCESS;
 }
 
+int __wrap___fwk_thread_share_notification(const struct fwk_event *event)
+{
+    return FWK_SUCCESS;
+}
+
+void __wrap___fwk_thread_unshare_notification(void)
+{
+}
+
 static struct fwk_event *get_current_event_return_val;
 const struct fwk_event *__wrap___fwk_thread_get_current_event(void)
 {
@@ -110,6 +134,16 @@ static void test_case_setup(void)
     fwk_mm_calloc_return_val = true;
     get_current_event_return_val = NULL;
     notification_event_count = 0;
+    valid_module_count = 0;
+
+    fake_module_ctx = (struct fwk_module_ctx) {
+        .desc = &fake_module_desc,
+        .element_count = 1,
+        .element_ctx_table = &fake_element_ctx,
+    };
+    fake_element_ctx = (struct fwk_element_ctx) {
+        .subscription_dlist_table = fake_element_dlist_table,
+    };
 
     for (i = 0; i < FWK_ARRAY_SIZE(fake_module_dlist_table); i++)
         fwk_list_init(&fake_module_dlist_table[i]);
@@ -327,7 +361,7 @@ static void test_fwk_notification_unsubscribe(void)
 static void test_fwk_notification_notify(void)
 {
     int result;
-    struct fwk_event notification_event, current_event;
+    struct fwk_event notification_event = { 0 }, current_event;
     unsigned int count;
     struct __fwk_notification_subscription *subscription1, *subscription2,
         *subscription3;
@@ -345,6 +379,12 @@ static void test_fwk_notification_notify(void)
     subscription2 = subscription1 + 1;
     subscription3 = subscription2 + 1;
 
+    /* Notification with an out-of-line parameter block */
+    notification_event.ext_params = &current_event;
+    result = fwk_notification_notify(&notification_event, &count);
+    assert(result == FWK_E_PARAM);
+    notification_event.ext_params = NULL;
+
     /* Call from an ISR, invalid source identifier */
     interrupt_get_current_return_val = FWK_SUCCESS;
     is_valid_entity_id_return_val = false;
@@ -444,11 +484,119 @@ static void test_fwk_notification_notify(void)
     notification_event_count = 0;
 }
 
+static void test___fwk_notification_freeze(void)
+{
+    int result;
+    unsigned int count;
+    struct fwk_event notification_event = { 0 };
+    struct __fwk_notification_frozen_list *frozen_list;
+
+    /* Notifications not initialized */
+    result = __fwk_notification_freeze();
+    assert(result == FWK_E_INIT);
+
+    /* Notifications initialization, one module with one element */
+    result = __fwk_notification_init(3);
+    assert(result == FWK_SUCCESS);
+    valid_module_count = 1;
+
+    result = fwk_notification_subscribe(FWK_ID_NOTIFICATION(0x0, 0x1),
+                                        FWK_ID_ELEMENT(0x0, 0x0),
+                                        FWK_ID_MODULE(0x4));
+    assert(result == FWK_SUCCESS);
+    result = fwk_notification_subscribe(FWK_ID_NOTIFICATION(0x0, 0x1),
+                                        FWK_ID_ELEMENT(0x0, 0x0),
+                                        FWK_ID_ELEMENT(0x6, 0x1));
+    assert(result == FWK_SUCCESS);
+    result = fwk_notification_subscribe(FWK_ID_NOTIFICATION(0x0, 0x1),
+                                        FWK_ID_MODULE(0x0),
+                                        FWK_ID_ELEMENT(0x4, 0x15));
+    assert(result == FWK_SUCCESS);
+
+    /* Memory allocation failed */
+    fwk_mm_calloc_return_val = false;
+    result = __fwk_notification_freeze();
+    assert(result == FWK_E_NOMEM);
+    fwk_mm_calloc_return_val = true;
+
+    result = __fwk_notification_freeze();
+    assert(result == FWK_SUCCESS);
+
+    /* The subscriptions have been moved to the tables, in order */
+    assert(fwk_list_is_empty(&fake_element_dlist_table[1]));
+    assert(fwk_list_is_empty(&fake_module_dlist_table[1]));
+
+    frozen_list = &fake_element_ctx.frozen_subscription_table[1];
+    assert(frozen_list->subscriber_count == 2);
+    assert(fwk_id_is_equal(frozen_list->subscriber_table[0].target_id,
+                           FWK_ID_MODULE(0x4)));
+    assert(fwk_id_is_equal(frozen_list->subscriber_table[1].target_id,
+                           FWK_ID_ELEMENT(0x6, 0x1)));
+    assert(fake_element_ctx.frozen_subscription_table[0].subscriber_count == 0);
+
+    frozen_list = &fake_module_ctx.frozen_subscription_table[1];
+    assert(frozen_list->subscriber_count == 1);
+    assert(fwk_id_is_equal(frozen_list->subscriber_table[0].source_id,
+                           FWK_ID_MODULE(0x0)));
+
+    /* A frozen subscription cannot be made twice */
+    result = fwk_notification_subscribe(FWK_ID_NOTIFICATION(0x0, 0x1),
+                                        FWK_ID_ELEMENT(0x0, 0x0),
+                                        FWK_ID_MODULE(0x4));
+    assert(result == FWK_E_STATE);
+
+    /*
+     * The subscription structures are free again, the subscriptions made
+     * after the freeze are notified after the frozen ones.
+     */
+    result = fwk_notification_subscribe(FWK_ID_NOTIFICATION(0x0, 0x1),
+                                        FWK_ID_ELEMENT(0x0, 0x0),
+                                        FWK_ID_MODULE(0x7));
+    assert(result == FWK_SUCCESS);
+
+    notification_event.source_id = FWK_ID_ELEMENT(0x0, 0x0);
+    notification_event.id = FWK_ID_NOTIFICATION(0x0, 0x1);
+    result = fwk_notification_notify(&notification_event, &count);
+    assert(result == FWK_SUCCESS);
+    assert(count == 3);
+    assert(fwk_id_is_equal(notification_event_table[0].target_id,
+                           FWK_ID_MODULE(0x4)));
+    assert(fwk_id_is_equal(notification_event_table[1].target_id,
+                           FWK_ID_ELEMENT(0x6, 0x1)));
+    assert(fwk_id_is_equal(notification_event_table[2].target_id,
+                           FWK_ID_MODULE(0x7)));
+    notification_event_count = 0;
+
+    /* Unsubscribe from a frozen subscription */
+    result = fwk_notification_unsubscribe(FWK_ID_NOTIFICATION(0x0, 0x1),
+                                          FWK_ID_ELEMENT(0x0, 0x0),
+                                          FWK_ID_MODULE(0x4));
+    assert(result == FWK_SUCCESS);
+    frozen_list = &fake_element_ctx.frozen_subscription_table[1];
+    assert(frozen_list->subscriber_count == 1);
+    assert(fwk_id_is_equal(frozen_list->subscriber_table[0].target_id,
+                           FWK_ID_ELEMENT(0x6, 0x1)));
+
+    result = fwk_notification_unsubscribe(FWK_ID_NOTIFICATION(0x0, 0x1),
+                                          FWK_ID_ELEMENT(0x0, 0x0),
+                                          FWK_ID_MODULE(0x4));
+    assert(result == FWK_E_STATE);
+
+    result = fwk_notification_notify(&notification_event, &count);
+    assert(result == FWK_SUCCESS);
+    assert(count == 2);
+    assert(fwk_id_is_equal(notification_event_table[0].target_id,
+                           FWK_ID_ELEMENT(0x6, 0x1)));
+    assert(fwk_id_is_equal(notification_event_table[1].target_id,
+                           FWK_ID_MODULE(0x7)));
+}
+
 static const struct fwk_test_case_desc test_case_table[] = {
     FWK_TEST_CASE(test___fwk_notification_init),
     FWK_TEST_CASE(test_fwk_notification_subscribe),
     FWK_TEST_CASE(test_fwk_notification_unsubscribe),
-    FWK_TEST_CASE(test_fwk_notification_notify)
+    FWK_TEST_CASE(test_fwk_notification_notify),
+    FWK_TEST_CASE(test___fwk_notification_freeze)
 };
 
 struct fwk_test_suite_desc test_suite = {
@@ -0,0 +1,326 @@
+/*
+ * Arm SCP/MCP Software
+ * Copyright (c) 2015-2019, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+#include <fwk_assert.h>
+#include <fwk_errno.h>
+#include <fwk_id.h>
+#include <fwk_macros.h>
+#include <fwk_profiling.h>
+#include <fwk_test.h>
+#include <internal/fwk_module.h>
+#include <internal/fwk_profiling.h>
+
+#define MODULE_COUNT 2
+#define ELEMENT_COUNT 2
+#define EVENT_COUNT 2
+
+static struct fwk_module_ctx fake_module_ctx_table[MODULE_COUNT];
+static struct fwk_element_ctx fake_element_ctx_table[ELEMENT_COUNT];
+static struct fwk_profiling_stats fake_event_stats_table[EVENT_COUNT];
+
+/* Mock functions */
+static uint32_t counter_val;
+static uint32_t read_counter(void)
+{
+    return counter_val;
+}
+
+struct fwk_module_ctx *__wrap___fwk_module_get_ctx(fwk_id_t id)
+{
+    return &fake_module_ctx_table[fwk_id_get_module_idx(id)];
+}
+
+struct fwk_element_ctx *__wrap___fwk_module_get_element_ctx(fwk_id_t id)
+{
+    return &fake_element_ctx_table[fwk_id_get_element_idx(id)];
+}
+
+bool __wrap_fwk_module_is_valid_module_id(fwk_id_t id)
+{
+    return fwk_id_is_type(id, FWK_ID_TYPE_MODULE) &&
+           (fwk_id_get_module_idx(id) < MODULE_COUNT);
+}
+
+bool __wrap_fwk_module_is_valid_element_id(fwk_id_t id)
+{
+    return fwk_id_is_type(id, FWK_ID_TYPE_ELEMENT) &&
+           (fwk_id_get_module_idx(id) == 0) &&
+           (fwk_id_get_element_idx(id) < ELEMENT_COUNT);
+}
+
+bool __wrap_fwk_module_is_valid_event_id(fwk_id_t id)
+{
+    return fwk_id_is_type(id, FWK_ID_TYPE_EVENT) &&
+           (fwk_id_get_module_idx(id) == 0) &&
+           (fwk_id_get_event_idx(id) < EVENT_COUNT);
+}
+
+static void test_case_setup(void)
+{
+    memset(fake_module_ctx_table, 0, sizeof(fake_module_ctx_table));
+    memset(fake_element_ctx_table, 0, sizeof(fake_element_ctx_table));
+    memset(fake_event_stats_table, 0, sizeof(fake_event_stats_table));
+    fake_module_ctx_table[0].event_profiling_stats_table =
+        fake_event_stats_table;
+    fake_module_ctx_table[0].element_count = ELEMENT_COUNT;
+    fake_module_ctx_table[0].element_ctx_table = fake_element_ctx_table;
+    counter_val = 0;
+    fwk_profiling_set_counter(read_counter);
+}
+
+static void process(struct fwk_event *event, uint32_t put_time,
+                    uint32_t dispatch_time, uint32_t end_time)
+{
+    uint32_t dispatch_timestamp;
+
+    counter_val = put_time;
+    __fwk_profiling_stamp(event);
+    counter_val = dispatch_time;
+    dispatch_timestamp = __fwk_profiling_get_timestamp();
+    counter_val = end_time;
+    __fwk_profiling_record(event, dispatch_timestamp);
+}
+
+static void test_fwk_profiling_no_counter(void)
+{
+    int result;
+    struct fwk_event event = {
+        .target_id = FWK_ID_MODULE(0),
+        .id = FWK_ID_EVENT(0, 1),
+    };
+
+    result = fwk_profiling_set_counter(NULL);
+    assert(result == FWK_SUCCESS);
+
+    counter_val = 10;
+    assert(__fwk_profiling_get_timestamp() == 0);
+
+    process(&event, 10, 20, 30);
+    assert(!event.is_timestamped);
+    assert(fake_module_ctx_table[0].profiling_stats.wait.count == 0);
+    assert(fake_event_stats_table[1].handler.count == 0);
+
+    /* Event put before the counter was set */
+    fwk_profiling_set_counter(NULL);
+    __fwk_profiling_stamp(&event);
+    fwk_profiling_set_counter(read_counter);
+    __fwk_profiling_record(&event, __fwk_profiling_get_timestamp());
+    assert(fake_module_ctx_table[0].profiling_stats.wait.count == 0);
+}
+
+static void test_fwk_profiling_record(void)
+{
+    struct fwk_profiling_stats *module_stats, *event_stats;
+    struct fwk_event event = {
+        .target_id = FWK_ID_ELEMENT(0, 3),
+        .id = FWK_ID_EVENT(0, 1),
+    };
+
+    module_stats = &fake_module_ctx_table[0].profiling_stats;
+    event_stats = &fake_event_stats_table[1];
+
+    /* Waited 50 ticks, processed in 30 ticks */
+    process(&event, 100, 150, 180);
+    assert(event.is_timestamped);
+    assert(event.put_timestamp == 100);
+    assert(module_stats->wait.count == 1);
+    assert(module_stats->wait.total == 50);
+    assert(module_stats->wait.max == 50);
+    assert(module_stats->wait.bins[6] == 1);
+    assert(module_stats->handler.count == 1);
+    assert(module_stats->handler.total == 30);
+    assert(module_stats->handler.max == 30);
+    assert(module_stats->handler.bins[5] == 1);
+    assert(memcmp(event_stats, module_stats, sizeof(*event_stats)) == 0);
+
+    /* Counter wrapping around, not waited, processed in 32 ticks */
+    process(&event, UINT32_MAX - 15, UINT32_MAX - 15, 16);
+    assert(module_stats->wait.count == 2);
+    assert(module_stats->wait.total == 50);
+    assert(module_stats->wait.bins[0] == 1);
+    assert(module_stats->handler.count == 2);
+    assert(module_stats->handler.total == 62);
+    assert(module_stats->handler.max == 32);
+    assert(module_stats->handler.bins[6] == 1);
+    assert(event_stats->handler.count == 2);
+
+    /* Very long processing, accounted to the last bin */
+    process(&event, 0, 1, UINT32_MAX);
+    assert(module_stats->handler.max == (UINT32_MAX - 1));
+    assert(module_stats->handler.bins[FWK_PROFILING_BIN_COUNT - 1] == 1);
+    assert(module_stats->wait.bins[1] == 1);
+
+    /* Responses and notifications are only accounted to their target */
+    event.is_response = true;
+    process(&event, 0, 1, 2);
+    event.is_response = false;
+    event.is_notification = true;
+    event.id = FWK_ID_NOTIFICATION(1, 0);
+    process(&event, 0, 1, 2);
+    assert(module_stats->wait.count == 5);
+    assert(event_stats->wait.count == 3);
+    assert(fake_event_stats_table[0].wait.count == 0);
+    assert(fake_module_ctx_table[1].profiling_stats.wait.count == 0);
+}
+
+static void test_fwk_profiling_get_stats(void)
+{
+    int result;
+    struct fwk_profiling_stats stats;
+    struct fwk_event event = {
+        .target_id = FWK_ID_MODULE(0),
+        .id = FWK_ID_EVENT(0, 0),
+    };
+
+    process(&event, 0, 4, 5);
+
+    result = fwk_profiling_get_stats(FWK_ID_MODULE(0), NULL);
+    assert(result == FWK_E_PARAM);
+
+    result = fwk_profiling_get_stats(FWK_ID_MODULE(MODULE_COUNT), &stats);
+    assert(result == FWK_E_PARAM);
+
+    result = fwk_profiling_get_stats(FWK_ID_EVENT(0, EVENT_COUNT), &stats);
+    assert(result == FWK_E_PARAM);
+
+    result = fwk_profiling_get_stats(FWK_ID_ELEMENT(0, 0), &stats);
+    assert(result == FWK_E_PARAM);
+
+    result = fwk_profiling_get_stats(FWK_ID_MODULE(0), &stats);
+    assert(result == FWK_SUCCESS);
+    assert(stats.wait.count == 1);
+    assert(stats.wait.total == 4);
+    assert(stats.wait.bins[3] == 1);
+    assert(stats.handler.total == 1);
+    assert(stats.handler.bins[1] == 1);
+
+    result = fwk_profiling_get_stats(FWK_ID_MODULE(1), &stats);
+    assert(result == FWK_SUCCESS);
+    assert(stats.wait.count == 0);
+
+    result = fwk_profiling_get_stats(FWK_ID_EVENT(0, 0), &stats);
+    assert(result == FWK_SUCCESS);
+    assert(stats.wait.count == 1);
+
+    result = fwk_profiling_get_stats(FWK_ID_EVENT(0, 1), &stats);
+    assert(result == FWK_SUCCESS);
+    assert(stats.wait.count == 0);
+}
+
+static void record_boot_stage(fwk_id_t id, enum fwk_profiling_boot_stage stage,
+                              uint32_t begin_time, uint32_t end_time)
+{
+    uint32_t timestamp;
+
+    counter_val = begin_time;
+    timestamp = __fwk_profiling_get_timestamp();
+    counter_val = end_time;
+    __fwk_profiling_record_boot_stage(id, stage, timestamp);
+}
+
+static void test_fwk_profiling_get_boot_times(void)
+{
+    int result;
+    struct fwk_profiling_boot_times times;
+
+    record_boot_stage(FWK_ID_MODULE(0), FWK_PROFILING_BOOT_STAGE_INIT, 0, 10);
+    record_boot_stage(FWK_ID_MODULE(0), FWK_PROFILING_BOOT_STAGE_BIND_ROUND_1,
+                      10, 15);
+    record_boot_stage(FWK_ID_ELEMENT(0, 1), FWK_PROFILING_BOOT_STAGE_START,
+                      UINT32_MAX - 1, 2);
+
+    /* Not recorded without counter */
+    fwk_profiling_set_counter(NULL);
+    __fwk_profiling_record_boot_stage(FWK_ID_MODULE(0),
+                                      FWK_PROFILING_BOOT_STAGE_START, 0);
+    fwk_profiling_set_counter(read_counter);
+
+    result = fwk_profiling_get_boot_times(FWK_ID_MODULE(0), NULL);
+    assert(result == FWK_E_PARAM);
+
+    result = fwk_profiling_get_boot_times(FWK_ID_ELEMENT(0, ELEMENT_COUNT),
+                                          &times);
+    assert(result == FWK_E_PARAM);
+
+    result = fwk_profiling_get_boot_times(FWK_ID_EVENT(0, 0), &times);
+    assert(result == FWK_E_PARAM);
+
+    result = fwk_profiling_get_boot_times(FWK_ID_MODULE(0), &times);
+    assert(result == FWK_SUCCESS);
+    assert(times.stage_times[FWK_PROFILING_BOOT_STAGE_INIT] == 10);
+    assert(times.stage_times[FWK_PROFILING_BOOT_STAGE_BIND_ROUND_1] == 5);
+    assert(times.stage_times[FWK_PROFILING_BOOT_STAGE_START] == 0);
+    assert(times.total == 15);
+
+    /* Counter wrapping around */
+    result = fwk_profiling_get_boot_times(FWK_ID_ELEMENT(0, 1), &times);
+    assert(result == FWK_SUCCESS);
+    assert(times.stage_times[FWK_PROFILING_BOOT_STAGE_START] == 4);
+    assert(times.total == 4);
+}
+
+static void test_fwk_profiling_get_boot_report(void)
+{
+    int result;
+    unsigned int entry_count;
+    struct fwk_profiling_boot_entry entry_table[MODULE_COUNT + ELEMENT_COUNT];
+
+    record_boot_stage(FWK_ID_MODULE(0), FWK_PROFILING_BOOT_STAGE_INIT, 0, 10);
+    record_boot_stage(FWK_ID_ELEMENT(0, 0), FWK_PROFILING_BOOT_STAGE_START,
+                      0, 30);
+    record_boot_stage(FWK_ID_MODULE(1), FWK_PROFILING_BOOT_STAGE_POST_INIT,
+                      0, 20);
+
+    result = fwk_profiling_get_boot_report(NULL, &entry_count);
+    assert(result == FWK_E_PARAM);
+
+    result = fwk_profiling_get_boot_report(entry_table, NULL);
+    assert(result == FWK_E_PARAM);
+
+    /* All the modules and elements, sorted by decreasing total time */
+    entry_count = FWK_ARRAY_SIZE(entry_table);
+    result = fwk_profiling_get_boot_report(entry_table, &entry_count);
+    assert(result == FWK_SUCCESS);
+    assert(entry_count == 4);
+    assert(fwk_id_is_equal(entry_table[0].id, FWK_ID_ELEMENT(0, 0)));
+    assert(entry_table[0].times.total == 30);
+    assert(fwk_id_is_equal(entry_table[1].id, FWK_ID_MODULE(1)));
+    assert(fwk_id_is_equal(entry_table[2].id, FWK_ID_MODULE(0)));
+    assert(fwk_id_is_equal(entry_table[3].id, FWK_ID_ELEMENT(0, 1)));
+    assert(entry_table[3].times.total == 0);
+
+    /* Only the longest ones */
+    entry_count = 2;
+    result = fwk_profiling_get_boot_report(entry_table, &entry_count);
+    assert(result == FWK_SUCCESS);
+    assert(entry_count == 2);
+    assert(fwk_id_is_equal(entry_table[0].id, FWK_ID_ELEMENT(0, 0)));
+    assert(fwk_id_is_equal(entry_table[1].id, FWK_ID_MODULE(1)));
+
+    entry_count = 0;
+    result = fwk_profiling_get_boot_report(entry_table, &entry_count);
+    assert(result == FWK_SUCCESS);
+    assert(entry_count == 0);
+}
+
+static const struct fwk_test_case_desc test_case_table[] = {
+    FWK_TEST_CASE(test_fwk_profiling_no_counter),
+    FWK_TEST_CASE(test_fwk_profiling_record),
+    FWK_TEST_CASE(test_fwk_profiling_get_stats),
+    FWK_TEST_CASE(test_fwk_profiling_get_boot_times),
+    FWK_TEST_CASE(test_fwk_profiling_get_boot_report),
+};
+
+struct fwk_test_suite_desc test_suite = {
+    .name = "fwk_profiling",
+    .test_case_setup = test_case_setup,
+    .test_case_count = FWK_ARRAY_SIZE(test_case_table),
+    .test_case_table = test_case_table,
+};
@@ -6,21 +6,27 @@
  */
 
 #include <setjmp.h>
+#include <stdatomic.h>
 #include <stdbool.h>
+#include <stdint.h>
 #include <stdlib.h>
+#include <fwk_align.h>
 #include <fwk_assert.h>
 #include <fwk_errno.h>
 #include <fwk_id.h>
 #include <fwk_list.h>
 #include <fwk_macros.h>
+#include <fwk_mm.h>
 #include <fwk_slist.h>
 #include <fwk_test.h>
+#include <fwk_thread.h>
 #include <internal/fwk_module.h>
 #include <internal/fwk_single_thread.h>
 #include <internal/fwk_thread.h>
 
 static jmp_buf test_context;
 static struct __fwk_thread_ctx *ctx;
+static struct fwk_slist *normal_event_queue;
 
 /* Mock functions */
 static void * fwk_mm_calloc_val;
@@ -34,6 +40,42 @@ void *__wrap_fwk_mm_calloc(size_t num, size_t size)
     return NULL;
 }
 
+/* Fake pool of a single out-of-line parameter block */
+static struct fwk_mm_pool *fake_ext_params_pool = (struct fwk_mm_pool *)1;
+static alignas(uintmax_t) uint8_t
+    fake_ext_params_block[FWK_EVENT_EXT_PARAMETERS_SIZE];
+static bool fake_ext_params_block_used;
+static bool pool_create_return_val;
+struct fwk_mm_pool *__wrap_fwk_mm_pool_create(size_t block_size,
+                                              unsigned int block_count)
+{
+    if (pool_create_return_val)
+        return fake_ext_params_pool;
+    return NULL;
+}
+
+void *__wrap_fwk_mm_pool_alloc(struct fwk_mm_pool *pool)
+{
+    assert(pool == fake_ext_params_pool);
+
+    if (fake_ext_params_block_used)
+        return NULL;
+
+    fake_ext_params_block_used = true;
+    return fake_ext_params_block;
+}
+
+int __wrap_fwk_mm_pool_free(struct fwk_mm_pool *pool, void *block)
+{
+    assert(pool == fake_ext_params_pool);
+
+    if ((block != fake_ext_params_block) || !fake_ext_params_block_used)
+        return FWK_E_PARAM;
+
+    fake_ext_params_block_used = false;
+    return FWK_SUCCESS;
+}
+
 static struct fwk_module fake_module_desc;
 static struct fwk_module_ctx fake_module_ctx;
 struct fwk_module_ctx *__wrap___fwk_module_get_ctx(fwk_id_t id)
@@ -41,6 +83,11 @@ struct fwk_module_ctx *__wrap___fwk_module_get_ctx(fwk_id_t id)
     return &fake_module_ctx;
 }
 
+int __wrap___fwk_module_activate(fwk_id_t id)
+{
+    return FWK_SUCCESS;
+}
+
 bool free_event_queue_break;
 extern void __real___fwk_slist_push_tail(struct fwk_slist *restrict list,
     struct fwk_slist_node *restrict node);
@@ -50,7 +97,8 @@ void __wrap___fwk_slist_push_tail(
 {
     __real___fwk_slist_push_tail(list, new);
     if (free_event_queue_break &&
-        (list == &(ctx->free_event_queue)))
+        ((list == &(ctx->free_event_queue)) ||
+         (list == &(ctx->free_notification_handle_queue))))
         longjmp(test_context, FWK_SUCCESS);
 }
 
@@ -77,8 +125,10 @@ int __wrap_fwk_interrupt_global_enable(void)
     return FWK_SUCCESS;
 }
 
+static unsigned int interrupt_global_disable_count;
 int __wrap_fwk_interrupt_global_disable(void)
 {
+    interrupt_global_disable_count++;
     return FWK_SUCCESS;
 }
 
@@ -89,10 +139,12 @@ int __wrap_fwk_interrupt_get_current(unsigned int *interrupt)
 }
 
 static const struct fwk_event *processed_event;
+static void *processed_ext_params;
 static int process_event(const struct fwk_event *event,
                          struct fwk_event *response_event)
 {
     processed_event = event;
+    processed_ext_params = event->ext_params;
     return FWK_SUCCESS;
 }
 
@@ -105,9 +157,37 @@ static int process_notification(const struct fwk_event *event,
     return FWK_SUCCESS;
 }
 
+/* Fake timer counting microseconds */
+static uint64_t fake_timer_counter;
+static uint64_t fake_timer_alarm;
+static int fake_timer_get_counter(uint64_t *counter)
+{
+    *counter = fake_timer_counter;
+    return FWK_SUCCESS;
+}
+
+static int fake_timer_set_alarm(uint64_t timestamp)
+{
+    fake_timer_alarm = timestamp;
+    return FWK_SUCCESS;
+}
+
+static const struct fwk_thread_timer_driver fake_timer_driver = {
+    .frequency = 1000000,
+    .get_counter = fake_timer_get_counter,
+    .set_alarm = fake_timer_set_alarm,
+};
+
+static unsigned int isr_event_pending_count(void)
+{
+    return atomic_load(&ctx->isr_event_ring.head) -
+           atomic_load(&ctx->isr_event_ring.tail);
+}
+
 static int test_suite_setup(void)
 {
     ctx = __fwk_thread_get_ctx();
+    normal_event_queue = &ctx->event_queue[FWK_EVENT_PRIORITY_NORMAL];
     fake_module_desc.process_event = process_event;
     fake_module_desc.process_notification = process_notification;
     fake_module_ctx.desc = &fake_module_desc;
@@ -121,17 +201,26 @@ static void test_case_setup(void)
     is_valid_event_id_return_val = true;
     is_valid_notification_id_return_val = true;
     interrupt_get_current_return_val = FWK_E_STATE;
+    interrupt_global_disable_count = 0;
     fwk_mm_calloc_return_val = true;
+    pool_create_return_val = true;
+    fake_ext_params_block_used = false;
     fake_module_desc.process_event = process_event;
     fake_module_ctx.desc = &fake_module_desc;
+    fake_timer_counter = 0;
+    fake_timer_alarm = UINT64_MAX;
 }
 
 static void test_case_teardown(void)
 {
+    unsigned int priority;
+
     *ctx = (struct __fwk_thread_ctx){ };
     fwk_list_init(&ctx->free_event_queue);
-    fwk_list_init(&ctx->event_queue);
-    fwk_list_init(&ctx->isr_event_queue);
+    fwk_list_init(&ctx->free_shared_notification_queue);
+    fwk_list_init(&ctx->free_notification_handle_queue);
+    for (priority = 0; priority < FWK_EVENT_PRIORITY_COUNT; priority++)
+        fwk_list_init(&ctx->event_queue[priority]);
 }
 
 static void test___fwk_thread_init(void)
@@ -145,6 +234,14 @@ static void test___fwk_thread_init(void)
     assert(result == FWK_E_NOMEM);
     fwk_mm_calloc_return_val = true;
 
+    #ifdef BUILD_EVENT_EXT_PARAMS_COUNT
+    /* Creation of the pool of out-of-line parameter blocks failed */
+    pool_create_return_val = false;
+    result = __fwk_thread_init(event_count);
+    assert(result == FWK_E_NOMEM);
+    pool_create_return_val = true;
+    #endif
+
     /* Insert 2 events in the list */
     result = __fwk_thread_init(event_count);
     assert(result == FWK_SUCCESS);
@@ -195,25 +292,32 @@ static void test___fwk_thread_run(void)
         .id = FWK_ID_NOTIFICATION(0x5, 0x9),
     };
 
-    result = __fwk_thread_init(1);
+    /* Leave a single free event structure, the ring has room for two events */
+    result = __fwk_thread_init(2);
     assert(result == FWK_SUCCESS);
-    free_event_queue_break = true;
+    fwk_list_pop_head(&ctx->free_event_queue);
     allocated_event = FWK_LIST_GET(fwk_list_head(&ctx->free_event_queue),
         struct fwk_event, slist_node);
 
-    __real___fwk_slist_push_tail(&ctx->event_queue, &(event1.slist_node));
-    __real___fwk_slist_push_tail(&ctx->event_queue, &(event2.slist_node));
-    __real___fwk_slist_push_tail(&ctx->isr_event_queue, &(event3.slist_node));
-    __real___fwk_slist_push_tail(&ctx->isr_event_queue,
-                                 &(notification1.slist_node));
+    __real___fwk_slist_push_tail(normal_event_queue, &(event1.slist_node));
+    __real___fwk_slist_push_tail(normal_event_queue, &(event2.slist_node));
+
+    interrupt_get_current_return_val = FWK_SUCCESS;
+    result = fwk_thread_put_event(&event3);
+    assert(result == FWK_SUCCESS);
+    result = __fwk_thread_put_notification(&notification1);
+    assert(result == FWK_SUCCESS);
+    interrupt_get_current_return_val = FWK_E_STATE;
+    assert(isr_event_pending_count() == 2);
+
+    free_event_queue_break = true;
 
     /* Event1 processing */
     if (setjmp(test_context) == FWK_SUCCESS)
         __fwk_thread_run();
-    assert(ctx->isr_event_queue.head == &(event3.slist_node));
-    assert(ctx->isr_event_queue.tail == &(notification1.slist_node));
-    assert(ctx->event_queue.head == &(event2.slist_node));
-    assert(ctx->event_queue.tail == &(allocated_event->slist_node));
+    assert(isr_event_pending_count() == 2);
+    assert(normal_event_queue->head == &(event2.slist_node));
+    assert(normal_event_queue->tail == &(allocated_event->slist_node));
 
     free_event = FWK_LIST_GET(fwk_list_pop_head(&ctx->free_event_queue),
         struct fwk_event, slist_node);
@@ -227,10 +331,9 @@ static void test___fwk_thread_run(void)
     /* Event2 processing */
     if (setjmp(test_context) == FWK_SUCCESS)
         __fwk_thread_run();
-    assert(ctx->isr_event_queue.head == &(event3.slist_node));
-    assert(ctx->isr_event_queue.tail == &(notification1.slist_node));
-    assert(ctx->event_queue.head == &(allocated_event->slist_node));
-    assert(ctx->event_queue.tail == &(allocated_event->slist_node));
+    assert(isr_event_pending_count() == 2);
+    assert(normal_event_queue->head == &(allocated_event->slist_node));
+    assert(normal_event_queue->tail == &(allocated_event->slist_node));
 
     free_event = FWK_LIST_GET(fwk_list_pop_head(&ctx->free_event_queue),
         struct fwk_event, slist_node);
@@ -244,9 +347,8 @@ static void test___fwk_thread_run(void)
     /* Response to Event1 processing */
     if (setjmp(test_context) == FWK_SUCCESS)
         __fwk_thread_run();
-    assert(ctx->isr_event_queue.head == &(event3.slist_node));
-    assert(ctx->isr_event_queue.tail == &(notification1.slist_node));
-    assert(fwk_list_is_empty(&ctx->event_queue));
+    assert(isr_event_pending_count() == 2);
+    assert(fwk_list_is_empty(normal_event_queue));
 
     free_event = FWK_LIST_GET(fwk_list_pop_head(&ctx->free_event_queue),
         struct fwk_event, slist_node);
@@ -260,34 +362,43 @@ static void test___fwk_thread_run(void)
     assert(fwk_id_is_equal(processed_event->id, FWK_ID_EVENT(0x2, 0x7)));
 
     /* Extract ISR Event3 and process it */
+    free_event_queue_break = false;
+    fwk_list_push_tail(&ctx->free_event_queue, &(allocated_event->slist_node));
+    free_event_queue_break = true;
     if (setjmp(test_context) == FWK_SUCCESS)
         __fwk_thread_run();
-    assert(ctx->isr_event_queue.head == &(notification1.slist_node));
-    assert(ctx->isr_event_queue.tail == &(notification1.slist_node));
-    assert(fwk_list_is_empty(&ctx->event_queue));
+    assert(isr_event_pending_count() == 1);
+    assert(fwk_list_is_empty(normal_event_queue));
 
     free_event = FWK_LIST_GET(fwk_list_pop_head(&ctx->free_event_queue),
         struct fwk_event, slist_node);
-    assert(free_event == &event3);
-    assert(processed_event == &event3);
+    assert(free_event == allocated_event);
+    assert(processed_event == allocated_event);
+    assert(fwk_id_is_equal(processed_event->source_id, FWK_ID_MODULE(0x5)));
+    assert(fwk_id_is_equal(processed_event->target_id, FWK_ID_MODULE(0x6)));
+    assert(fwk_id_is_equal(processed_event->id, FWK_ID_EVENT(0x6, 0x9)));
     assert(processed_event->is_response == false);
     assert(processed_event->response_requested == false);
     assert(processed_event->is_notification == false);
 
-    /* Extract ISR Notification1 and process it */
+    /*
+     * Extract ISR Notification1 and process it. Two free events are needed,
+     * one for the notification and one for its response.
+     */
     free_event_queue_break = false;
     fwk_list_push_tail(&ctx->free_event_queue, &(allocated_event->slist_node));
+    fwk_list_push_tail(&ctx->free_event_queue, &(event3.slist_node));
     free_event_queue_break = true;
     if (setjmp(test_context) == FWK_SUCCESS)
         __fwk_thread_run();
-    assert(fwk_list_is_empty(&ctx->isr_event_queue));
-    assert(ctx->event_queue.head == &(allocated_event->slist_node));
-    assert(ctx->event_queue.tail == &(allocated_event->slist_node));
+    assert(isr_event_pending_count() == 0);
+    assert(normal_event_queue->head == &(event3.slist_node));
+    assert(normal_event_queue->tail == &(event3.slist_node));
 
     free_event = FWK_LIST_GET(fwk_list_pop_head(&ctx->free_event_queue),
         struct fwk_event, slist_node);
-    assert(free_event == &notification1);
-    assert(processed_notification == &notification1);
+    assert(free_event == allocated_event);
+    assert(processed_notification == allocated_event);
     assert(processed_notification->is_response == false);
     assert(processed_notification->response_requested == true);
     assert(processed_notification->is_notification == true);
@@ -295,13 +406,13 @@ static void test___fwk_thread_run(void)
     /* Process response to Notification1 */
     if (setjmp(test_context) == FWK_SUCCESS)
         __fwk_thread_run();
-    assert(fwk_list_is_empty(&ctx->isr_event_queue));
-    assert(fwk_list_is_empty(&ctx->event_queue));
+    assert(isr_event_pending_count() == 0);
+    assert(fwk_list_is_empty(normal_event_queue));
 
     free_event = FWK_LIST_GET(fwk_list_pop_head(&ctx->free_event_queue),
         struct fwk_event, slist_node);
-    assert(free_event == allocated_event);
-    assert(processed_notification == allocated_event);
+    assert(free_event == &event3);
+    assert(processed_notification == &event3);
     assert(processed_notification->is_response == true);
     assert(processed_notification->response_requested == false);
     assert(processed_notification->is_notification == true);
@@ -313,6 +424,93 @@ static void test___fwk_thread_run(void)
                            FWK_ID_NOTIFICATION(0x5, 0x9)));
 }
 
+static void test___fwk_thread_run_isr_event_ring(void)
+{
+    int result;
+    unsigned int i, round, slot_count;
+    struct fwk_event event = {
+        .source_id = FWK_ID_MODULE(0x1),
+        .target_id = FWK_ID_MODULE(0x2),
+        .id = FWK_ID_EVENT(0x2, 0x7),
+    };
+
+    result = __fwk_thread_init(1);
+    assert(result == FWK_SUCCESS);
+    slot_count = ctx->isr_event_ring.mask + 1;
+
+    /*
+     * Fill the ring from ISRs several times in a row to go through the
+     * wrap-around of the ring indices. The events are processed in the order
+     * they were put and the interrupts are never globally masked.
+     */
+    for (round = 0; round < 3; round++) {
+        interrupt_get_current_return_val = FWK_SUCCESS;
+        for (i = 0; i < slot_count; i++) {
+            event.params[0] = round;
+            event.params[1] = i;
+            result = fwk_thread_put_event(&event);
+            assert(result == FWK_SUCCESS);
+        }
+        interrupt_get_current_return_val = FWK_E_STATE;
+        assert(isr_event_pending_count() == slot_count);
+
+        free_event_queue_break = true;
+        for (i = 0; i < slot_count; i++) {
+            if (setjmp(test_context) == FWK_SUCCESS)
+                __fwk_thread_run();
+            assert(processed_event->params[0] == round);
+            assert(processed_event->params[1] == i);
+            assert(isr_event_pending_count() == (slot_count - i - 1));
+        }
+    }
+
+    assert(interrupt_global_disable_count == 0);
+}
+
+static void test___fwk_thread_run_isr_event_batch(void)
+{
+    int result;
+    unsigned int i;
+    struct fwk_slist_node *node;
+    struct fwk_event *event_in_queue;
+    struct fwk_event event = {
+        .source_id = FWK_ID_MODULE(0x1),
+        .target_id = FWK_ID_MODULE(0x2),
+        .id = FWK_ID_EVENT(0x2, 0x7),
+    };
+    const unsigned int isr_event_count = 8;
+
+    result = __fwk_thread_init(isr_event_count);
+    assert(result == FWK_SUCCESS);
+
+    interrupt_get_current_return_val = FWK_SUCCESS;
+    for (i = 0; i < isr_event_count; i++) {
+        event.params[0] = i;
+        result = fwk_thread_put_event(&event);
+        assert(result == FWK_SUCCESS);
+    }
+    interrupt_get_current_return_val = FWK_E_STATE;
+
+    /*
+     * All the ISR events are moved to the event queue at once, in order, before
+     * the first one is processed.
+     */
+    free_event_queue_break = true;
+    if (setjmp(test_context) == FWK_SUCCESS)
+        __fwk_thread_run();
+    assert(isr_event_pending_count() == 0);
+    assert(ctx->isr_event_batch_count == isr_event_count);
+    assert(ctx->isr_event_batch_count_max == isr_event_count);
+    assert(processed_event->params[0] == 0);
+
+    for (i = 1, node = fwk_list_head(normal_event_queue); node != NULL;
+         i++, node = fwk_list_next(normal_event_queue, node)) {
+        event_in_queue = FWK_LIST_GET(node, struct fwk_event, slist_node);
+        assert(event_in_queue->params[0] == i);
+    }
+    assert(i == isr_event_count);
+}
+
 static void test_fwk_thread_put_event(void)
 {
     int result;
@@ -359,7 +557,7 @@ static void test_fwk_thread_put_event(void)
 
     result = fwk_thread_put_event(&event1);
     assert(result == FWK_SUCCESS);
-    result_event = FWK_LIST_GET(fwk_list_pop_head(&ctx->event_queue),
+    result_event = FWK_LIST_GET(fwk_list_pop_head(normal_event_queue),
         struct fwk_event, slist_node);
     assert(fwk_id_is_equal(result_event->source_id, event1.source_id));
     assert(fwk_id_is_equal(result_event->target_id, event1.target_id));
@@ -371,9 +569,11 @@ static void test_fwk_thread_put_event(void)
     interrupt_get_current_return_val = FWK_SUCCESS;
     result = fwk_thread_put_event(&event2);
     assert(result == FWK_SUCCESS);
-    assert(fwk_list_is_empty(&ctx->free_event_queue));
-    result_event = FWK_LIST_GET(fwk_list_pop_head(&ctx->isr_event_queue),
-        struct fwk_event, slist_node);
+
+    /* ISR events do not consume the free events of the thread */
+    assert(!fwk_list_is_empty(&ctx->free_event_queue));
+    assert(isr_event_pending_count() == 1);
+    result_event = &ctx->isr_event_ring.slots[0].event;
     assert(fwk_id_is_equal(result_event->source_id, event2.source_id));
     assert(fwk_id_is_equal(result_event->target_id, event2.target_id));
     assert(result_event->is_response == true);
@@ -406,7 +606,7 @@ static void test___fwk_thread_put_notification(void)
 
     result = __fwk_thread_put_notification(&event1);
     assert(result == FWK_SUCCESS);
-    result_event = FWK_LIST_GET(fwk_list_pop_head(&ctx->event_queue),
+    result_event = FWK_LIST_GET(fwk_list_pop_head(normal_event_queue),
         struct fwk_event, slist_node);
     assert(fwk_id_is_equal(result_event->source_id, event1.source_id));
     assert(fwk_id_is_equal(result_event->target_id, event1.target_id));
@@ -418,9 +618,11 @@ static void test___fwk_thread_put_notification(void)
     interrupt_get_current_return_val = FWK_SUCCESS;
     result = __fwk_thread_put_notification(&event2);
     assert(result == FWK_SUCCESS);
-    assert(fwk_list_is_empty(&ctx->free_event_queue));
-    result_event = FWK_LIST_GET(fwk_list_pop_head(&ctx->isr_event_queue),
-        struct fwk_event, slist_node);
+
+    /* ISR events do not consume the free events of the thread */
+    assert(!fwk_list_is_empty(&ctx->free_event_queue));
+    assert(isr_event_pending_count() == 1);
+    result_event = &ctx->isr_event_ring.slots[0].event;
     assert(fwk_id_is_equal(result_event->source_id, event2.source_id));
     assert(fwk_id_is_equal(result_event->target_id, event2.target_id));
     assert(result_event->is_response == false);
@@ -428,11 +630,559 @@ static void test___fwk_thread_put_notification(void)
     assert(result_event->is_notification == true);
 }
 
+static void test___fwk_thread_run_shared_notification(void)
+{
+    int result;
+    unsigned int i;
+    struct fwk_event *free_event;
+    struct __fwk_thread_shared_notification *notification;
+    struct fwk_event event = {
+        .source_id = FWK_ID_MODULE(0x1),
+        .id = FWK_ID_NOTIFICATION(0x1, 0x2),
+        .priority = FWK_EVENT_PRIORITY_HIGH,
+        .params = { 0xA5 },
+    };
+    struct fwk_event coalesced_event = {
+        .target_id = FWK_ID_MODULE(0x2),
+        .id = FWK_ID_EVENT(0x2, 0x7),
+        .priority = FWK_EVENT_PRIORITY_HIGH,
+        .coalesce = true,
+    };
+    const fwk_id_t target_id_table[] = {
+        FWK_ID_MODULE(0x2),
+        FWK_ID_ELEMENT(0x3, 0x1),
+        FWK_ID_MODULE(0x4),
+    };
+
+    /* Too few event structures for notification payloads to be shared */
+    result = __fwk_thread_init(1);
+    assert(result == FWK_SUCCESS);
+    result = __fwk_thread_share_notification(&event);
+    assert(result == FWK_E_NOMEM);
+
+    /*
+     * Enough event structures for one shared notification payload. Leave a
+     * single one free.
+     */
+    result = __fwk_thread_init(16);
+    assert(result == FWK_SUCCESS);
+    for (i = 1; i < 16; i++)
+        fwk_list_pop_head(&ctx->free_event_queue);
+    free_event = FWK_LIST_GET(fwk_list_head(&ctx->free_event_queue),
+        struct fwk_event, slist_node);
+
+    /* Sharing is not possible from an ISR */
+    interrupt_get_current_return_val = FWK_SUCCESS;
+    result = __fwk_thread_share_notification(&event);
+    assert(result == FWK_E_HANDLER);
+    interrupt_get_current_return_val = FWK_E_STATE;
+
+    /* Nothing shared, the notification payload is released at once */
+    result = __fwk_thread_share_notification(&event);
+    assert(result == FWK_SUCCESS);
+    notification = ctx->shared_notification;
+    result = __fwk_thread_share_notification(&event);
+    assert(result == FWK_E_STATE);
+    __fwk_thread_unshare_notification();
+    assert(ctx->shared_notification == NULL);
+    assert(ctx->free_shared_notification_queue.tail ==
+           &notification->event.slist_node);
+
+    /*
+     * One notification for three targets, while there is a single free event
+     * structure.
+     */
+    result = __fwk_thread_share_notification(&event);
+    assert(result == FWK_SUCCESS);
+    notification = ctx->shared_notification;
+    for (i = 0; i < FWK_ARRAY_SIZE(target_id_table); i++) {
+        event.target_id = target_id_table[i];
+        result = __fwk_thread_put_notification(&event);
+        assert(result == FWK_SUCCESS);
+    }
+    __fwk_thread_unshare_notification();
+
+    assert(notification->ref_count == FWK_ARRAY_SIZE(target_id_table));
+    assert(fwk_list_head(&ctx->free_event_queue) == &free_event->slist_node);
+
+    /* The targets get the payload in turn, in order */
+    free_event_queue_break = true;
+    for (i = 0; i < FWK_ARRAY_SIZE(target_id_table); i++) {
+        if (setjmp(test_context) == FWK_SUCCESS)
+            __fwk_thread_run();
+        assert(processed_notification == &notification->event);
+        assert(fwk_id_is_equal(processed_notification->target_id,
+                               target_id_table[i]));
+        assert(fwk_id_is_equal(processed_notification->source_id,
+                               FWK_ID_MODULE(0x1)));
+        assert(processed_notification->is_notification);
+        assert(processed_notification->params[0] == 0xA5);
+
+        /*
+         * Searching the queue the remaining handles are in for an event to
+         * coalesce with does not alter the notification being processed.
+         */
+        if (i == 0) {
+            result = fwk_thread_put_event(&coalesced_event);
+            assert(result == FWK_SUCCESS);
+            assert(fwk_id_is_equal(processed_notification->target_id,
+                                   target_id_table[0]));
+        }
+    }
+
+    /* The event put while processing the notification comes last */
+    if (setjmp(test_context) == FWK_SUCCESS)
+        __fwk_thread_run();
+    assert(fwk_id_is_equal(processed_event->id, coalesced_event.id));
+
+    /* The payload is released once processed for all its targets */
+    assert(notification->ref_count == 0);
+    assert(ctx->free_shared_notification_queue.tail ==
+           &notification->event.slist_node);
+    assert(fwk_list_is_empty(&ctx->event_queue[FWK_EVENT_PRIORITY_HIGH]));
+    assert(fwk_list_head(&ctx->free_event_queue) == &free_event->slist_node);
+}
+
+#ifdef BUILD_EVENT_EXT_PARAMS_COUNT
+static void test___fwk_thread_run_ext_params(void)
+{
+    int result;
+    struct fwk_event *allocated_event;
+    struct fwk_event event = {
+        .source_id = FWK_ID_MODULE(0x1),
+        .target_id = FWK_ID_MODULE(0x2),
+        .id = FWK_ID_EVENT(0x2, 0x7),
+    };
+
+    /* Leave a single free event structure, the ring has room for two events */
+    result = __fwk_thread_init(2);
+    assert(result == FWK_SUCCESS);
+    fwk_list_pop_head(&ctx->free_event_queue);
+    allocated_event = FWK_LIST_GET(fwk_list_head(&ctx->free_event_queue),
+        struct fwk_event, slist_node);
+
+    result = fwk_thread_alloc_ext_params(&event, 64);
+    assert(result == FWK_SUCCESS);
+    assert(event.ext_params == fake_ext_params_block);
+    ((uint8_t *)event.ext_params)[63] = 0x5A;
+
+    result = fwk_thread_put_event(&event);
+    assert(result == FWK_SUCCESS);
+
+    /* The block is passed to the target then released */
+    free_event_queue_break = true;
+    if (setjmp(test_context) == FWK_SUCCESS)
+        __fwk_thread_run();
+    assert(processed_event == allocated_event);
+    assert(processed_ext_params == fake_ext_params_block);
+    assert(fwk_list_head(&ctx->free_event_queue) ==
+           &allocated_event->slist_node);
+    assert(allocated_event->ext_params == NULL);
+    assert(!fake_ext_params_block_used);
+    assert(fake_ext_params_block[63] == 0x5A);
+}
+#endif
+
+static void test___fwk_thread_run_priority(void)
+{
+    int result;
+    unsigned int i;
+    struct fwk_event event = {
+        .source_id = FWK_ID_MODULE(0x1),
+        .target_id = FWK_ID_MODULE(0x2),
+        .id = FWK_ID_EVENT(0x2, 0x7),
+    };
+    const unsigned int backlog_count = 16;
+
+    result = __fwk_thread_init(backlog_count + 2);
+    assert(result == FWK_SUCCESS);
+
+    /* Backlog of low and normal priority events */
+    for (i = 0; i < backlog_count; i++) {
+        event.priority = (i & 1) ? FWK_EVENT_PRIORITY_LOW :
+                                   FWK_EVENT_PRIORITY_NORMAL;
+        event.params[0] = i;
+        result = fwk_thread_put_event(&event);
+        assert(result == FWK_SUCCESS);
+    }
+
+    /* A high priority event is put last ... */
+    event.priority = FWK_EVENT_PRIORITY_HIGH;
+    event.params[0] = 0xFF;
+    result = fwk_thread_put_event(&event);
+    assert(result == FWK_SUCCESS);
+
+    /* ... but is the first one to be processed, whatever the backlog. */
+    free_event_queue_break = true;
+    if (setjmp(test_context) == FWK_SUCCESS)
+        __fwk_thread_run();
+    assert(processed_event->priority == FWK_EVENT_PRIORITY_HIGH);
+    assert(processed_event->params[0] == 0xFF);
+    assert(fwk_list_is_empty(&ctx->event_queue[FWK_EVENT_PRIORITY_HIGH]));
+
+    /* Normal priority events are then processed before low priority ones */
+    if (setjmp(test_context) == FWK_SUCCESS)
+        __fwk_thread_run();
+    assert(processed_event->priority == FWK_EVENT_PRIORITY_NORMAL);
+    assert(processed_event->params[0] == 0);
+
+    /* Invalid priority */
+    event.priority = FWK_EVENT_PRIORITY_COUNT;
+    result = fwk_thread_put_event(&event);
+    assert(result == FWK_E_PARAM);
+}
+
+static void test___fwk_thread_run_coalesce(void)
+{
+    int result;
+    struct fwk_event *result_event;
+    struct fwk_event event = {
+        .source_id = FWK_ID_MODULE(0x1),
+        .target_id = FWK_ID_MODULE(0x2),
+        .id = FWK_ID_EVENT(0x2, 0x7),
+        .coalesce = true,
+    };
+
+    result = __fwk_thread_init(3);
+    assert(result == FWK_SUCCESS);
+
+    event.params[0] = 1;
+    result = fwk_thread_put_event(&event);
+    assert(result == FWK_SUCCESS);
+
+    /* The pending event takes the source and parameters of the new one */
+    event.source_id = FWK_ID_MODULE(0x3);
+    event.params[0] = 2;
+    result = fwk_thread_put_event(&event);
+    assert(result == FWK_SUCCESS);
+    assert(ctx->stats.used_event_count == 1);
+    assert(ctx->stats.coalesced_event_count == 1);
+
+    /* Events without the flag or requesting a response are queued */
+    event.coalesce = false;
+    result = fwk_thread_put_event(&event);
+    assert(result == FWK_SUCCESS);
+    event.coalesce = true;
+    event.response_requested = true;
+    result = fwk_thread_put_event(&event);
+    assert(result == FWK_SUCCESS);
+    assert(ctx->stats.used_event_count == 3);
+    assert(ctx->stats.coalesced_event_count == 1);
+
+    result_event = FWK_LIST_GET(fwk_list_head(normal_event_queue),
+        struct fwk_event, slist_node);
+    assert(fwk_id_is_equal(result_event->source_id, FWK_ID_MODULE(0x3)));
+    assert(result_event->params[0] == 2);
+
+    free_event_queue_break = true;
+    if (setjmp(test_context) == FWK_SUCCESS)
+        __fwk_thread_run();
+    assert(processed_event->params[0] == 2);
+}
+
+static void test___fwk_thread_run_coalesce_isr_event(void)
+{
+    int result;
+    struct fwk_event event = {
+        .source_id = FWK_ID_MODULE(0x1),
+        .target_id = FWK_ID_MODULE(0x2),
+        .id = FWK_ID_EVENT(0x2, 0x7),
+        .coalesce = true,
+    };
+
+    result = __fwk_thread_init(2);
+    assert(result == FWK_SUCCESS);
+
+    interrupt_get_current_return_val = FWK_SUCCESS;
+    event.params[0] = 1;
+    result = fwk_thread_put_event(&event);
+    assert(result == FWK_SUCCESS);
+    event.params[0] = 2;
+    result = fwk_thread_put_event(&event);
+    assert(result == FWK_SUCCESS);
+    interrupt_get_current_return_val = FWK_E_STATE;
+    assert(isr_event_pending_count() == 2);
+
+    /* The ISR events are coalesced when moved to the event queue */
+    free_event_queue_break = true;
+    if (setjmp(test_context) == FWK_SUCCESS)
+        __fwk_thread_run();
+    assert(isr_event_pending_count() == 0);
+    assert(ctx->isr_event_batch_count == 2);
+    assert(ctx->stats.coalesced_event_count == 1);
+    assert(processed_event->params[0] == 2);
+    assert(fwk_list_is_empty(normal_event_queue));
+}
+
+static void test_fwk_thread_put_event_delayed(void)
+{
+    int result;
+    struct fwk_event event = {
+        .source_id = FWK_ID_MODULE(0x1),
+        .target_id = FWK_ID_MODULE(0x2),
+        .id = FWK_ID_EVENT(0x2, 0x7),
+    };
+
+    result = __fwk_thread_init(3);
+    assert(result == FWK_SUCCESS);
+
+    /* No timer driver */
+    result = fwk_thread_put_event_delayed(&event, 100);
+    assert(result == FWK_E_SUPPORT);
+
+    result = fwk_thread_set_timer_driver(&fake_timer_driver);
+    assert(result == FWK_SUCCESS);
+    result = fwk_thread_set_timer_driver(&fake_timer_driver);
+    assert(result == FWK_E_STATE);
+
+    /* Called from an ISR */
+    interrupt_get_current_return_val = FWK_SUCCESS;
+    result = fwk_thread_put_event_delayed(&event, 100);
+    assert(result == FWK_E_ACCESS);
+    interrupt_get_current_return_val = FWK_E_STATE;
+
+    event.params[0] = 1;
+    result = fwk_thread_put_event_delayed(&event, 100);
+    assert(result == FWK_SUCCESS);
+    assert(fake_timer_alarm == 100);
+
+    event.params[0] = 2;
+    result = fwk_thread_put_event_delayed(&event, 50);
+    assert(result == FWK_SUCCESS);
+    assert(fake_timer_alarm == 50);
+
+    /* The events are held, not queued */
+    assert(fwk_list_is_empty(normal_event_queue));
+    assert(ctx->stats.used_event_count == 2);
+
+    /* The first event due is put when the alarm expires */
+    fake_timer_counter = 60;
+    fwk_thread_signal_timer();
+    free_event_queue_break = true;
+    if (setjmp(test_context) == FWK_SUCCESS)
+        __fwk_thread_run();
+    assert(processed_event->params[0] == 2);
+    assert(fake_timer_alarm == 100);
+    assert(ctx->delayed_event_count == 1);
+    free_event_queue_break = false;
+
+    result = fwk_thread_cancel_delayed_event(event.target_id, event.id);
+    assert(result == FWK_SUCCESS);
+    assert(ctx->delayed_event_count == 0);
+    assert(ctx->stats.used_event_count == 0);
+    result = fwk_thread_cancel_delayed_event(event.target_id, event.id);
+    assert(result == FWK_E_STATE);
+}
+
+static void test_fwk_thread_put_event_periodic(void)
+{
+    int result;
+    struct fwk_event event = {
+        .source_id = FWK_ID_MODULE(0x1),
+        .target_id = FWK_ID_MODULE(0x2),
+        .id = FWK_ID_EVENT(0x2, 0x7),
+    };
+
+    result = __fwk_thread_init(2);
+    assert(result == FWK_SUCCESS);
+    result = fwk_thread_set_timer_driver(&fake_timer_driver);
+    assert(result == FWK_SUCCESS);
+
+    /* Invalid period */
+    result = fwk_thread_put_event_periodic(&event, 0);
+    assert(result == FWK_E_PARAM);
+
+    #ifdef BUILD_EVENT_EXT_PARAMS_COUNT
+    /* Periodic events cannot carry an out-of-line parameter block */
+    result = fwk_thread_alloc_ext_params(&event, 8);
+    assert(result == FWK_SUCCESS);
+    result = fwk_thread_put_event_periodic(&event, 10);
+    assert(result == FWK_E_PARAM);
+    result = fwk_thread_free_ext_params(&event);
+    assert(result == FWK_SUCCESS);
+    #endif
+
+    event.params[0] = 3;
+    result = fwk_thread_put_event_periodic(&event, 10);
+    assert(result == FWK_SUCCESS);
+    assert(fake_timer_alarm == 10);
+
+    /* The occurrences missed are skipped and the event is held again */
+    fake_timer_counter = 35;
+    fwk_thread_signal_timer();
+    free_event_queue_break = true;
+    if (setjmp(test_context) == FWK_SUCCESS)
+        __fwk_thread_run();
+    assert(processed_event->params[0] == 3);
+    assert(fake_timer_alarm == 40);
+    assert(ctx->delayed_event_count == 1);
+    assert(ctx->stats.used_event_count == 1);
+    free_event_queue_break = false;
+
+    result = fwk_thread_cancel_delayed_event(event.target_id, event.id);
+    assert(result == FWK_SUCCESS);
+    assert(ctx->stats.used_event_count == 0);
+}
+
+static void test_fwk_thread_alloc_ext_params(void)
+{
+    int result;
+    struct fwk_event event = { };
+    struct fwk_event other_event = { };
+
+    /* Thread component not initialized */
+    result = fwk_thread_alloc_ext_params(&event, 1);
+    assert(result == FWK_E_INIT);
+    result = fwk_thread_free_ext_params(&event);
+    assert(result == FWK_E_INIT);
+
+    result = __fwk_thread_init(1);
+    assert(result == FWK_SUCCESS);
+
+    /* Invalid parameters */
+    result = fwk_thread_alloc_ext_params(NULL, 1);
+    assert(result == FWK_E_PARAM);
+    result = fwk_thread_alloc_ext_params(&event, 0);
+    assert(result == FWK_E_PARAM);
+    result = fwk_thread_alloc_ext_params(&event,
+                                         FWK_EVENT_EXT_PARAMETERS_SIZE + 1);
+    assert(result == FWK_E_PARAM);
+    result = fwk_thread_free_ext_params(NULL);
+    assert(result == FWK_E_PARAM);
+    assert(event.ext_params == NULL);
+
+    #ifdef BUILD_EVENT_EXT_PARAMS_COUNT
+    result = fwk_thread_alloc_ext_params(&event,
+                                         FWK_EVENT_EXT_PARAMETERS_SIZE);
+    assert(result == FWK_SUCCESS);
+    assert(event.ext_params == fake_ext_params_block);
+
+    /* The event already has a block */
+    result = fwk_thread_alloc_ext_params(&event, 1);
+    assert(result == FWK_E_STATE);
+
+    /* No block left */
+    result = fwk_thread_alloc_ext_params(&other_event, 1);
+    assert(result == FWK_E_NOMEM);
+    assert(other_event.ext_params == NULL);
+
+    /* Release of an event without block */
+    result = fwk_thread_free_ext_params(&other_event);
+    assert(result == FWK_SUCCESS);
+
+    result = fwk_thread_free_ext_params(&event);
+    assert(result == FWK_SUCCESS);
+    assert(event.ext_params == NULL);
+    assert(!fake_ext_params_block_used);
+    #else
+    /* No block is configured */
+    result = fwk_thread_alloc_ext_params(&event, 1);
+    assert(result == FWK_E_SUPPORT);
+    assert(event.ext_params == NULL);
+    result = fwk_thread_free_ext_params(&event);
+    assert(result == FWK_SUCCESS);
+    (void)other_event;
+    #endif
+}
+
+static void test_fwk_thread_get_stats(void)
+{
+    int result;
+    struct fwk_thread_stats stats;
+    struct fwk_event event = {
+        .source_id = FWK_ID_MODULE(0x1),
+        .target_id = FWK_ID_MODULE(0x2),
+        .id = FWK_ID_EVENT(0x2, 0x7),
+    };
+
+    /* Thread component not initialized */
+    result = fwk_thread_get_stats(&stats);
+    assert(result == FWK_E_INIT);
+
+    /* Leave a single free event structure, the ring has room for two events */
+    result = __fwk_thread_init(2);
+    assert(result == FWK_SUCCESS);
+    fwk_list_pop_head(&ctx->free_event_queue);
+
+    result = fwk_thread_get_stats(NULL);
+    assert(result == FWK_E_PARAM);
+
+    /* One event put from the thread, two from an ISR */
+    result = fwk_thread_put_event(&event);
+    assert(result == FWK_SUCCESS);
+    interrupt_get_current_return_val = FWK_SUCCESS;
+    result = fwk_thread_put_event(&event);
+    assert(result == FWK_SUCCESS);
+    result = fwk_thread_put_event(&event);
+    assert(result == FWK_SUCCESS);
+    interrupt_get_current_return_val = FWK_E_STATE;
+
+    result = fwk_thread_get_stats(&stats);
+    assert(result == FWK_SUCCESS);
+    assert(stats.event_count == 2);
+    assert(stats.used_event_count == 1);
+    assert(stats.used_event_count_max == 1);
+    assert(stats.failed_alloc_count == 0);
+    assert(stats.event_queue.depth == 1);
+    assert(stats.event_queue.depth_max == 1);
+    assert(stats.isr_event_queue.depth == 2);
+    assert(stats.isr_event_queue.depth_max == 2);
+    assert(stats.isr_event_queue.failed_put_count == 0);
+
+    free_event_queue_break = true;
+    if (setjmp(test_context) == FWK_SUCCESS)
+        __fwk_thread_run();
+
+    result = fwk_thread_get_stats(&stats);
+    assert(result == FWK_SUCCESS);
+    assert(stats.used_event_count == 0);
+    assert(stats.event_queue.depth == 0);
+
+    /*
+     * A single event structure is free, the second ISR event is left in the
+     * ring of ISR events.
+     */
+    if (setjmp(test_context) == FWK_SUCCESS)
+        __fwk_thread_run();
+
+    result = fwk_thread_get_stats(&stats);
+    assert(result == FWK_SUCCESS);
+    assert(stats.used_event_count == 0);
+    assert(stats.used_event_count_max == 1);
+    assert(stats.failed_alloc_count == 1);
+    assert(stats.event_queue.depth == 0);
+    assert(stats.event_queue.depth_max == 1);
+    assert(stats.isr_event_queue.depth == 1);
+    assert(stats.isr_event_queue.depth_max == 2);
+
+    if (setjmp(test_context) == FWK_SUCCESS)
+        __fwk_thread_run();
+
+    result = fwk_thread_get_stats(&stats);
+    assert(result == FWK_SUCCESS);
+    assert(stats.failed_alloc_count == 1);
+    assert(stats.isr_event_queue.depth == 0);
+    assert(stats.isr_event_queue.depth_max == 2);
+}
+
 static const struct fwk_test_case_desc test_case_table[] = {
     FWK_TEST_CASE(test___fwk_thread_init),
     FWK_TEST_CASE(test___fwk_thread_run),
+    #ifdef BUILD_EVENT_EXT_PARAMS_COUNT
+    FWK_TEST_CASE(test___fwk_thread_run_ext_params),
+    #endif
+    FWK_TEST_CASE(test___fwk_thread_run_priority),
+    FWK_TEST_CASE(test___fwk_thread_run_shared_notification),
+    FWK_TEST_CASE(test___fwk_thread_run_isr_event_ring),
+    FWK_TEST_CASE(test___fwk_thread_run_isr_event_batch),
+    FWK_TEST_CASE(test___fwk_thread_run_coalesce),
+    FWK_TEST_CASE(test___fwk_thread_run_coalesce_isr_event),
     FWK_TEST_CASE(test_fwk_thread_put_event),
-    FWK_TEST_CASE(test___fwk_thread_put_notification)
+    FWK_TEST_CASE(test___fwk_thread_put_notification),
+    FWK_TEST_CASE(test_fwk_thread_put_event_delayed),
+    FWK_TEST_CASE(test_fwk_thread_put_event_periodic),
+    FWK_TEST_CASE(test_fwk_thread_alloc_ext_params),
+    FWK_TEST_CASE(test_fwk_thread_get_stats)
 };
 
 struct fwk_test_suite_desc test_suite = {
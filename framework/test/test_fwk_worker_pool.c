@@ -0,0 +1,182 @@
+/*
+ * Arm SCP/MCP Software
+ * Copyright (c) 2015-2019, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <stdbool.h>
+#include <stdlib.h>
+#include <fwk_assert.h>
+#include <fwk_errno.h>
+#include <fwk_list.h>
+#include <fwk_macros.h>
+#include <fwk_test.h>
+#include <internal/fwk_worker_pool.h>
+
+#define ENTITY_COUNT 3
+#define NODE_COUNT 4
+
+static struct __fwk_worker_pool_entity entity_table[ENTITY_COUNT];
+static struct fwk_slist_node node_table[NODE_COUNT];
+
+/* Mock functions */
+static bool calloc_fail;
+void *__wrap_fwk_mm_calloc(size_t num, size_t size)
+{
+    if (calloc_fail)
+        return NULL;
+
+    return calloc(num, size);
+}
+
+static void test_case_setup(void)
+{
+    unsigned int i;
+
+    calloc_fail = false;
+    __fwk_worker_pool_reset();
+
+    for (i = 0; i < ENTITY_COUNT; i++) {
+        entity_table[i] = (struct __fwk_worker_pool_entity){ 0 };
+        __fwk_worker_pool_init_entity(&entity_table[i]);
+    }
+
+    for (i = 0; i < NODE_COUNT; i++)
+        node_table[i] = (struct fwk_slist_node){ 0 };
+}
+
+static void test_fwk_worker_pool_init_fail(void)
+{
+    int result;
+
+    calloc_fail = true;
+    result = __fwk_worker_pool_init(2);
+    assert(result == FWK_E_NOMEM);
+}
+
+static void test_fwk_worker_pool_entity_order(void)
+{
+    int result;
+    struct fwk_slist_node *node;
+    struct __fwk_worker_pool_entity *entity;
+
+    result = __fwk_worker_pool_init(2);
+    assert(result == FWK_SUCCESS);
+
+    /* The entities readied by a non-worker start with the first worker */
+    __fwk_worker_pool_queue(&entity_table[0], &node_table[0]);
+    __fwk_worker_pool_queue(&entity_table[0], &node_table[1]);
+    assert(entity_table[0].ready);
+
+    node = __fwk_worker_pool_get_next(0, &entity);
+    assert(node == &node_table[0]);
+    assert(entity == &entity_table[0]);
+    assert(entity->busy);
+    assert(!entity->ready);
+
+    /* A busy entity is not processed by another worker */
+    __fwk_worker_pool_queue(&entity_table[0], &node_table[2]);
+    assert(!entity_table[0].ready);
+    assert(__fwk_worker_pool_get_next(0, &entity) == NULL);
+    assert(__fwk_worker_pool_get_next(1, &entity) == NULL);
+
+    /* Once completed, it is readied again and can be stolen */
+    __fwk_worker_pool_complete(0, &entity_table[0]);
+    assert(!entity_table[0].busy);
+    assert(entity_table[0].ready);
+
+    node = __fwk_worker_pool_get_next(1, &entity);
+    assert(node == &node_table[1]);
+    assert(entity == &entity_table[0]);
+    __fwk_worker_pool_complete(1, entity);
+
+    node = __fwk_worker_pool_get_next(1, &entity);
+    assert(node == &node_table[2]);
+    __fwk_worker_pool_complete(1, entity);
+
+    /* An entity without events is not readied again */
+    assert(!entity_table[0].ready);
+    assert(__fwk_worker_pool_get_next(0, &entity) == NULL);
+    assert(__fwk_worker_pool_get_next(1, &entity) == NULL);
+}
+
+static void test_fwk_worker_pool_steal(void)
+{
+    int result;
+    struct fwk_slist_node *node;
+    struct __fwk_worker_pool_entity *entity;
+
+    result = __fwk_worker_pool_init(2);
+    assert(result == FWK_SUCCESS);
+
+    /* Readied on the first, second and first worker in turn */
+    __fwk_worker_pool_queue(&entity_table[0], &node_table[0]);
+    __fwk_worker_pool_queue(&entity_table[1], &node_table[1]);
+    __fwk_worker_pool_queue(&entity_table[2], &node_table[2]);
+
+    /* A worker takes its own entities first */
+    node = __fwk_worker_pool_get_next(1, &entity);
+    assert(node == &node_table[1]);
+    assert(entity == &entity_table[1]);
+    __fwk_worker_pool_complete(1, entity);
+
+    /* It then steals the least recently readied entity of another worker */
+    node = __fwk_worker_pool_get_next(1, &entity);
+    assert(node == &node_table[0]);
+    assert(entity == &entity_table[0]);
+    __fwk_worker_pool_complete(1, entity);
+
+    /* The owner takes the most recently readied entity */
+    node = __fwk_worker_pool_get_next(0, &entity);
+    assert(node == &node_table[2]);
+    assert(entity == &entity_table[2]);
+    __fwk_worker_pool_complete(0, entity);
+
+    assert(__fwk_worker_pool_get_next(0, &entity) == NULL);
+    assert(__fwk_worker_pool_get_next(1, &entity) == NULL);
+}
+
+static void test_fwk_worker_pool_exclusive(void)
+{
+    int result;
+
+    result = __fwk_worker_pool_init(2);
+    assert(result == FWK_SUCCESS);
+
+    /* Outside of a concurrent handler, the sections do nothing */
+    __fwk_worker_pool_begin_exclusive();
+    __fwk_worker_pool_end_exclusive();
+
+    __fwk_worker_pool_lock();
+
+    /* The sections of a concurrent handler can be nested */
+    __fwk_worker_pool_begin_handler(true);
+    __fwk_worker_pool_begin_exclusive();
+    __fwk_worker_pool_begin_exclusive();
+    __fwk_worker_pool_end_exclusive();
+    __fwk_worker_pool_end_exclusive();
+    __fwk_worker_pool_end_handler(true);
+
+    /* A handler that runs alone is already exclusive */
+    __fwk_worker_pool_begin_handler(false);
+    __fwk_worker_pool_begin_exclusive();
+    __fwk_worker_pool_end_exclusive();
+    __fwk_worker_pool_end_handler(false);
+
+    __fwk_worker_pool_unlock();
+}
+
+static const struct fwk_test_case_desc test_case_table[] = {
+    FWK_TEST_CASE(test_fwk_worker_pool_init_fail),
+    FWK_TEST_CASE(test_fwk_worker_pool_entity_order),
+    FWK_TEST_CASE(test_fwk_worker_pool_steal),
+    FWK_TEST_CASE(test_fwk_worker_pool_exclusive),
+};
+
+struct fwk_test_suite_desc test_suite = {
+    .name = "fwk_worker_pool",
+    .test_case_setup = test_case_setup,
+    .test_case_count = FWK_ARRAY_SIZE(test_case_table),
+    .test_case_table = test_case_table,
+};
@@ -11,6 +11,7 @@
 #include <fwk_mm.h>
 #include <fwk_module.h>
 #include <fwk_module_idx.h>
+#include <fwk_thread.h>
 #include <mod_clock.h>
 #include <mod_dvfs_private.h>
 #include <mod_psu.h>
@@ -169,6 +170,23 @@ int api_get_latency(fwk_id_t domain_id, uint16_t *latency)
     return FWK_SUCCESS;
 }
 
+const struct mod_dvfs_opp *__mod_dvfs_get_valid_opp(
+    const struct mod_dvfs_domain_ctx *ctx,
+    uint64_t frequency)
+{
+    const struct mod_dvfs_opp *opp;
+
+    /* Only accept frequencies that exist in the operating point table */
+    opp = get_opp_for_values(ctx, frequency, 0);
+    if (opp == NULL)
+        return NULL;
+
+    if (!is_opp_within_limits(opp, &ctx->frequency_limits))
+        return NULL;
+
+    return opp;
+}
+
 static int api_set_frequency(fwk_id_t domain_id, uint64_t frequency)
 {
     int status;
@@ -179,14 +197,10 @@ static int api_set_frequency(fwk_id_t domain_id, uint64_t frequency)
     if (ctx == NULL)
         return FWK_E_PARAM;
 
-    /* Only accept frequencies that exist in the operating point table */
-    new_opp = get_opp_for_values(ctx, frequency, 0);
+    new_opp = __mod_dvfs_get_valid_opp(ctx, frequency);
     if (new_opp == NULL)
         return FWK_E_RANGE;
 
-    if (!is_opp_within_limits(new_opp, &ctx->frequency_limits))
-        return FWK_E_RANGE;
-
     status = __mod_dvfs_set_opp(ctx, new_opp);
     if (status != FWK_SUCCESS)
         return status;
@@ -196,7 +210,33 @@ static int api_set_frequency(fwk_id_t domain_id, uint64_t frequency)
 
 static int api_set_frequency_async(fwk_id_t domain_id, uint64_t frequency)
 {
-    return FWK_E_SUPPORT;
+    int status;
+    struct fwk_event event;
+    struct mod_dvfs_event_params_set_frequency *params;
+
+    /* Ensure the identifier refers to an existing domain */
+    if (__mod_dvfs_get_valid_domain_ctx(domain_id) == NULL)
+        return FWK_E_PARAM;
+
+    /* Build and submit the event */
+    event = (struct fwk_event) {
+        .id = mod_dvfs_event_id_set_frequency,
+        .target_id = domain_id,
+        .response_requested = true,
+    };
+
+    params = (void *)&event.params;
+    *params = (struct mod_dvfs_event_params_set_frequency) {
+        .frequency = frequency,
+    };
+
+    status = fwk_thread_put_event(&event);
+    if (status == FWK_E_NOMEM)
+        return FWK_E_NOMEM;
+    else if (status != FWK_SUCCESS)
+        return FWK_E_PANIC;
+
+    return FWK_SUCCESS;
 }
 
 int api_get_frequency_limits(
@@ -9,8 +9,17 @@
 #define MOD_DVFS_DOMAIN_API_PRIVATE_H
 
 #include <mod_dvfs.h>
+#include <mod_dvfs_module_private.h>
 
 /* Module API implementation */
 extern const struct mod_dvfs_domain_api __mod_dvfs_domain_api;
 
+/*
+ * Get the operating point of a domain for a frequency, or NULL if there is
+ * none within the current limits
+ */
+const struct mod_dvfs_opp *__mod_dvfs_get_valid_opp(
+    const struct mod_dvfs_domain_ctx *ctx,
+    uint64_t frequency);
+
 #endif /* MOD_DVFS_DOMAIN_API_PRIVATE_H */
@@ -6,13 +6,124 @@
  */
 
 #include <fwk_macros.h>
+#include <fwk_thread.h>
+#include <mod_clock.h>
 #include <mod_dvfs_private.h>
+#include <mod_psu.h>
+
+static int set_rate(const struct mod_dvfs_domain_ctx *ctx, uint64_t frequency)
+{
+    int status;
+
+    status = ctx->apis.clock->set_rate(
+        ctx->config->clock_id,
+        frequency,
+        MOD_CLOCK_ROUND_MODE_NONE);
+    if (status != FWK_SUCCESS)
+        return FWK_E_DEVICE;
+
+    return FWK_SUCCESS;
+}
+
+static int respond(struct mod_dvfs_domain_ctx *ctx, int status)
+{
+    struct fwk_event response;
+    struct mod_dvfs_event_params_set_frequency_response *response_params;
+
+    response = (struct fwk_event) {
+        .id = mod_dvfs_event_id_set_frequency,
+        .target_id = ctx->request.requester_id,
+        .cookie = ctx->request.cookie,
+        .is_response = true,
+        .is_delayed_response = true,
+    };
+
+    response_params = (void *)&response.params;
+    response_params->status = status;
+
+    ctx->request.stage = MOD_DVFS_REQUEST_STAGE_IDLE;
+
+    return fwk_thread_put_event(&response);
+}
 
 static int event_set_opp(
     const struct fwk_event *event,
     struct fwk_event *response)
 {
-    return FWK_E_SUPPORT;
+    int status;
+    struct mod_dvfs_domain_ctx *ctx;
+    const struct mod_dvfs_event_params_set_frequency *params;
+    struct mod_dvfs_event_params_set_frequency_response *response_params;
+    const struct mod_dvfs_opp *new_opp;
+    struct mod_dvfs_opp current_opp;
+    enum mod_dvfs_request_stage stage;
+
+    /* Explicitly cast to our parameter types */
+    params = (void *)&event->params;
+    response_params = (void *)&response->params;
+
+    ctx = __mod_dvfs_get_valid_domain_ctx(event->target_id);
+    if (ctx == NULL)
+        return FWK_E_PARAM;
+
+    /* Only one change can be in progress on a domain */
+    if (ctx->request.stage != MOD_DVFS_REQUEST_STAGE_IDLE) {
+        status = FWK_E_BUSY;
+        goto exit;
+    }
+
+    new_opp = __mod_dvfs_get_valid_opp(ctx, params->frequency);
+    if (new_opp == NULL) {
+        status = FWK_E_RANGE;
+        goto exit;
+    }
+
+    status = __mod_dvfs_get_current_opp(ctx, &current_opp);
+    if (status != FWK_SUCCESS)
+        goto exit;
+
+    if (new_opp->voltage > current_opp.voltage) {
+        /* Raise the voltage before raising the frequency */
+        if (new_opp->frequency != current_opp.frequency)
+            stage = MOD_DVFS_REQUEST_STAGE_RAISING_VOLTAGE;
+        else
+            stage = MOD_DVFS_REQUEST_STAGE_SETTING_VOLTAGE;
+    } else {
+        if (new_opp->frequency != current_opp.frequency) {
+            status = set_rate(ctx, new_opp->frequency);
+            if (status != FWK_SUCCESS)
+                goto exit;
+        }
+
+        if (new_opp->voltage == current_opp.voltage)
+            goto exit;
+
+        /* Lower the voltage after lowering the frequency */
+        stage = MOD_DVFS_REQUEST_STAGE_SETTING_VOLTAGE;
+    }
+
+    status = ctx->apis.psu->set_voltage_async(
+        ctx->config->psu_id,
+        new_opp->voltage);
+    if (status != FWK_SUCCESS) {
+        status = FWK_E_DEVICE;
+        goto exit;
+    }
+
+    /* The change resumes on the response of the power supply */
+    ctx->request.stage = stage;
+    ctx->request.opp = new_opp;
+    ctx->request.requester_id = event->source_id;
+    ctx->request.cookie = event->cookie;
+
+    response->is_delayed_response = true;
+
+    return FWK_SUCCESS;
+
+exit:
+    response_params->status = status;
+
+    return FWK_SUCCESS;
 }
 
 static int event_set_frequency_limits(
@@ -22,6 +133,38 @@ static int event_set_frequency_limits(
     return FWK_E_SUPPORT;
 }
 
+static int process_set_voltage_response(const struct fwk_event *event)
+{
+    int status;
+    struct mod_dvfs_domain_ctx *ctx;
+    const struct mod_psu_event_params_set_voltage_response *params;
+
+    params = (void *)&event->params;
+
+    ctx = __mod_dvfs_get_valid_domain_ctx(event->target_id);
+    if (ctx == NULL)
+        return FWK_E_PARAM;
+
+    switch (ctx->request.stage) {
+    case MOD_DVFS_REQUEST_STAGE_RAISING_VOLTAGE:
+        if (params->status != FWK_SUCCESS)
+            return respond(ctx, FWK_E_DEVICE);
+
+        status = set_rate(ctx, ctx->request.opp->frequency);
+
+        return respond(ctx, status);
+
+    case MOD_DVFS_REQUEST_STAGE_SETTING_VOLTAGE:
+        if (params->status != FWK_SUCCESS)
+            return respond(ctx, FWK_E_DEVICE);
+
+        return respond(ctx, FWK_SUCCESS);
+
+    default:
+        return FWK_E_STATE;
+    }
+}
+
 int __mod_dvfs_process_event(
     const struct fwk_event *event,
     struct fwk_event *response)
@@ -37,6 +180,14 @@ int __mod_dvfs_process_event(
 
     handler_t handler;
 
+    /* Continue a frequency change once the power supply has responded */
+    if (event->is_response) {
+        if (!fwk_id_is_equal(event->id, mod_psu_event_id_set_voltage))
+            return FWK_E_PARAM;
+
+        return process_set_voltage_response(event);
+    }
+
     /* Ensure we have a handler implemented for this event */
     handler = handlers[fwk_id_get_event_idx(event->id)];
     if (handler == NULL)
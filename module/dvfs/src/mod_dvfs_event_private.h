@@ -8,8 +8,14 @@
 #ifndef MOD_DVFS_EVENT_PRIVATE_H
 #define MOD_DVFS_EVENT_PRIVATE_H
 
+#include <stdint.h>
 #include <fwk_event.h>
 
+/* "Set frequency" event parameters */
+struct mod_dvfs_event_params_set_frequency {
+    uint64_t frequency;
+};
+
 /* Event handler */
 int __mod_dvfs_process_event(
     const struct fwk_event *event,
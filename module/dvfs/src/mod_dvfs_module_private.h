@@ -8,10 +8,23 @@
 #ifndef MOD_DVFS_MODULE_PRIVATE_H
 #define MOD_DVFS_MODULE_PRIVATE_H
 
+#include <stdint.h>
 #include <fwk_id.h>
 #include <mod_clock.h>
 #include <mod_psu.h>
 
+/* Stage of an asynchronous frequency change */
+enum mod_dvfs_request_stage {
+    /* No change in progress */
+    MOD_DVFS_REQUEST_STAGE_IDLE,
+
+    /* Raising the voltage, the frequency is set next */
+    MOD_DVFS_REQUEST_STAGE_RAISING_VOLTAGE,
+
+    /* Setting the voltage, last step of the change */
+    MOD_DVFS_REQUEST_STAGE_SETTING_VOLTAGE,
+};
+
 /* Domain context */
 struct mod_dvfs_domain_ctx {
     /* Domain configuration */
@@ -33,6 +46,19 @@ struct mod_dvfs_domain_ctx {
 
     /* Current operating point limits */
     struct mod_dvfs_frequency_limits frequency_limits;
+
+    /* Asynchronous frequency change */
+    struct {
+        /* Stage of the change */
+        enum mod_dvfs_request_stage stage;
+
+        /* Operating point to transition to */
+        const struct mod_dvfs_opp *opp;
+
+        /* Identifier of the requester, and cookie of its event */
+        fwk_id_t requester_id;
+        uint32_t cookie;
+    } request;
 };
 
 struct mod_dvfs_domain_ctx *__mod_dvfs_get_valid_domain_ctx(fwk_id_t domain_id);
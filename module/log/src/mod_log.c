@@ -361,6 +361,63 @@ static int log_bind(fwk_id_t id, unsigned int round)
     return FWK_SUCCESS;
 }
 
+#ifdef BUILD_HAS_MM_ACCOUNTING
+static int log_mm_usage(void)
+{
+    int status;
+    unsigned int module_idx;
+    fwk_id_t module_id;
+    struct fwk_mm_stats stats;
+    struct fwk_mm_usage usage;
+
+    status = fwk_mm_get_stats(&stats);
+    if (status != FWK_SUCCESS)
+        return status;
+
+    status = do_log(MOD_LOG_GROUP_INFO,
+                    "[LOG] Heap: %u bytes, %u allocated, %u padding, "
+                    "%u free\n", (unsigned int)stats.heap_size,
+                    (unsigned int)stats.usage.allocated_size,
+                    (unsigned int)stats.usage.padding_size,
+                    (unsigned int)stats.free_size);
+    if (status != FWK_SUCCESS)
+        return status;
+
+    for (module_idx = 0;; module_idx++) {
+        module_id = FWK_ID_MODULE(module_idx);
+        if (!fwk_module_is_valid_module_id(module_id))
+            break;
+
+        status = fwk_module_get_mm_usage(module_id, &usage);
+        if (status != FWK_SUCCESS)
+            return status;
+
+        status = do_log(MOD_LOG_GROUP_INFO,
+                        "[LOG]   %s: %u allocated, %u padding\n",
+                        fwk_module_get_name(module_id),
+                        (unsigned int)usage.allocated_size,
+                        (unsigned int)usage.padding_size);
+        if (status != FWK_SUCCESS)
+            return status;
+    }
+
+    return do_flush();
+}
+#endif
+
+static int log_start(fwk_id_t id)
+{
+    #ifdef BUILD_HAS_MM_ACCOUNTING
+    /*
+     * The memory allocated by the modules starting after this one is not
+     * accounted in this report.
+     */
+    return log_mm_usage();
+    #else
+    return FWK_SUCCESS;
+    #endif
+}
+
 static int log_process_bind_request(fwk_id_t requester_id, fwk_id_t id,
     fwk_id_t api_id, const void **api)
 {
@@ -376,5 +433,6 @@ const struct fwk_module module_log = {
     .api_count = 1,
     .init = log_init,
     .bind = log_bind,
+    .start = log_start,
     .process_bind_request = log_process_bind_request,
 };
@@ -116,7 +116,7 @@ static int raise_interrupt(fwk_id_t slot_id)
     if (status != FWK_SUCCESS)
         return status;
 
-    device_ctx = &mhu_ctx.device_ctx_table[fwk_id_get_element_idx(slot_id)];
+    device_ctx = FWK_MODULE_ELEMENT_CTX(mhu_ctx.device_ctx_table, slot_id);
     slot = fwk_id_get_sub_element_idx(slot_id);
     reg = (struct mhu_reg *)device_ctx->config->out;
 
@@ -158,7 +158,7 @@ static int mhu_device_init(fwk_id_t device_id, unsigned int slot_count,
     if ((config->in == 0) || (config->out == 0))
         return FWK_E_PARAM;
 
-    device_ctx = &mhu_ctx.device_ctx_table[fwk_id_get_element_idx(device_id)];
+    device_ctx = FWK_MODULE_ELEMENT_CTX(mhu_ctx.device_ctx_table, device_id);
 
     device_ctx->smt_channel_table = fwk_mm_calloc(slot_count,
         sizeof(device_ctx->smt_channel_table[0]));
@@ -179,7 +179,7 @@ static int mhu_bind(fwk_id_t id, unsigned int round)
     struct mhu_smt_channel *smt_channel;
 
     if ((round == 1) && fwk_id_is_type(id, FWK_ID_TYPE_ELEMENT)) {
-        device_ctx = &mhu_ctx.device_ctx_table[fwk_id_get_element_idx(id)];
+        device_ctx = FWK_MODULE_ELEMENT_CTX(mhu_ctx.device_ctx_table, id);
 
         for (slot = 0; slot < MHU_SLOT_COUNT_MAX; slot++) {
             if (!(device_ctx->bound_slots & (1 << slot)))
@@ -207,7 +207,7 @@ static int mhu_process_bind_request(fwk_id_t source_id, fwk_id_t target_id,
     if (!fwk_id_is_type(target_id, FWK_ID_TYPE_SUB_ELEMENT))
         return FWK_E_ACCESS;
 
-    device_ctx = &mhu_ctx.device_ctx_table[fwk_id_get_element_idx(target_id)];
+    device_ctx = FWK_MODULE_ELEMENT_CTX(mhu_ctx.device_ctx_table, target_id);
     slot = fwk_id_get_sub_element_idx(target_id);
 
     if (device_ctx->bound_slots & (1 << slot))
@@ -229,7 +229,7 @@ static int mhu_start(fwk_id_t id)
     if (fwk_id_get_type(id) == FWK_ID_TYPE_MODULE)
         return FWK_SUCCESS;
 
-    device_ctx = &mhu_ctx.device_ctx_table[fwk_id_get_element_idx(id)];
+    device_ctx = FWK_MODULE_ELEMENT_CTX(mhu_ctx.device_ctx_table, id);
 
     if (device_ctx->bound_slots != 0) {
         status = fwk_interrupt_set_isr(device_ctx->config->irq, &mhu_isr);
@@ -99,7 +99,7 @@ static int raise_interrupt(fwk_id_t slot_id)
     if (status != FWK_SUCCESS)
         return status;
 
-    channel_ctx = &ctx.channel_ctx_table[fwk_id_get_element_idx(slot_id)];
+    channel_ctx = FWK_MODULE_ELEMENT_CTX(ctx.channel_ctx_table, slot_id);
     slot = fwk_id_get_sub_element_idx(slot_id);
     send = channel_ctx->send;
 
@@ -160,7 +160,7 @@ static int mhu2_channel_init(fwk_id_t channel_id,
         return FWK_E_DATA;
     }
 
-    channel_ctx = &ctx.channel_ctx_table[fwk_id_get_element_idx(channel_id)];
+    channel_ctx = FWK_MODULE_ELEMENT_CTX(ctx.channel_ctx_table, channel_id);
     channel_ctx->send = (struct mhu2_send_reg *)config->send;
 
     if (config->channel >= channel_ctx->send->MSG_NO_CAP) {
@@ -192,7 +192,7 @@ static int mhu2_bind(fwk_id_t id, unsigned int round)
     struct mhu2_smt_channel *smt_channel;
 
     if ((round == 1) && fwk_id_is_type(id, FWK_ID_TYPE_ELEMENT)) {
-        channel_ctx = &ctx.channel_ctx_table[fwk_id_get_element_idx(id)];
+        channel_ctx = FWK_MODULE_ELEMENT_CTX(ctx.channel_ctx_table, id);
 
         for (slot = 0; slot < MHU_SLOT_COUNT_MAX; slot++) {
             if (!(channel_ctx->bound_slots & (1 << slot)))
@@ -232,7 +232,7 @@ static int mhu2_process_bind_request(fwk_id_t source_id,
         return FWK_E_ACCESS;
     }
 
-    channel_ctx = &ctx.channel_ctx_table[fwk_id_get_element_idx(target_id)];
+    channel_ctx = FWK_MODULE_ELEMENT_CTX(ctx.channel_ctx_table, target_id);
     slot = fwk_id_get_sub_element_idx(target_id);
 
     if (channel_ctx->bound_slots & (1 << slot)) {
@@ -257,7 +257,7 @@ static int mhu2_start(fwk_id_t id)
     if (fwk_id_get_type(id) == FWK_ID_TYPE_MODULE)
         return FWK_SUCCESS;
 
-    channel_ctx = &ctx.channel_ctx_table[fwk_id_get_element_idx(id)];
+    channel_ctx = FWK_MODULE_ELEMENT_CTX(ctx.channel_ctx_table, id);
 
     if (channel_ctx->bound_slots != 0) {
         status = fwk_interrupt_set_isr_param(channel_ctx->config->irq,
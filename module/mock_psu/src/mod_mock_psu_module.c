@@ -18,7 +18,7 @@ static struct mod_mock_psu_device_ctx (*device_ctx)[];
 static struct mod_mock_psu_device_ctx *get_device_ctx(
     fwk_id_t device_id)
 {
-    return &(*device_ctx)[fwk_id_get_element_idx(device_id)];
+    return FWK_MODULE_ELEMENT_CTX((*device_ctx), device_id);
 }
 
 static int mock_psu_init(
@@ -1223,7 +1223,7 @@ static int pd_get_domain_type(fwk_id_t pd_id, enum mod_pd_type *type)
     if (!fwk_module_is_valid_element_id(pd_id))
         return FWK_E_PARAM;
 
-    pd = &mod_pd_ctx.pd_ctx_table[fwk_id_get_element_idx(pd_id)];
+    pd = FWK_MODULE_ELEMENT_CTX(mod_pd_ctx.pd_ctx_table, pd_id);
 
     *type = pd->config->attributes.pd_type;
 
@@ -1245,7 +1245,7 @@ static int pd_get_domain_parent_id(fwk_id_t pd_id, fwk_id_t *parent_pd_id)
     if (!fwk_module_is_valid_element_id(pd_id))
         return FWK_E_PARAM;
 
-    pd = &mod_pd_ctx.pd_ctx_table[fwk_id_get_element_idx(pd_id)];
+    pd = FWK_MODULE_ELEMENT_CTX(mod_pd_ctx.pd_ctx_table, pd_id);
 
     *parent_pd_id = (pd->parent != NULL) ? pd->parent->id : FWK_ID_NONE;
 
@@ -1270,7 +1270,7 @@ static int pd_set_state(fwk_id_t pd_id, unsigned int state)
     if (status != FWK_SUCCESS)
         return status;
 
-    pd = &mod_pd_ctx.pd_ctx_table[fwk_id_get_element_idx(pd_id)];
+    pd = FWK_MODULE_ELEMENT_CTX(mod_pd_ctx.pd_ctx_table, pd_id);
 
     if (!is_valid_state(pd, state))
         return FWK_E_PARAM;
@@ -1306,7 +1306,7 @@ static int pd_set_state_async(fwk_id_t pd_id,
     if (status != FWK_SUCCESS)
         return status;
 
-    pd = &mod_pd_ctx.pd_ctx_table[fwk_id_get_element_idx(pd_id)];
+    pd = FWK_MODULE_ELEMENT_CTX(mod_pd_ctx.pd_ctx_table, pd_id);
 
     if (!is_valid_state(pd, state))
         return FWK_E_PARAM;
@@ -1341,7 +1341,7 @@ static int pd_set_composite_state(fwk_id_t pd_id, uint32_t composite_state)
     if (status != FWK_SUCCESS)
         return status;
 
-    pd = &mod_pd_ctx.pd_ctx_table[fwk_id_get_element_idx(pd_id)];
+    pd = FWK_MODULE_ELEMENT_CTX(mod_pd_ctx.pd_ctx_table, pd_id);
 
     if (!is_valid_composite_state(pd, composite_state))
         return FWK_E_PARAM;
@@ -1375,7 +1375,7 @@ static int pd_set_composite_state_async(fwk_id_t pd_id,
     if (status != FWK_SUCCESS)
         return status;
 
-    pd = &mod_pd_ctx.pd_ctx_table[fwk_id_get_element_idx(pd_id)];
+    pd = FWK_MODULE_ELEMENT_CTX(mod_pd_ctx.pd_ctx_table, pd_id);
 
     if (!is_valid_composite_state(pd, composite_state))
         return FWK_E_PARAM;
@@ -1555,7 +1555,7 @@ static int pd_reset_async(fwk_id_t pd_id, bool response_requested)
     if (status != FWK_SUCCESS)
         return status;
 
-    pd = &mod_pd_ctx.pd_ctx_table[fwk_id_get_element_idx(pd_id)];
+    pd = FWK_MODULE_ELEMENT_CTX(mod_pd_ctx.pd_ctx_table, pd_id);
 
     req = (struct fwk_event) {
         .id = FWK_ID_EVENT(FWK_MODULE_IDX_POWER_DOMAIN, PD_EVENT_IDX_RESET),
@@ -1594,7 +1594,7 @@ static int pd_report_power_state_transition(fwk_id_t pd_id, unsigned int state)
     if (status != FWK_SUCCESS)
         return status;
 
-    pd = &mod_pd_ctx.pd_ctx_table[fwk_id_get_element_idx(pd_id)];
+    pd = FWK_MODULE_ELEMENT_CTX(mod_pd_ctx.pd_ctx_table, pd_id);
 
     return report_power_state_transition(pd, state);
 }
@@ -1663,7 +1663,7 @@ static int pd_power_domain_init(fwk_id_t pd_id, unsigned int unused,
     struct pd_ctx *pd;
     unsigned int state;
 
-    pd = &mod_pd_ctx.pd_ctx_table[fwk_id_get_element_idx(pd_id)];
+    pd = FWK_MODULE_ELEMENT_CTX(mod_pd_ctx.pd_ctx_table, pd_id);
 
     if (!is_valid_tree_pos(pd_config->tree_pos))
         return FWK_E_PARAM;
@@ -1725,7 +1725,7 @@ static int pd_bind(fwk_id_t id, unsigned int round)
             FWK_ID_API(FWK_MODULE_IDX_LOG, 0), &mod_pd_ctx.log_api);
     }
 
-    pd = &mod_pd_ctx.pd_ctx_table[fwk_id_get_element_idx(id)];
+    pd = FWK_MODULE_ELEMENT_CTX(mod_pd_ctx.pd_ctx_table, id);
     config = pd->config;
 
     status = fwk_module_bind(config->driver_id, config->api_id, &driver_api);
@@ -1825,7 +1825,7 @@ static int pd_process_bind_request(fwk_id_t source_id, fwk_id_t target_id,
     case MOD_PD_API_IDX_DRIVER_INPUT:
         if (!fwk_id_is_type(target_id, FWK_ID_TYPE_ELEMENT))
             return FWK_E_ACCESS;
-        pd = &mod_pd_ctx.pd_ctx_table[fwk_id_get_element_idx(target_id)];
+        pd = FWK_MODULE_ELEMENT_CTX(mod_pd_ctx.pd_ctx_table, target_id);
         if (!fwk_id_is_equal(source_id, pd->driver_id))
             return FWK_E_ACCESS;
         *api = &pd_driver_input_api;
@@ -1844,7 +1844,7 @@ static int pd_process_event(const struct fwk_event *event,
     struct pd_ctx *pd = NULL;
 
     if (fwk_id_is_type(event->target_id, FWK_ID_TYPE_ELEMENT))
-        pd = &mod_pd_ctx.pd_ctx_table[fwk_id_get_element_idx(event->target_id)];
+        pd = FWK_MODULE_ELEMENT_CTX(mod_pd_ctx.pd_ctx_table, event->target_id);
 
     switch (fwk_id_get_event_idx(event->id)) {
     case PD_EVENT_IDX_SET_STATE:
@@ -1952,7 +1952,10 @@ static int process_power_state_pre_transition_notification_response(
 static int process_power_state_transition_notification_response(
     struct pd_ctx *pd)
 {
-    struct fwk_event notification_event;
+    struct fwk_event notification_event = {
+        .id = mod_pd_notification_id_power_state_transition,
+        .response_requested = true
+    };
     struct mod_pd_power_state_transition_notification_params *params;
 
     if (pd->power_state_transition_notification_ctx.pending_responses == 0) {
@@ -1971,8 +1974,6 @@ static int process_power_state_transition_notification_response(
      * While receiving the responses, the power state of the power domain
      * has changed. Send a notification for the current power state.
      */
-    notification_event.id = mod_pd_notification_id_power_state_transition;
-    notification_event.response_requested = true;
     params = (struct mod_pd_power_state_transition_notification_params *)
         notification_event.params;
     params->state = pd->current_state;
@@ -2000,7 +2001,7 @@ static int pd_process_notification(const struct fwk_event *event,
         return FWK_E_PARAM;
     }
 
-    pd = &mod_pd_ctx.pd_ctx_table[fwk_id_get_element_idx(event->target_id)];
+    pd = FWK_MODULE_ELEMENT_CTX(mod_pd_ctx.pd_ctx_table, event->target_id);
 
     if (fwk_id_is_equal(event->id,
                         mod_pd_notification_id_power_state_transition))
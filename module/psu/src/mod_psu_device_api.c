@@ -82,7 +82,7 @@ static int api_set_enabled_async(fwk_id_t device_id, bool enable)
         return FWK_E_PARAM;
 
     /* Ensure the identifier refers to an existing element */
-    if (fwk_module_is_valid_element_id(device_id))
+    if (!fwk_module_is_valid_element_id(device_id))
         return FWK_E_PARAM;
 
     /* Validate the API call */
@@ -183,7 +183,7 @@ static int api_set_voltage_async(fwk_id_t device_id, uintmax_t voltage)
         return FWK_E_PARAM;
 
     /* Ensure the identifier refers to an existing element */
-    if (fwk_module_is_valid_element_id(device_id))
+    if (!fwk_module_is_valid_element_id(device_id))
         return FWK_E_PARAM;
 
     /* Validate the API call */
@@ -193,7 +193,7 @@ static int api_set_voltage_async(fwk_id_t device_id, uintmax_t voltage)
 
     /* Build and submit the event */
     event = (struct fwk_event) {
-        .id = mod_psu_event_id_set_enabled,
+        .id = mod_psu_event_id_set_voltage,
         .target_id = device_id,
         .response_requested = true,
     };
@@ -11,18 +11,22 @@
 #ifndef MOD_INTERNAL_SCMI_H
 #define MOD_INTERNAL_SCMI_H
 
+#include <stdbool.h>
 #include <stddef.h>
 #include <stdint.h>
 #include <mod_scmi.h>
 
 #define SCMI_VERSION 0x10000
 
-#define SCMI_MESSAGE_HEADER_MESSAGE_ID_POS  0
-#define SCMI_MESSAGE_HEADER_PROTOCOL_ID_POS 10
-#define SCMI_MESSAGE_HEADER_TOKEN_POS       18
+#define SCMI_MESSAGE_HEADER_MESSAGE_ID_POS   0
+#define SCMI_MESSAGE_HEADER_MESSAGE_TYPE_POS 8
+#define SCMI_MESSAGE_HEADER_PROTOCOL_ID_POS  10
+#define SCMI_MESSAGE_HEADER_TOKEN_POS        18
 
 #define SCMI_MESSAGE_HEADER_MESSAGE_ID_MASK \
     (UINT32_C(0x3FF) << SCMI_MESSAGE_HEADER_MESSAGE_ID_POS)
+#define SCMI_MESSAGE_HEADER_MESSAGE_TYPE_MASK \
+    (UINT32_C(0x3) << SCMI_MESSAGE_HEADER_MESSAGE_TYPE_POS)
 #define SCMI_MESSAGE_HEADER_PROTOCOL_ID_MASK \
     (UINT32_C(0xFF)  << SCMI_MESSAGE_HEADER_PROTOCOL_ID_POS)
 #define SCMI_MESSAGE_HEADER_TOKEN_MASK  \
@@ -36,6 +40,31 @@
     (((TOKEN) << SCMI_MESSAGE_HEADER_TOKEN_POS) & \
         SCMI_MESSAGE_HEADER_TOKEN_POS))
 
+/* SCMI message types */
+#define SCMI_MESSAGE_TYPE_COMMAND          0
+#define SCMI_MESSAGE_TYPE_DELAYED_RESPONSE 2
+
+/* SCMI event indices */
+enum scmi_event_idx {
+    /* A message was signaled on a service */
+    SCMI_EVENT_IDX_MESSAGE,
+
+    /* Send the deferred response of the message of a service */
+    SCMI_EVENT_IDX_RESPOND,
+
+    /* Number of defined events */
+    SCMI_EVENT_IDX_COUNT
+};
+
+/* "Respond" event parameters */
+struct scmi_event_params_respond {
+    /* Payload of the response */
+    uint32_t payload[MOD_SCMI_DEFERRED_RESPONSE_MAX_SIZE / sizeof(uint32_t)];
+
+    /* Size of the payload in bytes */
+    uint32_t size;
+};
+
 /* SCMI service context */
 struct scmi_service_ctx {
     /* Pointer to SCMI service configuration data */
@@ -58,6 +87,18 @@ struct scmi_service_ctx {
 
     /* SCMI identifier of the message currently being processed */
     unsigned int scmi_message_id;
+
+    /* Header of the message currently being processed */
+    uint32_t message_header;
+
+    /* Flag indicating whether a message is awaiting its response */
+    bool response_pending;
+
+    /*
+     * Number of messages signaled while a message was awaiting its response,
+     * and whose processing is postponed until the response is sent.
+     */
+    unsigned int postponed_message_count;
 };
 
 #endif /* MOD_INTERNAL_SCMI_H */
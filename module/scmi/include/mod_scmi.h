@@ -129,6 +129,20 @@ struct mod_scmi_service_config {
      *        module configuration data.
      */
     unsigned int scmi_agent_id;
+
+    /*!
+     * \brief Identifier of the service of the platform to agent (P2A)
+     *      channel of the agent.
+     *
+     * \details The delayed responses to the asynchronous commands received
+     *      through this service are sent through the P2A service. The transport
+     *      of the P2A service must implement the
+     *      \ref mod_scmi_to_transport_api.transmit function.
+     *
+     *      May be left zero-initialized (FWK_ID_TYPE_NONE), in which case the
+     *      agent cannot issue asynchronous commands through this service.
+     */
+    fwk_id_t p2a_service_id;
 };
 
 /*!
@@ -232,6 +246,30 @@ struct mod_scmi_to_transport_api {
      * errors.
      */
     int (*respond)(fwk_id_t channel_id, const void *payload, size_t size);
+
+    /*!
+     * \brief Send a message from the platform to the agent on a channel.
+     *
+     * \details Used on the platform to agent (P2A) channels, for delayed
+     *      responses and notifications. The transport entity may leave this
+     *      function unimplemented, in which case the pointer is NULL.
+     *
+     * \param channel_id Channel identifier.
+     * \param message_header SCMI message header.
+     * \param payload Payload data to write. May be NULL when \p size is equal
+     *      to zero.
+     * \param size Size of the payload data.
+     *
+     * \retval FWK_SUCCESS The operation succeeded.
+     * \retval FWK_E_PARAM The channel_id parameter is invalid.
+     * \retval FWK_E_PARAM The payload does not fit in the channel.
+     * \retval FWK_E_SUPPORT The channel is not a P2A channel.
+     * \retval FWK_E_BUSY The agent has not consumed the previous messages yet.
+     * \return One of the standard error codes for implementation-defined
+     * errors.
+     */
+    int (*transmit)(fwk_id_t channel_id, uint32_t message_header,
+                    const void *payload, size_t size);
 };
 
 /*!
@@ -264,6 +302,12 @@ struct mod_scmi_from_transport_api {
  *      an internal failure, the SCMI command is expected to return the status
  *      code SCMI_GENERIC_ERROR per the specification.
  *
+ * \note The handler may return without responding to the message, and respond
+ *      later with \ref mod_scmi_from_protocol_api::respond_deferred once the
+ *      command has completed, for instance when it is notified by an
+ *      asynchronous request it issued. The next messages received through the
+ *      service are then processed once the response is sent.
+ *
  * \param protocol_id Identifier of the protocol module.
  * \param service_id Identifer of the SCMI service which received the message.
  * \param payload Pointer to the message payload.
@@ -302,6 +346,11 @@ struct mod_scmi_to_protocol_api {
     mod_scmi_message_handler_t *message_handler;
 };
 
+/*!
+ * \brief Maximum size in bytes of the payload of a deferred response.
+ */
+#define MOD_SCMI_DEFERRED_RESPONSE_MAX_SIZE 12
+
 /*!
  * \brief SCMI protocol module to SCMI module API.
  */
@@ -320,6 +369,18 @@ struct mod_scmi_from_protocol_api {
      */
      int (*get_agent_id)(fwk_id_t service_id, unsigned int *agent_id);
 
+    /*!
+     * \brief Get the number of agents in the system.
+     *
+     * \details The agent identifiers range from one to the number of agents.
+     *
+     * \param agent_count Pointer to storage for the number of agents.
+     *
+     * \retval FWK_SUCCESS The number of agents was returned.
+     * \retval FWK_E_PARAM The parameter 'agent_count' is equal to NULL.
+     */
+     int (*get_agent_count)(unsigned int *agent_count);
+
     /*!
      * \brief Get the type of the agent given its identifier.
      *
@@ -374,12 +435,92 @@ struct mod_scmi_from_protocol_api {
     /*!
      * \brief Respond to an SCMI message on a service.
      *
+     * \note Only called from the message handler of the protocol, while the
+     *      service processes the message.
+     *
      * \param service_id Service identifier.
      * \param payload Payload data to write, or NULL if a payload has already
      * been written.
      * \param size Size of the payload.
      */
     void (*respond)(fwk_id_t service_id, const void *payload, size_t size);
+
+    /*!
+     * \brief Respond to an SCMI message on a service after the message
+     *      handler of the protocol returned without responding.
+     *
+     * \details The response is sent by the service when it processes the
+     *      event this function puts, in sequence with the messages it
+     *      receives.
+     *
+     * \param service_id Service identifier.
+     * \param payload Payload data of the response.
+     * \param size Size of the payload, at most
+     *      \ref MOD_SCMI_DEFERRED_RESPONSE_MAX_SIZE bytes.
+     *
+     * \retval FWK_SUCCESS The response will be sent.
+     * \retval FWK_E_PARAM The payload parameter is NULL.
+     * \retval FWK_E_PARAM The payload is too large.
+     * \return One of the standard error codes for implementation-defined
+     *      errors.
+     */
+    int (*respond_deferred)(fwk_id_t service_id, const void *payload,
+                            size_t size);
+
+    /*!
+     * \brief Get the header of the message being processed on a service.
+     *
+     * \details The header identifies the command, token included, the delayed
+     *      response of an asynchronous command is sent for.
+     *
+     * \param service_id Service identifier.
+     * \param [out] message_header Header of the message.
+     *
+     * \retval FWK_SUCCESS The operation succeeded.
+     * \retval FWK_E_PARAM The message_header parameter is NULL.
+     * \return One of the standard error codes for implementation-defined
+     *      errors.
+     */
+    int (*get_message_header)(fwk_id_t service_id, uint32_t *message_header);
+
+    /*!
+     * \brief Check whether asynchronous commands can be accepted on a
+     *      service.
+     *
+     * \param service_id Service identifier.
+     * \param [out] supported true if a delayed response can be sent to the
+     *      agent of the service, false otherwise.
+     *
+     * \retval FWK_SUCCESS The operation succeeded.
+     * \retval FWK_E_PARAM The supported parameter is NULL.
+     * \return One of the standard error codes for implementation-defined
+     *      errors.
+     */
+    int (*get_delayed_response_support)(fwk_id_t service_id,
+                                        bool *supported);
+
+    /*!
+     * \brief Send the delayed response of an asynchronous command.
+     *
+     * \details The delayed response is sent through the P2A service of the
+     *      agent the command was received from.
+     *
+     * \param service_id Identifier of the service the command was received
+     *      through.
+     * \param message_header Header of the command, as returned by
+     *      \ref get_message_header while the command was being processed.
+     * \param payload Payload of the delayed response.
+     * \param size Size of the payload.
+     *
+     * \retval FWK_SUCCESS The operation succeeded.
+     * \retval FWK_E_SUPPORT The agent has no P2A service.
+     * \retval FWK_E_BUSY The agent has not consumed the previous messages sent
+     *      through its P2A service yet.
+     * \return One of the standard error codes for implementation-defined
+     *      errors.
+     */
+    int (*send_delayed_response)(fwk_id_t service_id, uint32_t message_header,
+                                 const void *payload, size_t size);
 };
 
 
@@ -18,6 +18,7 @@
 #include <fwk_module.h>
 #include <fwk_module_idx.h>
 #include <fwk_multi_thread.h>
+#include <fwk_thread.h>
 #include <internal/mod_scmi.h>
 #include <internal/scmi.h>
 #include <internal/scmi_base.h>
@@ -151,7 +152,7 @@ static int signal_message(fwk_id_t service_id)
         return status;
 
     event = (struct fwk_event) {
-        .id = FWK_ID_EVENT(FWK_MODULE_IDX_SCMI, 0),
+        .id = FWK_ID_EVENT(FWK_MODULE_IDX_SCMI, SCMI_EVENT_IDX_MESSAGE),
         .source_id = FWK_ID_MODULE(FWK_MODULE_IDX_SCMI),
         .target_id = service_id,
     };
@@ -179,13 +180,23 @@ static int get_agent_id(fwk_id_t service_id, unsigned int *agent_id)
     if (agent_id == NULL)
         return FWK_E_PARAM;
 
-    ctx = &scmi_ctx.service_ctx_table[fwk_id_get_element_idx(service_id)];
+    ctx = FWK_MODULE_ELEMENT_CTX(scmi_ctx.service_ctx_table, service_id);
 
     *agent_id = ctx->config->scmi_agent_id;
 
     return FWK_SUCCESS;
 }
 
+static int get_agent_count(unsigned int *agent_count)
+{
+    if (agent_count == NULL)
+        return FWK_E_PARAM;
+
+    *agent_count = scmi_ctx.config->agent_count;
+
+    return FWK_SUCCESS;
+}
+
 static int get_agent_type(uint32_t scmi_agent_id,
                           enum scmi_agent_type *agent_type)
 {
@@ -211,7 +222,7 @@ static int get_max_payload_size(fwk_id_t service_id, size_t *size)
     if (size == NULL)
         return FWK_E_PARAM;
 
-    ctx = &scmi_ctx.service_ctx_table[fwk_id_get_element_idx(service_id)];
+    ctx = FWK_MODULE_ELEMENT_CTX(scmi_ctx.service_ctx_table, service_id);
 
     return ctx->transport_api->get_max_payload_size(ctx->transport_id, size);
 }
@@ -226,7 +237,7 @@ static int write_payload(fwk_id_t service_id, size_t offset,
     if (status != FWK_SUCCESS)
         return status;
 
-    ctx = &scmi_ctx.service_ctx_table[fwk_id_get_element_idx(service_id)];
+    ctx = FWK_MODULE_ELEMENT_CTX(scmi_ctx.service_ctx_table, service_id);
 
     return ctx->transport_api->write_payload(ctx->transport_id,
                                              offset, payload, size);
@@ -235,13 +246,13 @@ static int write_payload(fwk_id_t service_id, size_t offset,
 static void respond(fwk_id_t service_id, const void *payload, size_t size)
 {
     int status;
-    const struct scmi_service_ctx *ctx;
+    struct scmi_service_ctx *ctx;
 
     status = fwk_module_check_call(service_id);
     if (status != FWK_SUCCESS)
         return;
 
-    ctx = &scmi_ctx.service_ctx_table[fwk_id_get_element_idx(service_id)];
+    ctx = FWK_MODULE_ELEMENT_CTX(scmi_ctx.service_ctx_table, service_id);
 
     /*
      * Print to the error log if the message was not successfully processed.
@@ -260,14 +271,152 @@ static void respond(fwk_id_t service_id, const void *payload, size_t size)
     if (status != FWK_SUCCESS)
         scmi_ctx.log_api->log(MOD_LOG_GROUP_ERROR,
             "[SCMI] Failed to send response (%e)\n", status);
+
+    if (!ctx->response_pending)
+        return;
+
+    ctx->response_pending = false;
+
+    /* Resume the processing of the messages received in the meantime */
+    if (ctx->postponed_message_count != 0) {
+        ctx->postponed_message_count--;
+
+        status = signal_message(service_id);
+        if (status != FWK_SUCCESS)
+            scmi_ctx.log_api->log(MOD_LOG_GROUP_ERROR,
+                "[SCMI] Failed to resume message processing (%e)\n", status);
+    }
+}
+
+static int respond_deferred(fwk_id_t service_id, const void *payload,
+                            size_t size)
+{
+    int status;
+    struct fwk_event event;
+    struct scmi_event_params_respond *params;
+
+    static_assert(sizeof(struct scmi_event_params_respond) <=
+        FWK_EVENT_PARAMETERS_SIZE,
+        "[SCMI] Deferred response does not fit in the event parameters");
+
+    status = fwk_module_check_call(service_id);
+    if (status != FWK_SUCCESS)
+        return status;
+
+    if ((payload == NULL) || (size > MOD_SCMI_DEFERRED_RESPONSE_MAX_SIZE))
+        return FWK_E_PARAM;
+
+    /*
+     * The response is sent by the service, the fields of its context that
+     * track the pending response being only accessed by its event handler.
+     */
+    event = (struct fwk_event) {
+        .id = FWK_ID_EVENT(FWK_MODULE_IDX_SCMI, SCMI_EVENT_IDX_RESPOND),
+        .target_id = service_id,
+    };
+
+    params = (struct scmi_event_params_respond *)event.params;
+    memcpy(params->payload, payload, size);
+    params->size = size;
+
+    return fwk_thread_put_event(&event);
+}
+
+static int get_message_header(fwk_id_t service_id, uint32_t *message_header)
+{
+    int status;
+    const struct scmi_service_ctx *ctx;
+
+    status = fwk_module_check_call(service_id);
+    if (status != FWK_SUCCESS)
+        return status;
+
+    if (message_header == NULL)
+        return FWK_E_PARAM;
+
+    ctx = FWK_MODULE_ELEMENT_CTX(scmi_ctx.service_ctx_table, service_id);
+
+    *message_header = ctx->message_header;
+
+    return FWK_SUCCESS;
+}
+
+/*
+ * Get the context of the P2A service of the agent of a service.
+ *
+ * \return A pointer to the context of the P2A service, NULL if the agent has
+ *      no P2A service able to send delayed responses.
+ */
+static struct scmi_service_ctx *get_p2a_service_ctx(
+    const struct scmi_service_ctx *ctx)
+{
+    struct scmi_service_ctx *p2a_ctx;
+
+    if (fwk_id_is_type(ctx->config->p2a_service_id, FWK_ID_TYPE_NONE))
+        return NULL;
+
+    p2a_ctx = FWK_MODULE_ELEMENT_CTX(scmi_ctx.service_ctx_table,
+                                     ctx->config->p2a_service_id);
+    if (p2a_ctx->transport_api->transmit == NULL)
+        return NULL;
+
+    return p2a_ctx;
+}
+
+static int get_delayed_response_support(fwk_id_t service_id, bool *supported)
+{
+    int status;
+    const struct scmi_service_ctx *ctx;
+
+    status = fwk_module_check_call(service_id);
+    if (status != FWK_SUCCESS)
+        return status;
+
+    if (supported == NULL)
+        return FWK_E_PARAM;
+
+    ctx = FWK_MODULE_ELEMENT_CTX(scmi_ctx.service_ctx_table, service_id);
+
+    *supported = (get_p2a_service_ctx(ctx) != NULL);
+
+    return FWK_SUCCESS;
+}
+
+static int send_delayed_response(fwk_id_t service_id, uint32_t message_header,
+                                 const void *payload, size_t size)
+{
+    int status;
+    const struct scmi_service_ctx *ctx, *p2a_ctx;
+
+    status = fwk_module_check_call(service_id);
+    if (status != FWK_SUCCESS)
+        return status;
+
+    ctx = FWK_MODULE_ELEMENT_CTX(scmi_ctx.service_ctx_table, service_id);
+
+    p2a_ctx = get_p2a_service_ctx(ctx);
+    if (p2a_ctx == NULL)
+        return FWK_E_SUPPORT;
+
+    message_header = (message_header & ~SCMI_MESSAGE_HEADER_MESSAGE_TYPE_MASK) |
+        (SCMI_MESSAGE_TYPE_DELAYED_RESPONSE <<
+         SCMI_MESSAGE_HEADER_MESSAGE_TYPE_POS);
+
+    return p2a_ctx->transport_api->transmit(p2a_ctx->transport_id,
+                                            message_header, payload, size);
 }
 
 static const struct mod_scmi_from_protocol_api mod_scmi_from_protocol_api = {
     .get_agent_id = get_agent_id,
+    .get_agent_count = get_agent_count,
     .get_agent_type = get_agent_type,
     .get_max_payload_size = get_max_payload_size,
     .write_payload = write_payload,
     .respond = respond,
+    .respond_deferred = respond_deferred,
+    .get_message_header = get_message_header,
+    .get_delayed_response_support = get_delayed_response_support,
+    .send_delayed_response = send_delayed_response,
 };
 
 /*
@@ -610,7 +759,13 @@ static int scmi_service_init(fwk_id_t service_id, unsigned int unused,
         (config->scmi_agent_id > scmi_ctx.config->agent_count))
         return FWK_E_PARAM;
 
-    ctx = &scmi_ctx.service_ctx_table[fwk_id_get_element_idx(service_id)];
+    if (!fwk_id_is_type(config->p2a_service_id, FWK_ID_TYPE_NONE) &&
+        ((fwk_id_get_module_idx(config->p2a_service_id) !=
+          FWK_MODULE_IDX_SCMI) ||
+         !fwk_module_is_valid_element_id(config->p2a_service_id)))
+        return FWK_E_PARAM;
+
+    ctx = FWK_MODULE_ELEMENT_CTX(scmi_ctx.service_ctx_table, service_id);
     ctx->config = config;
 
     return fwk_thread_create(service_id);
@@ -633,7 +788,7 @@ static int scmi_bind(fwk_id_t id, unsigned int round)
                                    &scmi_ctx.log_api);
         }
 
-        ctx = &scmi_ctx.service_ctx_table[fwk_id_get_element_idx(id)];
+        ctx = FWK_MODULE_ELEMENT_CTX(scmi_ctx.service_ctx_table, id);
         status = fwk_module_bind(ctx->config->transport_id,
                                  ctx->config->transport_api_id, &transport_api);
         if (status != FWK_SUCCESS)
@@ -711,7 +866,7 @@ static int scmi_process_bind_request(fwk_id_t source_id, fwk_id_t target_id,
         if (!fwk_id_is_type(target_id, FWK_ID_TYPE_ELEMENT))
             return FWK_E_SUPPORT;
 
-        ctx = &scmi_ctx.service_ctx_table[fwk_id_get_element_idx(target_id)];
+        ctx = FWK_MODULE_ELEMENT_CTX(scmi_ctx.service_ctx_table, target_id);
         if (!fwk_id_is_equal(source_id, ctx->transport_id))
             return FWK_E_ACCESS;
 
@@ -725,6 +880,24 @@ static int scmi_process_bind_request(fwk_id_t source_id, fwk_id_t target_id,
     return FWK_SUCCESS;
 }
 
+static int scmi_process_respond_event(const struct fwk_event *event)
+{
+    const struct scmi_service_ctx *ctx;
+    const struct scmi_event_params_respond *params;
+
+    ctx = FWK_MODULE_ELEMENT_CTX(scmi_ctx.service_ctx_table, event->target_id);
+    params = (const struct scmi_event_params_respond *)event->params;
+
+    if (!ctx->response_pending)
+        return FWK_E_STATE;
+
+    fwk_thread_begin_exclusive();
+    respond(event->target_id, params->payload, params->size);
+    fwk_thread_end_exclusive();
+
+    return FWK_SUCCESS;
+}
+
 static int scmi_process_event(const struct fwk_event *event,
                               struct fwk_event *resp)
 {
@@ -738,26 +911,47 @@ static int scmi_process_event(const struct fwk_event *event,
     unsigned int protocol_idx;
     struct scmi_protocol *protocol;
 
-    ctx = &scmi_ctx.service_ctx_table[fwk_id_get_element_idx(event->target_id)];
+    if (fwk_id_get_event_idx(event->id) == SCMI_EVENT_IDX_RESPOND)
+        return scmi_process_respond_event(event);
+
+    /*
+     * The events of the different services may be processed concurrently (see
+     * fwk_module::concurrent_event_processing). Only the context of the
+     * service, the tables that are read-only once the modules are bound and
+     * the message of the channel of the service are accessed concurrently.
+     * The calls to the other modules, except to read the message from the
+     * transport channel, are made in an exclusive section.
+     */
+    ctx = FWK_MODULE_ELEMENT_CTX(scmi_ctx.service_ctx_table, event->target_id);
     transport_api = ctx->transport_api;
     transport_id = ctx->transport_id;
 
+    /*
+     * A protocol is still to respond to the previous message. The message is
+     * processed once the response has been sent.
+     */
+    if (ctx->response_pending) {
+        ctx->postponed_message_count++;
+        return FWK_SUCCESS;
+    }
+
     status = transport_api->get_message_header(transport_id, &message_header);
-    if (status != FWK_SUCCESS) {
-        scmi_ctx.log_api->log(MOD_LOG_GROUP_ERROR,
-            "[SCMI] Unable to read message header\n");
-        return status;
+    if (status == FWK_SUCCESS) {
+        status = transport_api->get_payload(transport_id, &payload,
+                                            &payload_size);
     }
 
-    status = transport_api->get_payload(transport_id, &payload, &payload_size);
+    fwk_thread_begin_exclusive();
+
     if (status != FWK_SUCCESS) {
         scmi_ctx.log_api->log(MOD_LOG_GROUP_ERROR,
-            "[SCMI] Unable to read message payload\n");
-        return status;
+            "[SCMI] Unable to read message (%e)\n", status);
+        goto exit;
     }
 
     ctx->scmi_protocol_id = read_protocol_id(message_header);
     ctx->scmi_message_id = read_message_id(message_header);
+    ctx->message_header = message_header;
 
     protocol_idx = scmi_ctx.scmi_protocol_id_to_idx[ctx->scmi_protocol_id];
 
@@ -766,10 +960,11 @@ static int scmi_process_event(const struct fwk_event *event,
             "[SCMI] Protocol 0x%x not supported\n", ctx->scmi_protocol_id);
         ctx->respond(transport_id, &(int32_t) { SCMI_NOT_SUPPORTED },
                      sizeof(int32_t));
-        return FWK_SUCCESS;
+        goto exit;
     }
 
     protocol = &scmi_ctx.protocol_table[protocol_idx];
+    ctx->response_pending = true;
     status = protocol->message_handler(protocol->id, event->target_id,
         payload, payload_size, ctx->scmi_message_id);
 
@@ -777,20 +972,36 @@ static int scmi_process_event(const struct fwk_event *event,
         scmi_ctx.log_api->log(MOD_LOG_GROUP_ERROR,
             "[SCMI] Protocol 0x%x handler error (%e), message_id = 0x%x\n",
             ctx->scmi_protocol_id, status, ctx->scmi_message_id);
+
+        /*
+         * The handler failed without responding, respond on its behalf for
+         * the agent not to wait for a response forever and for the messages
+         * postponed in the meantime to be processed.
+         */
+        if (ctx->response_pending) {
+            respond(event->target_id, &(int32_t) { SCMI_GENERIC_ERROR },
+                    sizeof(int32_t));
+        }
+
+        status = FWK_SUCCESS;
     }
 
-    return FWK_SUCCESS;
+exit:
+    fwk_thread_end_exclusive();
+
+    return status;
 }
 
 /* SCMI module definition */
 const struct fwk_module module_scmi = {
     .name = "SCMI",
     .api_count = MOD_SCMI_API_IDX_COUNT,
-    .event_count = 1,
+    .event_count = SCMI_EVENT_IDX_COUNT,
     .type = FWK_MODULE_TYPE_SERVICE,
     .init = scmi_init,
     .element_init = scmi_service_init,
     .bind = scmi_bind,
     .process_bind_request = scmi_process_bind_request,
-    .process_event = scmi_process_event
+    .process_event = scmi_process_event,
+    .concurrent_event_processing = true,
 };
@@ -12,6 +12,7 @@
 #define MOD_SCMI_PERF_H
 
 #include <stddef.h>
+#include <stdint.h>
 
 /*!
  * \addtogroup GroupModules Modules
@@ -37,11 +38,59 @@ enum mod_scmi_perf_permissions {
     MOD_SCMI_PERF_PERMS_SET_LIMITS = (1 << 1),
 };
 
+/*!
+ * \brief Fast channel indices.
+ *
+ * \details A fast channel is a memory area shared with the agents through
+ *      which the performance level or the performance limits of a domain are
+ *      set or read without exchanging any message. The level fast channels
+ *      hold a 32-bit performance level, and the limits fast channels hold a
+ *      32-bit maximum performance level followed by a 32-bit minimum
+ *      performance level.
+ */
+enum mod_scmi_perf_fast_channel_idx {
+    /*! Fast channel of the PERFORMANCE_LEVEL_SET command */
+    MOD_SCMI_PERF_FAST_CHANNEL_LEVEL_SET,
+
+    /*! Fast channel of the PERFORMANCE_LIMITS_SET command */
+    MOD_SCMI_PERF_FAST_CHANNEL_LIMITS_SET,
+
+    /*! Fast channel of the PERFORMANCE_LEVEL_GET command */
+    MOD_SCMI_PERF_FAST_CHANNEL_LEVEL_GET,
+
+    /*! Fast channel of the PERFORMANCE_LIMITS_GET command */
+    MOD_SCMI_PERF_FAST_CHANNEL_LIMITS_GET,
+
+    /*! Number of fast channels of a domain */
+    MOD_SCMI_PERF_FAST_CHANNEL_COUNT
+};
+
 /*!
  * \brief Performance domain configuration data.
  */
 struct mod_scmi_perf_domain_config {
     const uint32_t (*permissions)[]; /*!< Per-agent permission flags */
+
+    /*!
+     * \brief Addresses of the fast channels of the domain in the memory map of
+     *      the SCP, indexed by \ref mod_scmi_perf_fast_channel_idx.
+     *
+     * \details An address equal to zero means that the domain has no such
+     *      fast channel.
+     *
+     * \note The set fast channels are shared by all the agents. A domain can
+     *      only have a level set, respectively limits set, fast channel if all
+     *      the agents have the \ref MOD_SCMI_PERF_PERMS_SET_LEVEL,
+     *      respectively \ref MOD_SCMI_PERF_PERMS_SET_LIMITS, permission. The
+     *      start of the module fails otherwise.
+     */
+    uintptr_t fast_channels_addr_scp[MOD_SCMI_PERF_FAST_CHANNEL_COUNT];
+
+    /*!
+     * \brief Addresses of the fast channels of the domain in the memory map of
+     *      the agents, indexed by \ref mod_scmi_perf_fast_channel_idx.
+     */
+    uint64_t fast_channels_addr_ap[MOD_SCMI_PERF_FAST_CHANNEL_COUNT];
 };
 
 /*!
@@ -50,6 +99,18 @@ struct mod_scmi_perf_domain_config {
 struct mod_scmi_perf_config {
     /*! Per-domain configuration data */
     const struct mod_scmi_perf_domain_config (*domains)[];
+
+    /*!
+     * \brief Period in microseconds at which the fast channels are polled.
+     *
+     * \details The period is reported to the agents as the rate limit of the
+     *      fast channels. It must be different from zero when any domain has a
+     *      fast channel, and at most 0xFFFFF.
+     *
+     * \note The fast channels are polled through a periodic framework event,
+     *      which requires a timer driver to be registered with the framework.
+     */
+    uint32_t fast_channels_rate_limit;
 };
 
 /*!
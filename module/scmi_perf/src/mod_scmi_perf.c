@@ -13,13 +13,65 @@
 #include <fwk_errno.h>
 #include <fwk_macros.h>
 #include <fwk_module.h>
+#include <fwk_mm.h>
 #include <fwk_module_idx.h>
+#include <fwk_thread.h>
 #include <internal/scmi.h>
 #include <internal/scmi_perf.h>
 #include <mod_dvfs.h>
+#include <mod_log.h>
 #include <mod_scmi.h>
 #include <mod_scmi_perf.h>
 
+/*
+ * Event indices
+ */
+enum scmi_perf_event_idx {
+    /* Poll the fast channels */
+    SCMI_PERF_EVENT_IDX_FAST_CHANNELS_POLL,
+
+    /* Set the performance level of a domain on behalf of an agent */
+    SCMI_PERF_EVENT_IDX_LEVEL_SET,
+
+    /* Number of defined events */
+    SCMI_PERF_EVENT_IDX_COUNT
+};
+
+/* "Level set" event parameters */
+struct scmi_perf_event_params_level_set {
+    /* Index of the domain */
+    unsigned int domain_idx;
+};
+
+/* Level set command awaiting its response */
+struct scmi_perf_level_set_request {
+    /* Identifier of the service the command came from */
+    fwk_id_t service_id;
+
+    /* Requested performance level */
+    uint32_t level;
+};
+
+struct scmi_perf_domain_ctx {
+    /*
+     * Queue of the level set commands of the domain, with an entry per agent.
+     * The DVFS request of the first command of the queue is in progress.
+     */
+    struct scmi_perf_level_set_request *level_set_queue;
+
+    /* Index of the first command of the level set queue */
+    unsigned int level_set_head;
+
+    /* Number of commands in the level set queue */
+    unsigned int level_set_count;
+
+    /* Last performance level read from the level set fast channel */
+    uint32_t level;
+
+    /* Last performance limits read from the limits set fast channel */
+    struct scmi_perf_fast_channel_limits limits;
+};
+
 struct scmi_perf_ctx {
     /* SCMI Performance Module Configuration */
     const struct mod_scmi_perf_config *config;
@@ -27,11 +79,26 @@ struct scmi_perf_ctx {
     /* Number of power domains */
     unsigned int domain_count;
 
+    /* Number of agents */
+    unsigned int agent_count;
+
     /* SCMI module API */
     const struct mod_scmi_from_protocol_api *scmi_api;
 
     /* DVFS module API */
     const struct mod_dvfs_domain_api *dvfs_api;
+
+    /* Log module API */
+    const struct mod_log_api *log_api;
+
+    /* Table of domain contexts */
+    struct scmi_perf_domain_ctx *domain_ctx_table;
+
+    /* Mask of the fast channel indices at least one domain has a channel for */
+    uint32_t fast_channels_mask;
+
+    /* Fast channels polling in progress flag */
+    bool fast_channels_polling;
 };
 
 static int scmi_perf_protocol_version_handler(
@@ -48,6 +115,8 @@ static int scmi_perf_level_set_handler(
     fwk_id_t service_id, const uint32_t *payload);
 static int scmi_perf_level_get_handler(
     fwk_id_t service_id, const uint32_t *payload);
+static int scmi_perf_describe_fast_channels_handler(
+    fwk_id_t service_id, const uint32_t *payload);
 static int scmi_perf_limits_set_handler(
     fwk_id_t service_id, const uint32_t *payload);
 static int scmi_perf_limits_get_handler(
@@ -73,7 +142,9 @@ static int (*handler_table[])(fwk_id_t, const uint32_t *) = {
     [SCMI_PERF_LEVEL_SET] =
                        scmi_perf_level_set_handler,
     [SCMI_PERF_LEVEL_GET] =
-                       scmi_perf_level_get_handler
+                       scmi_perf_level_get_handler,
+    [SCMI_PERF_DESCRIBE_FAST_CHANNEL] =
+                       scmi_perf_describe_fast_channels_handler
 };
 
 static unsigned int payload_size_table[] = {
@@ -93,8 +164,58 @@ static unsigned int payload_size_table[] = {
                        sizeof(struct scmi_perf_limits_set_a2p),
     [SCMI_PERF_LIMITS_GET] =
                        sizeof(struct scmi_perf_limits_get_a2p),
+    [SCMI_PERF_DESCRIBE_FAST_CHANNEL] =
+                       sizeof(struct scmi_perf_describe_fast_channel_a2p),
 };
 
+/*
+ * Fast channel helpers
+ */
+
+/*
+ * Get the index of the fast channel of a command.
+ *
+ * \return true if the command can have a fast channel, false otherwise.
+ */
+static bool get_fast_channel_idx(unsigned int message_id,
+                                 enum mod_scmi_perf_fast_channel_idx *idx)
+{
+    switch (message_id) {
+    case SCMI_PERF_LEVEL_SET:
+        *idx = MOD_SCMI_PERF_FAST_CHANNEL_LEVEL_SET;
+        return true;
+
+    case SCMI_PERF_LIMITS_SET:
+        *idx = MOD_SCMI_PERF_FAST_CHANNEL_LIMITS_SET;
+        return true;
+
+    case SCMI_PERF_LEVEL_GET:
+        *idx = MOD_SCMI_PERF_FAST_CHANNEL_LEVEL_GET;
+        return true;
+
+    case SCMI_PERF_LIMITS_GET:
+        *idx = MOD_SCMI_PERF_FAST_CHANNEL_LIMITS_GET;
+        return true;
+
+    default:
+        return false;
+    }
+}
+
+static bool domain_has_fast_channels(
+    const struct mod_scmi_perf_domain_config *domain)
+{
+    unsigned int idx;
+
+    for (idx = 0; idx < MOD_SCMI_PERF_FAST_CHANNEL_COUNT; idx++) {
+        if ((domain->fast_channels_addr_scp[idx] != 0) &&
+            (scmi_perf_ctx.fast_channels_mask & (1u << idx)))
+            return true;
+    }
+
+    return false;
+}
+
 /*
  * Protocol command handlers
  */
@@ -137,6 +258,7 @@ static int scmi_perf_protocol_message_attributes_handler(fwk_id_t service_id,
     const struct scmi_protocol_message_attributes_a2p *parameters;
     unsigned int message_id;
     struct scmi_protocol_message_attributes_p2a return_values;
+    enum mod_scmi_perf_fast_channel_idx fast_channel_idx;
 
     parameters =
         (const struct scmi_protocol_message_attributes_a2p *)payload;
@@ -146,8 +268,15 @@ static int scmi_perf_protocol_message_attributes_handler(fwk_id_t service_id,
         (handler_table[message_id] != NULL)) {
         return_values = (struct scmi_protocol_message_attributes_p2a) {
             .status = SCMI_SUCCESS,
-            .attributes = 0, /* All commands have an attributes value of 0 */
+            .attributes = 0,
         };
+
+        /* Advertise the commands at least one domain has a fast channel for */
+        if (get_fast_channel_idx(message_id, &fast_channel_idx) &&
+            (scmi_perf_ctx.fast_channels_mask & (1u << fast_channel_idx))) {
+            return_values.attributes =
+                SCMI_PERF_MESSAGE_ATTRIBUTES_FAST_CHANNEL_MASK;
+        }
     } else
         return_values.status = SCMI_NOT_FOUND;
 
@@ -165,6 +294,7 @@ static int scmi_perf_domain_attributes_handler(fwk_id_t service_id,
     unsigned int agent_id;
     const struct mod_scmi_perf_domain_config *domain;
     const struct scmi_perf_domain_attributes_a2p *parameters;
+    unsigned int domain_idx;
     struct scmi_perf_domain_attributes_p2a return_values;
     uint32_t permissions;
     fwk_id_t domain_id;
@@ -174,7 +304,8 @@ static int scmi_perf_domain_attributes_handler(fwk_id_t service_id,
 
     /* Validate the domain identifier */
     parameters = (const struct scmi_perf_domain_attributes_a2p *)payload;
-    if (parameters->domain_id >= scmi_perf_ctx.domain_count) {
+    domain_idx = parameters->domain_id;
+    if (domain_idx >= scmi_perf_ctx.domain_count) {
         status = FWK_SUCCESS;
         return_values.status = SCMI_NOT_FOUND;
 
@@ -185,10 +316,10 @@ static int scmi_perf_domain_attributes_handler(fwk_id_t service_id,
     if (status != FWK_SUCCESS)
         goto exit;
 
-    domain = &(*scmi_perf_ctx.config->domains)[parameters->domain_id];
+    domain = &(*scmi_perf_ctx.config->domains)[domain_idx];
     permissions = (*domain->permissions)[agent_id];
 
-    domain_id = FWK_ID_ELEMENT(FWK_MODULE_IDX_DVFS, parameters->domain_id),
+    domain_id = FWK_ID_ELEMENT(FWK_MODULE_IDX_DVFS, domain_idx),
     status = scmi_perf_ctx.dvfs_api->get_sustained_opp(domain_id, &opp);
     if (status != FWK_SUCCESS)
         goto exit;
@@ -198,7 +329,8 @@ static int scmi_perf_domain_attributes_handler(fwk_id_t service_id,
         .attributes = SCMI_PERF_DOMAIN_ATTRIBUTES(
             false, false,
             !!(permissions & MOD_SCMI_PERF_PERMS_SET_LEVEL),
-            !!(permissions & MOD_SCMI_PERF_PERMS_SET_LIMITS)
+            !!(permissions & MOD_SCMI_PERF_PERMS_SET_LIMITS),
+            domain_has_fast_channels(domain)
         ),
         .rate_limit = 0, /* Unsupported */
         .sustained_freq = opp.frequency / FWK_KHZ,
@@ -223,6 +355,7 @@ static int scmi_perf_describe_levels_handler(fwk_id_t service_id,
     int status;
     size_t max_payload_size;
     const struct scmi_perf_describe_levels_a2p *parameters;
+    unsigned int domain_idx;
     struct scmi_perf_describe_levels_p2a return_values;
     fwk_id_t domain_id;
     struct scmi_perf_level perf_level;
@@ -249,14 +382,15 @@ static int scmi_perf_describe_levels_handler(fwk_id_t service_id,
 
     /* Validate the domain identifier */
     parameters = (const struct scmi_perf_describe_levels_a2p *)payload;
-    if (parameters->domain_id >= scmi_perf_ctx.domain_count) {
+    domain_idx = parameters->domain_id;
+    if (domain_idx >= scmi_perf_ctx.domain_count) {
         return_values.status = SCMI_NOT_FOUND;
 
         goto exit;
     }
 
     /* Get the number of operating points for the domain */
-    domain_id = FWK_ID_ELEMENT(FWK_MODULE_IDX_DVFS, parameters->domain_id);
+    domain_id = FWK_ID_ELEMENT(FWK_MODULE_IDX_DVFS, domain_idx);
     status = scmi_perf_ctx.dvfs_api->get_opp_count(domain_id, &opp_count);
     if (status != FWK_SUCCESS)
         goto exit;
@@ -326,13 +460,15 @@ static int scmi_perf_limits_set_handler(fwk_id_t service_id,
     unsigned int agent_id;
     const struct mod_scmi_perf_domain_config *domain;
     const struct scmi_perf_limits_set_a2p *parameters;
+    unsigned int domain_idx;
     struct scmi_perf_limits_set_p2a return_values;
     uint32_t permissions;
 
     return_values.status = SCMI_GENERIC_ERROR;
 
     parameters = (const struct scmi_perf_limits_set_a2p *)payload;
-    if (parameters->domain_id >= scmi_perf_ctx.domain_count) {
+    domain_idx = parameters->domain_id;
+    if (domain_idx >= scmi_perf_ctx.domain_count) {
         status = FWK_SUCCESS;
         return_values.status = SCMI_NOT_FOUND;
 
@@ -344,7 +480,7 @@ static int scmi_perf_limits_set_handler(fwk_id_t service_id,
         goto exit;
 
     /* Ensure the agent has permission to do this */
-    domain = &(*scmi_perf_ctx.config->domains)[parameters->domain_id];
+    domain = &(*scmi_perf_ctx.config->domains)[domain_idx];
     permissions = (*domain->permissions)[agent_id];
     if (!(permissions & MOD_SCMI_PERF_PERMS_SET_LIMITS)) {
         return_values.status = SCMI_DENIED;
@@ -360,7 +496,7 @@ static int scmi_perf_limits_set_handler(fwk_id_t service_id,
 
     /* Execute the transition asynchronously */
     status = scmi_perf_ctx.dvfs_api->set_frequency_limits(
-        FWK_ID_ELEMENT(FWK_MODULE_IDX_DVFS, parameters->domain_id),
+        FWK_ID_ELEMENT(FWK_MODULE_IDX_DVFS, domain_idx),
         &((struct mod_dvfs_frequency_limits) {
            .minimum = parameters->range_min,
            .maximum = parameters->range_max
@@ -389,13 +525,15 @@ static int scmi_perf_limits_get_handler(fwk_id_t service_id,
 {
     int status;
     const struct scmi_perf_limits_get_a2p *parameters;
+    unsigned int domain_idx;
     struct scmi_perf_limits_get_p2a return_values;
     struct mod_dvfs_frequency_limits limits;
 
     return_values.status = SCMI_GENERIC_ERROR;
 
     parameters = (const struct scmi_perf_limits_get_a2p *)payload;
-    if (parameters->domain_id >= scmi_perf_ctx.domain_count) {
+    domain_idx = parameters->domain_id;
+    if (domain_idx >= scmi_perf_ctx.domain_count) {
         status = FWK_SUCCESS;
         return_values.status = SCMI_NOT_FOUND;
 
@@ -403,7 +541,7 @@ static int scmi_perf_limits_get_handler(fwk_id_t service_id,
     }
 
     status = scmi_perf_ctx.dvfs_api->get_frequency_limits(
-        FWK_ID_ELEMENT(FWK_MODULE_IDX_DVFS, parameters->domain_id), &limits);
+        FWK_ID_ELEMENT(FWK_MODULE_IDX_DVFS, domain_idx), &limits);
     if (status != FWK_SUCCESS)
         goto exit;
 
@@ -421,6 +559,32 @@ exit:
     return status;
 }
 
+/* Get the entry n of the level set queue of a domain */
+static struct scmi_perf_level_set_request *level_set_queue_entry(
+    const struct scmi_perf_domain_ctx *domain_ctx, unsigned int n)
+{
+    return &domain_ctx->level_set_queue[
+        (domain_ctx->level_set_head + n) % scmi_perf_ctx.agent_count];
+}
+
+/* Request the transition of the first level set command of a domain */
+static int level_set_put_event(unsigned int domain_idx)
+{
+    struct fwk_event event;
+    struct scmi_perf_event_params_level_set *event_params;
+
+    event = (struct fwk_event) {
+        .id = FWK_ID_EVENT(FWK_MODULE_IDX_SCMI_PERF,
+                           SCMI_PERF_EVENT_IDX_LEVEL_SET),
+        .target_id = FWK_ID_MODULE(FWK_MODULE_IDX_SCMI_PERF),
+    };
+
+    event_params = (struct scmi_perf_event_params_level_set *)event.params;
+    event_params->domain_idx = domain_idx;
+
+    return fwk_thread_put_event(&event);
+}
+
 static int scmi_perf_level_set_handler(fwk_id_t service_id,
                                        const uint32_t *payload)
 {
@@ -428,13 +592,17 @@ static int scmi_perf_level_set_handler(fwk_id_t service_id,
     unsigned int agent_id;
     const struct mod_scmi_perf_domain_config *domain;
     const struct scmi_perf_level_set_a2p *parameters;
+    unsigned int domain_idx;
     struct scmi_perf_level_set_p2a return_values;
     uint32_t permissions;
+    struct scmi_perf_domain_ctx *domain_ctx;
+    struct scmi_perf_level_set_request *request;
 
     return_values.status = SCMI_GENERIC_ERROR;
 
     parameters = (const struct scmi_perf_level_set_a2p *)payload;
-    if (parameters->domain_id >= scmi_perf_ctx.domain_count) {
+    domain_idx = parameters->domain_id;
+    if (domain_idx >= scmi_perf_ctx.domain_count) {
         status = FWK_SUCCESS;
         return_values.status = SCMI_NOT_FOUND;
 
@@ -446,7 +614,7 @@ static int scmi_perf_level_set_handler(fwk_id_t service_id,
         goto exit;
 
     /* Ensure the agent has permission to do this */
-    domain = &(*scmi_perf_ctx.config->domains)[parameters->domain_id];
+    domain = &(*scmi_perf_ctx.config->domains)[domain_idx];
     permissions = (*domain->permissions)[agent_id];
     if (!(permissions & MOD_SCMI_PERF_PERMS_SET_LEVEL)) {
         return_values.status = SCMI_DENIED;
@@ -454,22 +622,36 @@ static int scmi_perf_level_set_handler(fwk_id_t service_id,
         goto exit;
     }
 
-    /* Execute the transition synchronously */
-    status = scmi_perf_ctx.dvfs_api->set_frequency(
-        FWK_ID_ELEMENT(FWK_MODULE_IDX_DVFS, parameters->domain_id),
-        parameters->performance_level);
+    /*
+     * Execute the transition asynchronously. The commands of a domain are
+     * queued and their transitions requested one at a time. The response is
+     * sent once the DVFS request has completed, the service processing the
+     * messages of the other agents in the meantime.
+     */
+    domain_ctx = &scmi_perf_ctx.domain_ctx_table[domain_idx];
+    if (domain_ctx->level_set_count == scmi_perf_ctx.agent_count) {
+        return_values.status = SCMI_BUSY;
 
-    if (status == FWK_E_RANGE) {
-        status = FWK_SUCCESS;
-        return_values.status = SCMI_OUT_OF_RANGE;
-    } else if (status != FWK_SUCCESS) {
-        return_values.status = SCMI_GENERIC_ERROR;
-    } else {
-        return_values = (struct scmi_perf_level_set_p2a) {
-            .status = SCMI_SUCCESS,
-        };
+        goto exit;
     }
 
+    request = level_set_queue_entry(domain_ctx, domain_ctx->level_set_count);
+    *request = (struct scmi_perf_level_set_request) {
+        .service_id = service_id,
+        .level = parameters->performance_level,
+    };
+
+    if (domain_ctx->level_set_count++ == 0) {
+        status = level_set_put_event(domain_idx);
+        if (status != FWK_SUCCESS) {
+            domain_ctx->level_set_count--;
+
+            goto exit;
+        }
+    }
+
+    return FWK_SUCCESS;
+
 exit:
     scmi_perf_ctx.scmi_api->respond(service_id, &return_values,
         (return_values.status == SCMI_SUCCESS) ?
@@ -483,13 +665,15 @@ static int scmi_perf_level_get_handler(fwk_id_t service_id,
 {
     int status;
     const struct scmi_perf_level_get_a2p *parameters;
+    unsigned int domain_idx;
     struct scmi_perf_level_get_p2a return_values;
     struct mod_dvfs_opp opp;
 
     return_values.status = SCMI_GENERIC_ERROR;
 
     parameters = (const struct scmi_perf_level_get_a2p *)payload;
-    if (parameters->domain_id >= scmi_perf_ctx.domain_count) {
+    domain_idx = parameters->domain_id;
+    if (domain_idx >= scmi_perf_ctx.domain_count) {
         status = FWK_SUCCESS;
         return_values.status = SCMI_NOT_FOUND;
 
@@ -497,7 +681,7 @@ static int scmi_perf_level_get_handler(fwk_id_t service_id,
     }
 
     status = scmi_perf_ctx.dvfs_api->get_current_opp(
-        FWK_ID_ELEMENT(FWK_MODULE_IDX_DVFS, parameters->domain_id), &opp);
+        FWK_ID_ELEMENT(FWK_MODULE_IDX_DVFS, domain_idx), &opp);
     if (status != FWK_SUCCESS)
         goto exit;
 
@@ -515,6 +699,368 @@ exit:
     return status;
 }
 
+static int scmi_perf_describe_fast_channels_handler(fwk_id_t service_id,
+                                                    const uint32_t *payload)
+{
+    int status;
+    unsigned int agent_id;
+    const struct mod_scmi_perf_domain_config *domain;
+    const struct scmi_perf_describe_fast_channel_a2p *parameters;
+    unsigned int domain_idx;
+    struct scmi_perf_describe_fast_channel_p2a return_values;
+    enum mod_scmi_perf_fast_channel_idx fast_channel_idx;
+    uint32_t permissions;
+    uint64_t chan_addr;
+
+    return_values.status = SCMI_GENERIC_ERROR;
+
+    parameters = (const struct scmi_perf_describe_fast_channel_a2p *)payload;
+    domain_idx = parameters->domain_id;
+    if (domain_idx >= scmi_perf_ctx.domain_count) {
+        status = FWK_SUCCESS;
+        return_values.status = SCMI_NOT_FOUND;
+
+        goto exit;
+    }
+
+    domain = &(*scmi_perf_ctx.config->domains)[domain_idx];
+    if (!get_fast_channel_idx(parameters->message_id, &fast_channel_idx) ||
+        !(scmi_perf_ctx.fast_channels_mask & (1u << fast_channel_idx)) ||
+        (domain->fast_channels_addr_scp[fast_channel_idx] == 0)) {
+        status = FWK_SUCCESS;
+        return_values.status = SCMI_NOT_SUPPORTED;
+
+        goto exit;
+    }
+
+    status = scmi_perf_ctx.scmi_api->get_agent_id(service_id, &agent_id);
+    if (status != FWK_SUCCESS)
+        goto exit;
+
+    /* Ensure the agent has permission to use the set fast channels */
+    permissions = (*domain->permissions)[agent_id];
+    if (((fast_channel_idx == MOD_SCMI_PERF_FAST_CHANNEL_LEVEL_SET) &&
+         !(permissions & MOD_SCMI_PERF_PERMS_SET_LEVEL)) ||
+        ((fast_channel_idx == MOD_SCMI_PERF_FAST_CHANNEL_LIMITS_SET) &&
+         !(permissions & MOD_SCMI_PERF_PERMS_SET_LIMITS))) {
+        return_values.status = SCMI_DENIED;
+
+        goto exit;
+    }
+
+    chan_addr = domain->fast_channels_addr_ap[fast_channel_idx];
+
+    /* The fast channels are polled, no doorbell is provided */
+    return_values = (struct scmi_perf_describe_fast_channel_p2a) {
+        .status = SCMI_SUCCESS,
+        .attributes = 0,
+        .rate_limit = scmi_perf_ctx.config->fast_channels_rate_limit,
+        .chan_addr_low = (uint32_t)chan_addr,
+        .chan_addr_high = (uint32_t)(chan_addr >> 32),
+        .chan_size =
+            ((fast_channel_idx == MOD_SCMI_PERF_FAST_CHANNEL_LEVEL_SET) ||
+             (fast_channel_idx == MOD_SCMI_PERF_FAST_CHANNEL_LEVEL_GET)) ?
+            sizeof(struct scmi_perf_fast_channel_level) :
+            sizeof(struct scmi_perf_fast_channel_limits),
+    };
+
+exit:
+    scmi_perf_ctx.scmi_api->respond(service_id, &return_values,
+        (return_values.status == SCMI_SUCCESS) ?
+        sizeof(return_values) : sizeof(return_values.status));
+
+    return status;
+}
+
+/*
+ * Fast channels polling
+ */
+
+/*
+ * Apply the requests written to the set fast channels of a domain since the
+ * last poll, then publish the current performance level and limits of the
+ * domain in its get fast channels.
+ */
+static void fast_channels_poll_domain(unsigned int domain_idx)
+{
+    const struct mod_scmi_perf_domain_config *domain;
+    struct scmi_perf_domain_ctx *domain_ctx;
+    volatile struct scmi_perf_fast_channel_level *level_chan;
+    volatile struct scmi_perf_fast_channel_limits *limits_chan;
+    struct mod_dvfs_frequency_limits limits;
+    struct mod_dvfs_opp opp;
+    fwk_id_t domain_id;
+    uint32_t level, range_min, range_max;
+
+    domain = &(*scmi_perf_ctx.config->domains)[domain_idx];
+    domain_ctx = &scmi_perf_ctx.domain_ctx_table[domain_idx];
+    domain_id = FWK_ID_ELEMENT(FWK_MODULE_IDX_DVFS, domain_idx);
+
+    /*
+     * The limits are applied first so that a level requested along with new
+     * limits is checked against the new limits. Requests that cannot be
+     * satisfied are dropped, as there is no response to report them with.
+     */
+    limits_chan = (volatile struct scmi_perf_fast_channel_limits *)
+        domain->fast_channels_addr_scp[MOD_SCMI_PERF_FAST_CHANNEL_LIMITS_SET];
+    if (limits_chan != NULL) {
+        range_max = limits_chan->range_max;
+        range_min = limits_chan->range_min;
+
+        if ((range_max != domain_ctx->limits.range_max) ||
+            (range_min != domain_ctx->limits.range_min)) {
+            domain_ctx->limits.range_max = range_max;
+            domain_ctx->limits.range_min = range_min;
+
+            if (range_min <= range_max) {
+                scmi_perf_ctx.dvfs_api->set_frequency_limits(domain_id,
+                    &((struct mod_dvfs_frequency_limits) {
+                       .minimum = range_min,
+                       .maximum = range_max
+                      }));
+            }
+        }
+    }
+
+    level_chan = (volatile struct scmi_perf_fast_channel_level *)
+        domain->fast_channels_addr_scp[MOD_SCMI_PERF_FAST_CHANNEL_LEVEL_SET];
+    if (level_chan != NULL) {
+        level = level_chan->performance_level;
+
+        if (level != domain_ctx->level) {
+            domain_ctx->level = level;
+            scmi_perf_ctx.dvfs_api->set_frequency(domain_id, level);
+        }
+    }
+
+    level_chan = (volatile struct scmi_perf_fast_channel_level *)
+        domain->fast_channels_addr_scp[MOD_SCMI_PERF_FAST_CHANNEL_LEVEL_GET];
+    if ((level_chan != NULL) &&
+        (scmi_perf_ctx.dvfs_api->get_current_opp(domain_id, &opp) ==
+         FWK_SUCCESS))
+        level_chan->performance_level = (uint32_t)opp.frequency;
+
+    limits_chan = (volatile struct scmi_perf_fast_channel_limits *)
+        domain->fast_channels_addr_scp[MOD_SCMI_PERF_FAST_CHANNEL_LIMITS_GET];
+    if ((limits_chan != NULL) &&
+        (scmi_perf_ctx.dvfs_api->get_frequency_limits(domain_id, &limits) ==
+         FWK_SUCCESS)) {
+        limits_chan->range_max = (uint32_t)limits.maximum;
+        limits_chan->range_min = (uint32_t)limits.minimum;
+    }
+}
+
+/*
+ * Initialize the set fast channels of a domain with the current performance
+ * level and limits of the domain, so that the content of the fast channels
+ * before the agents first write to them is not taken as a request.
+ */
+static int fast_channels_init_domain(unsigned int domain_idx)
+{
+    int status;
+    const struct mod_scmi_perf_domain_config *domain;
+    struct scmi_perf_domain_ctx *domain_ctx;
+    volatile struct scmi_perf_fast_channel_level *level_chan;
+    volatile struct scmi_perf_fast_channel_limits *limits_chan;
+    struct mod_dvfs_frequency_limits limits;
+    struct mod_dvfs_opp opp;
+    fwk_id_t domain_id;
+
+    domain = &(*scmi_perf_ctx.config->domains)[domain_idx];
+    domain_ctx = &scmi_perf_ctx.domain_ctx_table[domain_idx];
+    domain_id = FWK_ID_ELEMENT(FWK_MODULE_IDX_DVFS, domain_idx);
+
+    status = scmi_perf_ctx.dvfs_api->get_current_opp(domain_id, &opp);
+    if (status != FWK_SUCCESS)
+        return status;
+
+    status = scmi_perf_ctx.dvfs_api->get_frequency_limits(domain_id, &limits);
+    if (status != FWK_SUCCESS)
+        return status;
+
+    domain_ctx->level = (uint32_t)opp.frequency;
+    domain_ctx->limits = (struct scmi_perf_fast_channel_limits) {
+        .range_max = (uint32_t)limits.maximum,
+        .range_min = (uint32_t)limits.minimum,
+    };
+
+    level_chan = (volatile struct scmi_perf_fast_channel_level *)
+        domain->fast_channels_addr_scp[MOD_SCMI_PERF_FAST_CHANNEL_LEVEL_SET];
+    if (level_chan != NULL)
+        level_chan->performance_level = domain_ctx->level;
+
+    limits_chan = (volatile struct scmi_perf_fast_channel_limits *)
+        domain->fast_channels_addr_scp[MOD_SCMI_PERF_FAST_CHANNEL_LIMITS_SET];
+    if (limits_chan != NULL) {
+        limits_chan->range_max = domain_ctx->limits.range_max;
+        limits_chan->range_min = domain_ctx->limits.range_min;
+    }
+
+    return FWK_SUCCESS;
+}
+
+/*
+ * Check that all the agents have the permission matching each set fast channel
+ * of a domain. The set fast channels are shared by all the agents, the
+ * requests written to them cannot be attributed to a given agent.
+ */
+static int fast_channels_check_domain_permissions(unsigned int domain_idx)
+{
+    int status;
+    const struct mod_scmi_perf_domain_config *domain;
+    unsigned int agent_count, agent_id;
+    uint32_t permissions;
+
+    domain = &(*scmi_perf_ctx.config->domains)[domain_idx];
+
+    status = scmi_perf_ctx.scmi_api->get_agent_count(&agent_count);
+    if (status != FWK_SUCCESS)
+        return status;
+
+    for (agent_id = 1; agent_id <= agent_count; agent_id++) {
+        permissions = (*domain->permissions)[agent_id];
+
+        if (((domain->fast_channels_addr_scp[
+                  MOD_SCMI_PERF_FAST_CHANNEL_LEVEL_SET] != 0) &&
+             !(permissions & MOD_SCMI_PERF_PERMS_SET_LEVEL)) ||
+            ((domain->fast_channels_addr_scp[
+                  MOD_SCMI_PERF_FAST_CHANNEL_LIMITS_SET] != 0) &&
+             !(permissions & MOD_SCMI_PERF_PERMS_SET_LIMITS)))
+            return FWK_E_DATA;
+    }
+
+    return FWK_SUCCESS;
+}
+
+static int scmi_perf_fast_channels_poll(const struct fwk_event *event)
+{
+    int status;
+    unsigned int domain_idx;
+
+    /*
+     * The first poll is put by the start of the module, at which point the
+     * timer driver the periodic events rely on may not be registered yet.
+     */
+    if (!scmi_perf_ctx.fast_channels_polling) {
+        for (domain_idx = 0; domain_idx < scmi_perf_ctx.domain_count;
+             domain_idx++) {
+            status = fast_channels_init_domain(domain_idx);
+            if (status != FWK_SUCCESS)
+                goto error;
+        }
+
+        status = fwk_thread_put_event_periodic(
+            &((struct fwk_event) {
+                .source_id = FWK_ID_MODULE(FWK_MODULE_IDX_SCMI_PERF),
+                .target_id = FWK_ID_MODULE(FWK_MODULE_IDX_SCMI_PERF),
+                .id = FWK_ID_EVENT(FWK_MODULE_IDX_SCMI_PERF,
+                                   SCMI_PERF_EVENT_IDX_FAST_CHANNELS_POLL),
+                .coalesce = true,
+            }),
+            scmi_perf_ctx.config->fast_channels_rate_limit);
+        if (status != FWK_SUCCESS)
+            goto error;
+
+        scmi_perf_ctx.fast_channels_polling = true;
+    }
+
+    for (domain_idx = 0; domain_idx < scmi_perf_ctx.domain_count;
+         domain_idx++)
+        fast_channels_poll_domain(domain_idx);
+
+    return FWK_SUCCESS;
+
+error:
+    /*
+     * The fast channels would not be polled, they are no longer advertised
+     * to the agents.
+     */
+    scmi_perf_ctx.fast_channels_mask = 0;
+
+    scmi_perf_ctx.log_api->log(MOD_LOG_GROUP_ERROR,
+        "[SCMI:perf] Fast channels disabled, polling failed (%e)\n", status);
+
+    return status;
+}
+
+/*
+ * Asynchronous level set
+ */
+
+/*
+ * Respond to the first level set command of a domain, and request the
+ * transition of the next one
+ */
+static void level_set_respond(unsigned int domain_idx, int status)
+{
+    struct scmi_perf_domain_ctx *domain_ctx;
+    const struct scmi_perf_level_set_request *request;
+    struct scmi_perf_level_set_p2a return_values;
+    int respond_status;
+
+    domain_ctx = &scmi_perf_ctx.domain_ctx_table[domain_idx];
+
+    do {
+        if (status == FWK_SUCCESS)
+            return_values.status = SCMI_SUCCESS;
+        else if (status == FWK_E_RANGE)
+            return_values.status = SCMI_OUT_OF_RANGE;
+        else
+            return_values.status = SCMI_GENERIC_ERROR;
+
+        request = level_set_queue_entry(domain_ctx, 0);
+
+        /* Not processing the message, the response is sent by the service */
+        respond_status = scmi_perf_ctx.scmi_api->respond_deferred(
+            request->service_id, &return_values, sizeof(return_values));
+        if (respond_status != FWK_SUCCESS) {
+            scmi_perf_ctx.log_api->log(MOD_LOG_GROUP_ERROR,
+                "[SCMI:perf] Failed to respond to level set (%e)\n",
+                respond_status);
+        }
+
+        domain_ctx->level_set_head =
+            (domain_ctx->level_set_head + 1) % scmi_perf_ctx.agent_count;
+        if (--domain_ctx->level_set_count == 0)
+            return;
+
+        status = level_set_put_event(domain_idx);
+    } while (status != FWK_SUCCESS);
+}
+
+static int scmi_perf_level_set(const struct fwk_event *event)
+{
+    int status;
+    const struct scmi_perf_event_params_level_set *params;
+    const struct scmi_perf_level_set_request *request;
+
+    params = (const struct scmi_perf_event_params_level_set *)event->params;
+    request = level_set_queue_entry(
+        &scmi_perf_ctx.domain_ctx_table[params->domain_idx], 0);
+
+    /* The response of the DVFS module completes the command */
+    status = scmi_perf_ctx.dvfs_api->set_frequency_async(
+        FWK_ID_ELEMENT(FWK_MODULE_IDX_DVFS, params->domain_idx),
+        request->level);
+    if (status != FWK_SUCCESS)
+        level_set_respond(params->domain_idx, status);
+
+    return FWK_SUCCESS;
+}
+
+static int scmi_perf_level_set_complete(const struct fwk_event *event)
+{
+    const struct mod_dvfs_event_params_set_frequency_response *params;
+
+    params = (const struct mod_dvfs_event_params_set_frequency_response *)
+        event->params;
+
+    level_set_respond(fwk_id_get_element_idx(event->source_id),
+                      params->status);
+
+    return FWK_SUCCESS;
+}
+
 /*
  * SCMI module -> SCMI performance module interface
  */
@@ -548,7 +1094,8 @@ static int scmi_perf_message_handler(fwk_id_t protocol_id, fwk_id_t service_id,
     if (status != FWK_SUCCESS)
         return status;
 
-    if (message_id >= FWK_ARRAY_SIZE(handler_table)) {
+    if ((message_id >= FWK_ARRAY_SIZE(handler_table)) ||
+        (handler_table[message_id] == NULL)) {
         return_value = SCMI_NOT_SUPPORTED;
         goto error;
     }
@@ -579,6 +1126,8 @@ static int scmi_perf_init(fwk_id_t module_id, unsigned int element_count,
                           const void *data)
 {
     int return_val;
+    unsigned int domain_idx, idx;
+    const struct mod_scmi_perf_domain_config *domain;
     const struct mod_scmi_perf_config *config =
         (const struct mod_scmi_perf_config *)data;
 
@@ -593,6 +1142,27 @@ static int scmi_perf_init(fwk_id_t module_id, unsigned int element_count,
     scmi_perf_ctx.config = config;
     scmi_perf_ctx.domain_count = return_val;
 
+    for (domain_idx = 0; domain_idx < scmi_perf_ctx.domain_count;
+         domain_idx++) {
+        domain = &(*config->domains)[domain_idx];
+
+        for (idx = 0; idx < MOD_SCMI_PERF_FAST_CHANNEL_COUNT; idx++) {
+            if (domain->fast_channels_addr_scp[idx] != 0)
+                scmi_perf_ctx.fast_channels_mask |= (1u << idx);
+        }
+    }
+
+    if ((scmi_perf_ctx.fast_channels_mask != 0) &&
+        ((config->fast_channels_rate_limit == 0) ||
+         (config->fast_channels_rate_limit >
+          SCMI_PERF_DOMAIN_RATE_LIMIT_MASK)))
+        return FWK_E_PARAM;
+
+    scmi_perf_ctx.domain_ctx_table = fwk_mm_calloc(scmi_perf_ctx.domain_count,
+        sizeof(scmi_perf_ctx.domain_ctx_table[0]));
+    if (scmi_perf_ctx.domain_ctx_table == NULL)
+        return FWK_E_NOMEM;
+
     return FWK_SUCCESS;
 }
 
@@ -609,6 +1179,11 @@ static int scmi_perf_bind(fwk_id_t id, unsigned int round)
     if (status != FWK_SUCCESS)
         return status;
 
+    status = fwk_module_bind(FWK_ID_MODULE(FWK_MODULE_IDX_LOG),
+        FWK_ID_API(FWK_MODULE_IDX_LOG, 0), &scmi_perf_ctx.log_api);
+    if (status != FWK_SUCCESS)
+        return status;
+
     return fwk_module_bind(FWK_ID_MODULE(FWK_MODULE_IDX_DVFS),
         FWK_ID_API(FWK_MODULE_IDX_DVFS, 0), &scmi_perf_ctx.dvfs_api);
 }
@@ -623,12 +1198,76 @@ static int scmi_perf_process_bind_request(fwk_id_t source_id,
 
     return FWK_SUCCESS;
 }
+
+static int scmi_perf_start(fwk_id_t id)
+{
+    int status;
+    unsigned int domain_idx;
+    struct scmi_perf_domain_ctx *domain_ctx;
+    struct fwk_event event = {
+        .source_id = FWK_ID_MODULE(FWK_MODULE_IDX_SCMI_PERF),
+        .target_id = FWK_ID_MODULE(FWK_MODULE_IDX_SCMI_PERF),
+        .id = FWK_ID_EVENT(FWK_MODULE_IDX_SCMI_PERF,
+                           SCMI_PERF_EVENT_IDX_FAST_CHANNELS_POLL),
+    };
+
+    status = scmi_perf_ctx.scmi_api->get_agent_count(
+        &scmi_perf_ctx.agent_count);
+    if (status != FWK_SUCCESS)
+        return status;
+
+    /* Each agent has at most one level set command awaiting its response */
+    for (domain_idx = 0; domain_idx < scmi_perf_ctx.domain_count;
+         domain_idx++) {
+        domain_ctx = &scmi_perf_ctx.domain_ctx_table[domain_idx];
+        domain_ctx->level_set_queue = fwk_mm_calloc(scmi_perf_ctx.agent_count,
+            sizeof(domain_ctx->level_set_queue[0]));
+        if (domain_ctx->level_set_queue == NULL)
+            return FWK_E_NOMEM;
+    }
+
+    if (scmi_perf_ctx.fast_channels_mask == 0)
+        return FWK_SUCCESS;
+
+    for (domain_idx = 0; domain_idx < scmi_perf_ctx.domain_count;
+         domain_idx++) {
+        status = fast_channels_check_domain_permissions(domain_idx);
+        if (status != FWK_SUCCESS) {
+            assert(false);
+            return status;
+        }
+    }
+
+    return fwk_thread_put_event(&event);
+}
+
+static int scmi_perf_process_event(const struct fwk_event *event,
+                                   struct fwk_event *resp_event)
+{
+    if (fwk_id_is_equal(event->id, mod_dvfs_event_id_set_frequency))
+        return scmi_perf_level_set_complete(event);
+
+    switch (fwk_id_get_event_idx(event->id)) {
+    case SCMI_PERF_EVENT_IDX_FAST_CHANNELS_POLL:
+        return scmi_perf_fast_channels_poll(event);
+
+    case SCMI_PERF_EVENT_IDX_LEVEL_SET:
+        return scmi_perf_level_set(event);
+
+    default:
+        return FWK_E_PARAM;
+    }
+}
+
 /* SCMI Performance Management Protocol Definition */
 const struct fwk_module module_scmi_perf = {
     .name = "SCMI Performance Management Protocol",
     .api_count = 1,
+    .event_count = SCMI_PERF_EVENT_IDX_COUNT,
     .type = FWK_MODULE_TYPE_PROTOCOL,
     .init = scmi_perf_init,
     .bind = scmi_perf_bind,
+    .start = scmi_perf_start,
     .process_bind_request = scmi_perf_process_bind_request,
+    .process_event = scmi_perf_process_event,
 };
@@ -63,6 +63,13 @@ struct __attribute((packed)) scmi_sensor_protocol_reading_get_p2a {
     uint32_t sensor_value_high;
 };
 
+struct __attribute((packed)) scmi_sensor_protocol_reading_get_delayed_p2a {
+    int32_t status;
+    uint32_t sensor_id;
+    uint32_t sensor_value_low;
+    uint32_t sensor_value_high;
+};
+
 /*
  * SENSOR_DESCRIPTION_GET
  */
@@ -74,6 +81,11 @@ struct __attribute((packed)) scmi_sensor_protocol_reading_get_p2a {
                 / sizeof(struct scmi_sensor_desc)) \
         : 0)
 
+#define SCMI_SENSOR_DESC_ATTRS_LOW_ASYNC_READ_SUPPORT_POS        31
+
+#define SCMI_SENSOR_DESC_ATTRS_LOW_ASYNC_READ_SUPPORT_MASK \
+    (UINT32_C(0x1) << SCMI_SENSOR_DESC_ATTRS_LOW_ASYNC_READ_SUPPORT_POS)
+
 #define SCMI_SENSOR_DESC_ATTRS_HIGH_SENSOR_TYPE_POS              0
 #define SCMI_SENSOR_DESC_ATTRS_HIGH_SENSOR_UNIT_MULTIPLIER_POS   11
 #define SCMI_SENSOR_DESC_ATTRS_HIGH_SENSOR_UPDATE_MULTIPLIER_POS 22
@@ -14,17 +14,80 @@
 #include <fwk_errno.h>
 #include <fwk_id.h>
 #include <fwk_macros.h>
+#include <fwk_mm.h>
 #include <fwk_module.h>
 #include <fwk_module_idx.h>
+#include <fwk_thread.h>
 #include <internal/scmi.h>
 #include <internal/scmi_sensor.h>
 #include <mod_sensor.h>
 #include <mod_scmi.h>
 
+/*
+ * Event indices
+ */
+enum scmi_sensor_event_idx {
+    /* Read the value of a sensor on behalf of an agent */
+    SCMI_SENSOR_EVENT_IDX_READ_VALUE,
+
+    /* Retry sending the delayed response of a reading */
+    SCMI_SENSOR_EVENT_IDX_SEND_DELAYED_RESPONSE,
+
+    /* Number of defined events */
+    SCMI_SENSOR_EVENT_IDX_COUNT
+};
+
+/* "Read value" event parameters */
+struct scmi_sensor_event_params_read_value {
+    /* Index of the sensor */
+    unsigned int sensor_idx;
+};
+
+/*
+ * Delay in microseconds before sending again a delayed response that could
+ * not be sent because the P2A channel was busy
+ */
+#define SCMI_SENSOR_DELAYED_RESPONSE_RETRY_DELAY_US 100
+
+/*
+ * Maximum number of times sending a delayed response is retried before the
+ * response is dropped
+ */
+#define SCMI_SENSOR_DELAYED_RESPONSE_RETRY_MAX 100
+
+/* "Send delayed response" event parameters */
+struct scmi_sensor_event_params_send_delayed_response {
+    /* Index of the sensor */
+    unsigned int sensor_idx;
+};
+
+struct scmi_sensor_operation {
+    /* Asynchronous reading awaiting its delayed response flag */
+    bool pending;
+
+    /* The delayed response is ready and waits for the P2A channel flag */
+    bool response_ready;
+
+    /* Delayed response of the reading */
+    struct scmi_sensor_protocol_reading_get_delayed_p2a delayed_response;
+
+    /* Number of times sending the delayed response has been retried */
+    unsigned int retry_count;
+
+    /* Identifier of the service the reading was requested through */
+    fwk_id_t service_id;
+
+    /* Header of the command the reading was requested with */
+    uint32_t message_header;
+};
+
 struct scmi_sensor_ctx {
     unsigned int sensor_count;
     const struct mod_scmi_from_protocol_api *scmi_api;
     const struct mod_sensor_api *sensor_api;
+
+    /* Table of the asynchronous reading operations, one per sensor */
+    struct scmi_sensor_operation *operation_table;
 };
 
 static int scmi_sensor_protocol_version_handler(fwk_id_t service_id,
@@ -103,12 +166,14 @@ static int scmi_sensor_protocol_msg_attributes_handler(fwk_id_t service_id,
 {
     const struct scmi_protocol_message_attributes_a2p *parameters;
     struct scmi_protocol_message_attributes_p2a return_values;
+    unsigned int message_id;
 
     parameters = (const struct scmi_protocol_message_attributes_a2p *)
                  payload;
+    message_id = parameters->message_id;
 
-    if ((parameters->message_id < FWK_ARRAY_SIZE(handler_table)) &&
-        (handler_table[parameters->message_id] != NULL)) {
+    if ((message_id < FWK_ARRAY_SIZE(handler_table)) &&
+        (handler_table[message_id] != NULL)) {
         return_values = (struct scmi_protocol_message_attributes_p2a) {
             .status = SCMI_SUCCESS,
             /* All commands have an attributes value of 0 */
@@ -130,6 +195,7 @@ static int scmi_sensor_protocol_desc_get_handler(fwk_id_t service_id,
     int status;
     size_t payload_size;
     size_t max_payload_size;
+    bool async_read_support;
     const struct scmi_sensor_protocol_description_get_a2p *parameters =
                (const struct scmi_sensor_protocol_description_get_a2p *)payload;
     struct scmi_sensor_desc desc = { 0 };
@@ -147,6 +213,11 @@ static int scmi_sensor_protocol_desc_get_handler(fwk_id_t service_id,
     if (status != FWK_SUCCESS)
         goto exit;
 
+    status = scmi_sensor_ctx.scmi_api->get_delayed_response_support(
+        service_id, &async_read_support);
+    if (status != FWK_SUCCESS)
+        goto exit;
+
     if (SCMI_SENSOR_DESCS_MAX(max_payload_size) == 0) {
         /* Can't even fit one sensor description in the payload */
         assert(false);
@@ -172,7 +243,8 @@ static int scmi_sensor_protocol_desc_get_handler(fwk_id_t service_id,
 
         desc = (struct scmi_sensor_desc) {
             .sensor_id = desc_index,
-            .sensor_attributes_low = 0, /* None supported */
+            .sensor_attributes_low = async_read_support ?
+                SCMI_SENSOR_DESC_ATTRS_LOW_ASYNC_READ_SUPPORT_MASK : 0,
         };
 
         sensor_id = FWK_ID_ELEMENT(FWK_MODULE_IDX_SENSOR, desc_index);
@@ -273,31 +345,81 @@ static int scmi_sensor_reading_get_handler(fwk_id_t service_id,
 {
     const struct scmi_sensor_protocol_reading_get_a2p *parameters;
     struct scmi_sensor_protocol_reading_get_p2a return_values;
+    unsigned int sensor_idx;
     uint64_t sensor_value;
     uint32_t flags;
     fwk_id_t sensor_id;
     int status;
+    bool async_read_support;
+    struct scmi_sensor_operation *operation;
+    struct fwk_event event;
+    struct scmi_sensor_event_params_read_value *event_params;
 
     parameters = (const struct scmi_sensor_protocol_reading_get_a2p *)payload;
     return_values.status = SCMI_GENERIC_ERROR;
 
-    if (parameters->sensor_id >= scmi_sensor_ctx.sensor_count) {
+    sensor_idx = parameters->sensor_id;
+    if (sensor_idx >= scmi_sensor_ctx.sensor_count) {
         /* Sensor does not exist */
         status = FWK_SUCCESS;
         return_values.status = SCMI_NOT_FOUND;
         goto exit;
     }
 
-    /* Reject asynchronous read requests for now */
     flags = parameters->flags;
     if (flags & SCMI_SENSOR_PROTOCOL_READING_GET_ASYNC_FLAG_MASK) {
-        return_values.status = SCMI_NOT_SUPPORTED;
-        status = FWK_SUCCESS;
-        goto exit;
+        status = scmi_sensor_ctx.scmi_api->get_delayed_response_support(
+            service_id, &async_read_support);
+        if (status != FWK_SUCCESS)
+            goto exit;
+
+        if (!async_read_support) {
+            return_values.status = SCMI_NOT_SUPPORTED;
+            goto exit;
+        }
+
+        /* Only one asynchronous reading at a time can be requested */
+        operation = &scmi_sensor_ctx.operation_table[sensor_idx];
+        if (operation->pending) {
+            return_values.status = SCMI_BUSY;
+            goto exit;
+        }
+
+        status = scmi_sensor_ctx.scmi_api->get_message_header(
+            service_id, &operation->message_header);
+        if (status != FWK_SUCCESS)
+            goto exit;
+
+        /*
+         * The reading is requested from the context of this module for the
+         * response of the sensor module to be delivered to it. The value is
+         * reported to the agent in the delayed response.
+         */
+        event = (struct fwk_event) {
+            .id = FWK_ID_EVENT(FWK_MODULE_IDX_SCMI_SENSOR,
+                               SCMI_SENSOR_EVENT_IDX_READ_VALUE),
+            .target_id = FWK_ID_MODULE(FWK_MODULE_IDX_SCMI_SENSOR),
+        };
+
+        event_params =
+            (struct scmi_sensor_event_params_read_value *)event.params;
+        event_params->sensor_idx = sensor_idx;
+
+        status = fwk_thread_put_event(&event);
+        if (status != FWK_SUCCESS)
+            goto exit;
+
+        operation->pending = true;
+        operation->service_id = service_id;
+
+        return_values.status = SCMI_SUCCESS;
+        scmi_sensor_ctx.scmi_api->respond(service_id, &return_values,
+                                          sizeof(return_values.status));
+
+        return FWK_SUCCESS;
     }
 
-    sensor_id = FWK_ID_ELEMENT(FWK_MODULE_IDX_SENSOR,
-                               parameters->sensor_id);
+    sensor_id = FWK_ID_ELEMENT(FWK_MODULE_IDX_SENSOR, sensor_idx);
 
     status = scmi_sensor_ctx.sensor_api->get_value(sensor_id, &sensor_value);
     if (status == FWK_SUCCESS) {
@@ -323,6 +445,125 @@ exit:
     return status;
 }
 
+/*
+ * Send the delayed response of a reading. When the P2A channel is busy, the
+ * response is kept and sending it is retried later, up to
+ * SCMI_SENSOR_DELAYED_RESPONSE_RETRY_MAX times. The reading remains pending
+ * in the meantime.
+ */
+static void send_delayed_response(unsigned int sensor_idx)
+{
+    int status;
+    struct scmi_sensor_operation *operation;
+    struct fwk_event event;
+    struct scmi_sensor_event_params_send_delayed_response *event_params;
+
+    operation = &scmi_sensor_ctx.operation_table[sensor_idx];
+
+    status = scmi_sensor_ctx.scmi_api->send_delayed_response(
+        operation->service_id, operation->message_header,
+        &operation->delayed_response, sizeof(operation->delayed_response));
+    if ((status == FWK_E_BUSY) &&
+        (operation->retry_count < SCMI_SENSOR_DELAYED_RESPONSE_RETRY_MAX)) {
+        event = (struct fwk_event) {
+            .id = FWK_ID_EVENT(FWK_MODULE_IDX_SCMI_SENSOR,
+                               SCMI_SENSOR_EVENT_IDX_SEND_DELAYED_RESPONSE),
+            .target_id = FWK_ID_MODULE(FWK_MODULE_IDX_SCMI_SENSOR),
+        };
+
+        event_params =
+            (struct scmi_sensor_event_params_send_delayed_response *)
+            event.params;
+        event_params->sensor_idx = sensor_idx;
+
+        status = fwk_thread_put_event_delayed(&event,
+            SCMI_SENSOR_DELAYED_RESPONSE_RETRY_DELAY_US);
+        if (status == FWK_SUCCESS) {
+            operation->retry_count++;
+            return;
+        }
+    }
+
+    /* The response was sent or cannot be, the operation is over */
+    operation->response_ready = false;
+    operation->pending = false;
+
+    fwk_expect(status == FWK_SUCCESS);
+}
+
+static void reading_complete(unsigned int sensor_idx, int status,
+                             uint64_t value)
+{
+    struct scmi_sensor_operation *operation;
+
+    operation = &scmi_sensor_ctx.operation_table[sensor_idx];
+    if (!operation->pending || operation->response_ready)
+        return;
+
+    operation->delayed_response =
+        (struct scmi_sensor_protocol_reading_get_delayed_p2a) {
+            .status = SCMI_GENERIC_ERROR,
+            .sensor_id = sensor_idx,
+        };
+
+    if (status == FWK_SUCCESS) {
+        operation->delayed_response.status = SCMI_SUCCESS;
+        operation->delayed_response.sensor_value_low = (uint32_t)value;
+        operation->delayed_response.sensor_value_high =
+            (uint32_t)(value >> 32);
+    } else if (status == FWK_E_PWRSTATE)
+        operation->delayed_response.status = SCMI_HARDWARE_ERROR;
+
+    operation->response_ready = true;
+    operation->retry_count = 0;
+
+    send_delayed_response(sensor_idx);
+}
+
+static int scmi_sensor_read_value(const struct fwk_event *event)
+{
+    int status;
+    const struct scmi_sensor_event_params_read_value *params;
+
+    params = (const struct scmi_sensor_event_params_read_value *)event->params;
+
+    /* The response of the sensor module completes the command */
+    status = scmi_sensor_ctx.sensor_api->get_value_async(
+        FWK_ID_ELEMENT(FWK_MODULE_IDX_SENSOR, params->sensor_idx));
+    if (status != FWK_SUCCESS)
+        reading_complete(params->sensor_idx, status, 0);
+
+    return FWK_SUCCESS;
+}
+
+static int scmi_sensor_read_value_complete(const struct fwk_event *event)
+{
+    const struct mod_sensor_event_params_read_value_response *params;
+
+    params = (const struct mod_sensor_event_params_read_value_response *)
+        event->params;
+
+    reading_complete(fwk_id_get_element_idx(event->source_id),
+                     params->status, params->value);
+
+    return FWK_SUCCESS;
+}
+
+static int scmi_sensor_send_delayed_response(const struct fwk_event *event)
+{
+    const struct scmi_sensor_event_params_send_delayed_response *params;
+
+    params = (const struct scmi_sensor_event_params_send_delayed_response *)
+        event->params;
+
+    if (!scmi_sensor_ctx.operation_table[params->sensor_idx].response_ready)
+        return FWK_E_STATE;
+
+    send_delayed_response(params->sensor_idx);
+
+    return FWK_SUCCESS;
+}
+
 /*
  * SCMI module -> SCMI sensor module interface
  */
@@ -405,6 +646,12 @@ static int scmi_sensor_init(fwk_id_t module_id,
     if (scmi_sensor_ctx.sensor_count > UINT16_MAX)
         scmi_sensor_ctx.sensor_count = UINT16_MAX;
 
+    scmi_sensor_ctx.operation_table = fwk_mm_calloc(
+        scmi_sensor_ctx.sensor_count,
+        sizeof(scmi_sensor_ctx.operation_table[0]));
+    if (scmi_sensor_ctx.operation_table == NULL)
+        return FWK_E_NOMEM;
+
     return FWK_SUCCESS;
 }
 
@@ -426,7 +673,7 @@ static int scmi_sensor_bind(fwk_id_t id, unsigned int round)
     }
 
     status = fwk_module_bind(FWK_ID_MODULE(FWK_MODULE_IDX_SENSOR),
-                             FWK_ID_API(FWK_MODULE_IDX_SENSOR, 0),
+                             mod_sensor_api_id_sensor,
                              &scmi_sensor_ctx.sensor_api);
     if (status != FWK_SUCCESS) {
         /* Failed to bind to sensor module */
@@ -450,13 +697,33 @@ static int scmi_sensor_process_bind_request(fwk_id_t source_id,
     return FWK_SUCCESS;
 }
 
+static int scmi_sensor_process_event(const struct fwk_event *event,
+                                     struct fwk_event *resp_event)
+{
+    if (fwk_id_is_equal(event->id, mod_sensor_event_id_read_value))
+        return scmi_sensor_read_value_complete(event);
+
+    switch (fwk_id_get_event_idx(event->id)) {
+    case SCMI_SENSOR_EVENT_IDX_READ_VALUE:
+        return scmi_sensor_read_value(event);
+
+    case SCMI_SENSOR_EVENT_IDX_SEND_DELAYED_RESPONSE:
+        return scmi_sensor_send_delayed_response(event);
+
+    default:
+        return FWK_E_PARAM;
+    }
+}
+
 const struct fwk_module module_scmi_sensor = {
     .name = "SCMI sensor management",
     .api_count = 1,
+    .event_count = SCMI_SENSOR_EVENT_IDX_COUNT,
     .type = FWK_MODULE_TYPE_PROTOCOL,
     .init = scmi_sensor_init,
     .bind = scmi_sensor_bind,
     .process_bind_request = scmi_sensor_process_bind_request,
+    .process_event = scmi_sensor_process_event,
 };
 
 /* No elements, no module configuration data */
@@ -9,6 +9,7 @@
 #define MOD_SENSOR_H
 
 #include <fwk_id.h>
+#include <fwk_module_idx.h>
 #include <stdint.h>
 #include <stdbool.h>
 
@@ -164,6 +165,15 @@ struct mod_sensor_dev_config {
 
 };
 
+/*!
+ * \brief Return value of a driver reading a sensor asynchronously.
+ *
+ * \details Returned by \ref mod_sensor_driver_api.get_value when the reading
+ *      was started and completes asynchronously. It is not a framework status
+ *      code and is only returned by sensor drivers to this module.
+ */
+#define MOD_SENSOR_DRIVER_PENDING 1
+
 /*!
  * \brief Sensor driver API.
  *
@@ -173,12 +183,17 @@ struct mod_sensor_driver_api {
     /*!
      * \brief Read sensor value.
      *
-     * \details Synchronously read current sensor value.
+     * \details Read current sensor value. A driver that cannot read the
+     *      sensor synchronously starts the reading and returns
+     *      \ref MOD_SENSOR_DRIVER_PENDING. It then reports the value through
+     *      the \ref mod_sensor_driver_response_api once it is available.
      *
      * \param id Specific sensor device id.
      * \param value Pointer to storage for the sensor value.
      *
      * \retval FWK_SUCCESS Value was read successfully.
+     * \retval MOD_SENSOR_DRIVER_PENDING The reading was started and completes
+     *      asynchronously.
      * \return One of the standard framework error codes.
      */
     int (*get_value)(fwk_id_t id, uint64_t *value);
@@ -195,6 +210,39 @@ struct mod_sensor_driver_api {
     int (*get_info)(fwk_id_t id, struct mod_sensor_info *info);
 };
 
+/*!
+ * \brief Parameters of a driver response.
+ */
+struct mod_sensor_driver_resp_params {
+    /*! Status of the reading */
+    int status;
+
+    /*! Sensor value */
+    uint64_t value;
+};
+
+/*!
+ * \brief Driver response API.
+ *
+ * \details Api used by the drivers to report the result of the readings they
+ *      complete asynchronously.
+ */
+struct mod_sensor_driver_response_api {
+    /*!
+     * \brief Report the result of an asynchronous reading.
+     *
+     * \param id Sensor device id the reading was requested for.
+     * \param response Result of the reading.
+     *
+     * \retval FWK_SUCCESS The result was reported.
+     * \retval FWK_E_STATE No asynchronous reading is pending on the sensor.
+     * \return One of the standard framework error codes.
+     */
+    int (*reading_complete)(
+        fwk_id_t id,
+        const struct mod_sensor_driver_resp_params *response);
+};
+
 /*!
  * \brief Sensor API.
  */
@@ -209,10 +257,30 @@ struct mod_sensor_api {
      *
      * \retval FWK_SUCCESS Operation succeeded.
      * \retval FWK_E_DEVICE Driver error.
+     * \retval FWK_E_BUSY An asynchronous reading of the sensor is in
+     *      progress.
+     * \retval FWK_E_SUPPORT The driver completes its readings
+     *      asynchronously, \ref get_value_async must be used instead.
      * \return One of the standard framework error codes.
      */
     int (*get_value)(fwk_id_t id, uint64_t *value);
 
+    /*!
+     * \brief Read sensor value asynchronously.
+     *
+     * \details The value is reported to the caller in the response to a
+     *      \ref mod_sensor_event_id_read_value event, with
+     *      \ref mod_sensor_event_params_read_value_response parameters. Only
+     *      one reading of a sensor can be in progress at a time.
+     *
+     * \param id Specific sensor device id.
+     *
+     * \retval FWK_SUCCESS The reading was requested.
+     * \retval FWK_E_BUSY A reading of the sensor is already in progress.
+     * \return One of the standard framework error codes.
+     */
+    int (*get_value_async)(fwk_id_t id);
+
     /*!
      * \brief Get sensor information.
      *
@@ -228,6 +296,63 @@ struct mod_sensor_api {
     int (*get_info)(fwk_id_t id, struct mod_sensor_info *info);
 };
 
+/*!
+ * \brief Parameters of the response to a read value event.
+ */
+struct mod_sensor_event_params_read_value_response {
+    /*! Status of the reading */
+    int status;
+
+    /*! Sensor value */
+    uint64_t value;
+};
+
+/*!
+ * \brief API indices.
+ */
+enum mod_sensor_api_idx {
+    /*! Sensor API */
+    MOD_SENSOR_API_IDX_SENSOR,
+
+    /*! Driver response API */
+    MOD_SENSOR_API_IDX_DRIVER_RESPONSE,
+
+    /*! Number of APIs */
+    MOD_SENSOR_API_IDX_COUNT,
+};
+
+/*! Identifier of the sensor API */
+static const fwk_id_t mod_sensor_api_id_sensor =
+    FWK_ID_API_INIT(FWK_MODULE_IDX_SENSOR, MOD_SENSOR_API_IDX_SENSOR);
+
+/*! Identifier of the driver response API */
+static const fwk_id_t mod_sensor_api_id_driver_response =
+    FWK_ID_API_INIT(FWK_MODULE_IDX_SENSOR,
+                    MOD_SENSOR_API_IDX_DRIVER_RESPONSE);
+
+/*!
+ * \brief Event indices.
+ */
+enum mod_sensor_event_idx {
+    /*! Read the value of a sensor */
+    MOD_SENSOR_EVENT_IDX_READ_VALUE,
+
+    /*! Completion of an asynchronous reading by the driver */
+    MOD_SENSOR_EVENT_IDX_READING_COMPLETE,
+
+    /*! Number of events */
+    MOD_SENSOR_EVENT_IDX_COUNT,
+};
+
+/*! Identifier of the read value event */
+static const fwk_id_t mod_sensor_event_id_read_value =
+    FWK_ID_EVENT_INIT(FWK_MODULE_IDX_SENSOR, MOD_SENSOR_EVENT_IDX_READ_VALUE);
+
+/*! Identifier of the reading complete event */
+static const fwk_id_t mod_sensor_event_id_reading_complete =
+    FWK_ID_EVENT_INIT(FWK_MODULE_IDX_SENSOR,
+                      MOD_SENSOR_EVENT_IDX_READING_COMPLETE);
+
 /*!
  * @}
  */
@@ -12,11 +12,21 @@
 #include <fwk_mm.h>
 #include <fwk_module.h>
 #include <fwk_module_idx.h>
+#include <fwk_thread.h>
 #include <mod_sensor.h>
 
 struct sensor_dev_ctx {
     struct mod_sensor_dev_config *config;
     struct mod_sensor_driver_api *driver_api;
+
+    /* An asynchronous reading has been requested and is not complete yet */
+    bool read_pending;
+
+    /* Identifier of the entity the asynchronous reading was requested by */
+    fwk_id_t requester_id;
+
+    /* Cookie of the delayed response to the read value event */
+    uint32_t cookie;
 };
 
 static struct sensor_dev_ctx *ctx_table;
@@ -54,13 +64,47 @@ static int get_value(fwk_id_t id, uint64_t *value)
     if (status != FWK_SUCCESS)
         return status;
 
+    if (ctx->read_pending)
+        return FWK_E_BUSY;
+
     status = ctx->driver_api->get_value(ctx->config->driver_id, value);
+    if (status == MOD_SENSOR_DRIVER_PENDING)
+        return FWK_E_SUPPORT;
     if (!fwk_expect(status == FWK_SUCCESS))
         return FWK_E_DEVICE;
 
     return FWK_SUCCESS;
 }
 
+static int get_value_async(fwk_id_t id)
+{
+    int status;
+    struct sensor_dev_ctx *ctx;
+    struct fwk_event event = {
+        .target_id = id,
+        .id = mod_sensor_event_id_read_value,
+        .response_requested = true,
+    };
+
+    fwk_assert(fwk_module_is_valid_element_id(id));
+
+    status = fwk_module_check_call(id);
+    if (status != FWK_SUCCESS)
+        return status;
+
+    ctx = ctx_table + fwk_id_get_element_idx(id);
+    if (ctx->read_pending)
+        return FWK_E_BUSY;
+
+    status = fwk_thread_put_event(&event);
+    if (status != FWK_SUCCESS)
+        return status;
+
+    ctx->read_pending = true;
+
+    return FWK_SUCCESS;
+}
+
 static int get_info(fwk_id_t id, struct mod_sensor_info *info)
 {
     int status;
@@ -79,9 +123,45 @@ static int get_info(fwk_id_t id, struct mod_sensor_info *info)
 
 static struct mod_sensor_api sensor_api = {
     .get_value = get_value,
+    .get_value_async = get_value_async,
     .get_info  = get_info,
 };
 
+/*
+ * Driver response API
+ */
+static int reading_complete(
+    fwk_id_t id,
+    const struct mod_sensor_driver_resp_params *response)
+{
+    struct sensor_dev_ctx *ctx;
+    struct fwk_event event;
+
+    if (!fwk_module_is_valid_element_id(id) || (response == NULL))
+        return FWK_E_PARAM;
+
+    ctx = ctx_table + fwk_id_get_element_idx(id);
+    if (!ctx->read_pending)
+        return FWK_E_STATE;
+
+    /*
+     * The response to the requester is sent from the context of the sensor,
+     * the driver may be reporting from an interrupt handler.
+     */
+    event = (struct fwk_event) {
+        .source_id = ctx->config->driver_id,
+        .target_id = id,
+        .id = mod_sensor_event_id_reading_complete,
+    };
+    *((struct mod_sensor_driver_resp_params *)event.params) = *response;
+
+    return fwk_thread_put_event(&event);
+}
+
+static struct mod_sensor_driver_response_api sensor_driver_response_api = {
+    .reading_complete = reading_complete,
+};
+
 /*
  * Framework handlers
  */
@@ -89,7 +169,7 @@ static int sensor_init(fwk_id_t module_id,
                        unsigned int element_count,
                        const void *unused)
 {
-    ctx_table = fwk_mm_alloc(element_count, sizeof(ctx_table[0]));
+    ctx_table = fwk_mm_calloc(element_count, sizeof(ctx_table[0]));
 
     if (ctx_table == NULL)
         return FWK_E_NOMEM;
@@ -149,17 +229,92 @@ static int sensor_process_bind_request(fwk_id_t source_id,
                                        fwk_id_t api_type,
                                        const void **api)
 {
-    *api = &sensor_api;
+    switch (fwk_id_get_api_idx(api_type)) {
+    case MOD_SENSOR_API_IDX_SENSOR:
+        *api = &sensor_api;
+        break;
+
+    case MOD_SENSOR_API_IDX_DRIVER_RESPONSE:
+        *api = &sensor_driver_response_api;
+        break;
+
+    default:
+        return FWK_E_PARAM;
+    }
+
     return FWK_SUCCESS;
 }
 
+static int sensor_process_event(const struct fwk_event *event,
+                                struct fwk_event *resp_event)
+{
+    int status;
+    struct sensor_dev_ctx *ctx;
+    struct mod_sensor_event_params_read_value_response *resp_params;
+    const struct mod_sensor_driver_resp_params *driver_resp_params;
+    struct fwk_event delayed_resp_event;
+
+    if (!fwk_module_is_valid_element_id(event->target_id))
+        return FWK_E_PARAM;
+
+    ctx = ctx_table + fwk_id_get_element_idx(event->target_id);
+
+    switch (fwk_id_get_event_idx(event->id)) {
+    case MOD_SENSOR_EVENT_IDX_READ_VALUE:
+        resp_params = (struct mod_sensor_event_params_read_value_response *)
+            resp_event->params;
+
+        status = ctx->driver_api->get_value(ctx->config->driver_id,
+                                            &resp_params->value);
+        if (status == MOD_SENSOR_DRIVER_PENDING) {
+            resp_event->is_delayed_response = true;
+            ctx->requester_id = event->source_id;
+            ctx->cookie = event->cookie;
+            return FWK_SUCCESS;
+        }
+
+        resp_params->status = (status == FWK_SUCCESS) ?
+                              FWK_SUCCESS : FWK_E_DEVICE;
+        ctx->read_pending = false;
+
+        return FWK_SUCCESS;
+
+    case MOD_SENSOR_EVENT_IDX_READING_COMPLETE:
+        if (!ctx->read_pending)
+            return FWK_E_STATE;
+
+        driver_resp_params =
+            (const struct mod_sensor_driver_resp_params *)event->params;
+
+        delayed_resp_event = (struct fwk_event) {
+            .target_id = ctx->requester_id,
+            .id = mod_sensor_event_id_read_value,
+            .cookie = ctx->cookie,
+            .is_response = true,
+            .is_delayed_response = true,
+        };
+        resp_params = (struct mod_sensor_event_params_read_value_response *)
+            delayed_resp_event.params;
+        resp_params->status = (driver_resp_params->status == FWK_SUCCESS) ?
+                              FWK_SUCCESS : FWK_E_DEVICE;
+        resp_params->value = driver_resp_params->value;
+        ctx->read_pending = false;
+
+        return fwk_thread_put_event(&delayed_resp_event);
+
+    default:
+        return FWK_E_PARAM;
+    }
+}
+
 const struct fwk_module module_sensor = {
     .name = "SENSOR",
-    .api_count = 1,
-    .event_count = 0,
+    .api_count = MOD_SENSOR_API_IDX_COUNT,
+    .event_count = MOD_SENSOR_EVENT_IDX_COUNT,
     .type = FWK_MODULE_TYPE_HAL,
     .init = sensor_init,
     .element_init = sensor_dev_init,
     .bind = sensor_bind,
     .process_bind_request = sensor_process_bind_request,
+    .process_event = sensor_process_event,
 };
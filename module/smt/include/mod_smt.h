@@ -30,6 +30,23 @@
 /*! The mailbox for this channel requires initialization */
 #define MOD_SMT_POLICY_INIT_MAILBOX ((uint32_t)(1 << 1))
 
+/*!
+ * \brief The messages of this channel are processed in place in the mailbox.
+ *
+ * \details The payload of a message is not copied out of the mailbox and the
+ *      response is written directly into it. Only the header of the message
+ *      is copied, and validated, before the message is processed. As the
+ *      response overwrites the message, the protocol handlers must have read
+ *      the parameters they need before writing their response.
+ *
+ * \note The agent can modify the message while it is processed, between the
+ *      validation of a parameter and its use. The policy is thus restricted to
+ *      the channels of trusted agents and requires the
+ *      \ref MOD_SMT_POLICY_SECURE policy. The initialization of a channel with
+ *      this policy but not the secure one fails.
+ */
+#define MOD_SMT_POLICY_ZERO_COPY    ((uint32_t)(1 << 2))
+
 /*!
  * @}
  */
@@ -66,6 +83,21 @@ struct mod_smt_channel_config {
     /*! Shared mailbox size in bytes */
     size_t mailbox_size;
 
+    /*!
+     * \brief Number of shared mailboxes of the channel.
+     *
+     * \details The mailboxes are laid out back to back from
+     *      \ref mailbox_address, each of them being \ref mailbox_size bytes.
+     *      The agent can have one message awaiting a response per mailbox, and
+     *      rings the doorbell of the channel once it has written one or more
+     *      of them. The messages are processed in the order they are received
+     *      and each response is written to the mailbox of its message, along
+     *      with the message header and thus the token of the message.
+     *
+     *      Zero is equivalent to one.
+     */
+    unsigned int mailbox_count;
+
     /*! Identifier of the driver */
     fwk_id_t driver_id;
 
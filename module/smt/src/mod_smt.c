@@ -10,6 +10,7 @@
 #include <fwk_assert.h>
 #include <fwk_errno.h>
 #include <fwk_interrupt.h>
+#include <fwk_macros.h>
 #include <fwk_mm.h>
 #include <fwk_module.h>
 #include <fwk_module_idx.h>
@@ -20,6 +21,24 @@
 #include <mod_smt.h>
 #include <internal/smt.h>
 
+struct smt_mailbox_ctx {
+    /* Shared mailbox */
+    struct mod_smt_memory *memory;
+
+    /* Mailbox read and write cache memory areas */
+    struct mod_smt_memory *in, *out;
+
+    /*
+     * Payload areas the messages are read from and the responses are written
+     * to. Those of the mailbox itself in zero-copy mode, those of the read and
+     * write cache memory areas otherwise.
+     */
+    void *in_payload, *out_payload;
+
+    /* Message processing in progrees flag */
+    volatile bool locked;
+};
+
 struct smt_channel_ctx {
     /* Channel identifier */
     fwk_id_t id;
@@ -27,11 +46,24 @@ struct smt_channel_ctx {
     /* Channel configuration data */
     struct mod_smt_channel_config *config;
 
-    /* Channel read and write cache memory areas */
-    struct mod_smt_memory *in, *out;
+    /* Table of mailbox contexts */
+    struct smt_mailbox_ctx *mailbox_ctx_table;
 
-    /* Message processing in progrees flag */
-    volatile bool locked;
+    /* Number of mailboxes */
+    unsigned int mailbox_count;
+
+    /*
+     * Ring of the indices of the mailboxes holding a message awaiting a
+     * response, in the order the messages were received. The message at the
+     * head of the ring is the one being processed.
+     */
+    unsigned int *message_queue;
+
+    /* Index in the ring of the message being processed */
+    unsigned int message_queue_head;
+
+    /* Number of messages in the ring */
+    volatile unsigned int message_queue_count;
 
     /* Maximum payload size of the channel */
     size_t max_payload_size;
@@ -62,6 +94,22 @@ struct smt_ctx {
 
 static struct smt_ctx smt_ctx;
 
+/*
+ * Get the mailbox holding the message being processed on a channel.
+ *
+ * \return A pointer to the mailbox context, NULL if no message is being
+ *      processed.
+ */
+static struct smt_mailbox_ctx *get_current_mailbox(
+    struct smt_channel_ctx *channel_ctx)
+{
+    if (channel_ctx->message_queue_count == 0)
+        return NULL;
+
+    return &channel_ctx->mailbox_ctx_table[
+        channel_ctx->message_queue[channel_ctx->message_queue_head]];
+}
+
 /*
  * SCMI Transport API
  */
@@ -82,7 +130,7 @@ static int smt_get_secure(fwk_id_t channel_id, bool *secure)
     }
 
     channel_ctx =
-        &smt_ctx.channel_ctx_table[fwk_id_get_element_idx(channel_id)];
+        FWK_MODULE_ELEMENT_CTX(smt_ctx.channel_ctx_table, channel_id);
 
     *secure = channel_ctx->config->policies & MOD_SMT_POLICY_SECURE;
 
@@ -106,7 +154,7 @@ static int smt_get_max_payload_size(fwk_id_t channel_id, size_t *size)
     }
 
     channel_ctx =
-        &smt_ctx.channel_ctx_table[fwk_id_get_element_idx(channel_id)];
+        FWK_MODULE_ELEMENT_CTX(smt_ctx.channel_ctx_table, channel_id);
 
     *size = channel_ctx->max_payload_size;
 
@@ -117,6 +165,7 @@ static int smt_get_message_header(fwk_id_t channel_id, uint32_t *header)
 {
     int status;
     struct smt_channel_ctx *channel_ctx;
+    struct smt_mailbox_ctx *mailbox_ctx;
 
     status = fwk_module_check_call(channel_id);
     if (status != FWK_SUCCESS) {
@@ -130,12 +179,13 @@ static int smt_get_message_header(fwk_id_t channel_id, uint32_t *header)
     }
 
     channel_ctx =
-        &smt_ctx.channel_ctx_table[fwk_id_get_element_idx(channel_id)];
+        FWK_MODULE_ELEMENT_CTX(smt_ctx.channel_ctx_table, channel_id);
 
-    if (!channel_ctx->locked)
+    mailbox_ctx = get_current_mailbox(channel_ctx);
+    if (mailbox_ctx == NULL)
         return FWK_E_ACCESS;
 
-    *header = channel_ctx->in->message_header;
+    *header = mailbox_ctx->in->message_header;
 
     return FWK_SUCCESS;
 }
@@ -146,6 +196,7 @@ static int smt_get_payload(fwk_id_t channel_id,
 {
     int status;
     struct smt_channel_ctx *channel_ctx;
+    struct smt_mailbox_ctx *mailbox_ctx;
 
     status = fwk_module_check_call(channel_id);
     if (status != FWK_SUCCESS) {
@@ -159,16 +210,17 @@ static int smt_get_payload(fwk_id_t channel_id,
     }
 
     channel_ctx =
-        &smt_ctx.channel_ctx_table[fwk_id_get_element_idx(channel_id)];
+        FWK_MODULE_ELEMENT_CTX(smt_ctx.channel_ctx_table, channel_id);
 
-    if (!channel_ctx->locked)
+    mailbox_ctx = get_current_mailbox(channel_ctx);
+    if (mailbox_ctx == NULL)
         return FWK_E_ACCESS;
 
-    *payload = channel_ctx->in->payload;
+    *payload = mailbox_ctx->in_payload;
 
     if (size != NULL) {
-        *size = channel_ctx->in->length -
-            sizeof(channel_ctx->in->message_header);
+        *size = mailbox_ctx->in->length -
+            sizeof(mailbox_ctx->in->message_header);
     }
 
     return FWK_SUCCESS;
@@ -181,6 +233,7 @@ static int smt_write_payload(fwk_id_t channel_id,
 {
     int status;
     struct smt_channel_ctx *channel_ctx;
+    struct smt_mailbox_ctx *mailbox_ctx;
 
     status = fwk_module_check_call(channel_id);
     if (status != FWK_SUCCESS) {
@@ -189,7 +242,7 @@ static int smt_write_payload(fwk_id_t channel_id,
     }
 
     channel_ctx =
-        &smt_ctx.channel_ctx_table[fwk_id_get_element_idx(channel_id)];
+        FWK_MODULE_ELEMENT_CTX(smt_ctx.channel_ctx_table, channel_id);
 
     if ((payload == NULL)                         ||
         (offset  > channel_ctx->max_payload_size) ||
@@ -200,38 +253,36 @@ static int smt_write_payload(fwk_id_t channel_id,
         return FWK_E_PARAM;
     }
 
-    if (!channel_ctx->locked)
+    mailbox_ctx = get_current_mailbox(channel_ctx);
+    if (mailbox_ctx == NULL)
         return FWK_E_ACCESS;
 
-    memcpy(((uint8_t*)channel_ctx->out->payload) + offset, payload, size);
+    memcpy(((uint8_t*)mailbox_ctx->out_payload) + offset, payload, size);
 
     return FWK_SUCCESS;
 }
 
-static int smt_respond(fwk_id_t channel_id, const void *payload, size_t size)
+/*
+ * Write the response to the message held by a mailbox and give the mailbox
+ * back to the agent.
+ */
+static void respond_mailbox(struct smt_channel_ctx *channel_ctx,
+                            struct smt_mailbox_ctx *mailbox_ctx,
+                            const void *payload, size_t size)
 {
-    struct smt_channel_ctx *channel_ctx;
-    struct mod_smt_memory *memory;
-    int status;
-    (void)status;
-
-    status = fwk_module_check_call(channel_id);
-    if (status != FWK_SUCCESS) {
-        assert(false);
-        return status;
-    }
-
-    channel_ctx =
-        &smt_ctx.channel_ctx_table[fwk_id_get_element_idx(channel_id)];
-    memory = ((struct mod_smt_memory*)channel_ctx->config->mailbox_address);
+    struct mod_smt_memory *memory = mailbox_ctx->memory;
 
     /* Copy the header from the write buffer */
-    *memory = *channel_ctx->out;
+    *memory = *mailbox_ctx->out;
 
-    /* Copy the payload from either the write buffer or the payload parameter */
-    memcpy(memory->payload,
-           (payload == NULL ? channel_ctx->out->payload : payload),
-           size);
+    /*
+     * Copy the payload from either the write buffer or the payload parameter,
+     * unless it has been written in place in the mailbox.
+     */
+    if (payload == NULL)
+        payload = mailbox_ctx->out_payload;
+    if (payload != memory->payload)
+        memcpy(memory->payload, payload, size);
 
     /*
      * NOTE: Disable interrupts for a brief period to ensure interrupts are not
@@ -242,7 +293,7 @@ static int smt_respond(fwk_id_t channel_id, const void *payload, size_t size)
      */
     fwk_interrupt_global_disable();
 
-    channel_ctx->locked = false;
+    mailbox_ctx->locked = false;
 
     memory->length = sizeof(memory->message_header) + size;
     memory->status |= MOD_SMT_MAILBOX_STATUS_FREE_MASK;
@@ -251,6 +302,88 @@ static int smt_respond(fwk_id_t channel_id, const void *payload, size_t size)
 
     if (memory->flags & MOD_SMT_MAILBOX_FLAGS_IENABLED_MASK)
         channel_ctx->driver_api->raise_interrupt(channel_ctx->driver_id);
+}
+
+static int smt_respond(fwk_id_t channel_id, const void *payload, size_t size)
+{
+    struct smt_channel_ctx *channel_ctx;
+    struct smt_mailbox_ctx *mailbox_ctx;
+    int status;
+    (void)status;
+
+    status = fwk_module_check_call(channel_id);
+    if (status != FWK_SUCCESS) {
+        assert(false);
+        return status;
+    }
+
+    channel_ctx =
+        FWK_MODULE_ELEMENT_CTX(smt_ctx.channel_ctx_table, channel_id);
+
+    mailbox_ctx = get_current_mailbox(channel_ctx);
+    if (mailbox_ctx == NULL)
+        return FWK_E_ACCESS;
+
+    /* The next message received, if any, becomes the one being processed */
+    fwk_interrupt_global_disable();
+    channel_ctx->message_queue_head =
+        (channel_ctx->message_queue_head + 1) % channel_ctx->mailbox_count;
+    channel_ctx->message_queue_count--;
+    fwk_interrupt_global_enable();
+
+    respond_mailbox(channel_ctx, mailbox_ctx, payload, size);
+
+    return FWK_SUCCESS;
+}
+
+static int smt_transmit(fwk_id_t channel_id, uint32_t message_header,
+                        const void *payload, size_t size)
+{
+    int status;
+    struct smt_channel_ctx *channel_ctx;
+    struct mod_smt_memory *memory;
+    unsigned int mailbox_idx;
+
+    status = fwk_module_check_call(channel_id);
+    if (status != FWK_SUCCESS) {
+        assert(false);
+        return status;
+    }
+
+    channel_ctx =
+        FWK_MODULE_ELEMENT_CTX(smt_ctx.channel_ctx_table, channel_id);
+
+    /* Only the platform can initiate messages, on its master channels */
+    if (channel_ctx->config->type != MOD_SMT_CHANNEL_TYPE_MASTER)
+        return FWK_E_SUPPORT;
+
+    if (((payload == NULL) && (size != 0)) ||
+        (size > channel_ctx->max_payload_size))
+        return FWK_E_PARAM;
+
+    /* Look for a mailbox the agent has given back to the platform */
+    for (mailbox_idx = 0; mailbox_idx < channel_ctx->mailbox_count;
+         mailbox_idx++) {
+        memory = channel_ctx->mailbox_ctx_table[mailbox_idx].memory;
+
+        if (memory->status & MOD_SMT_MAILBOX_STATUS_FREE_MASK)
+            break;
+    }
+
+    if (mailbox_idx == channel_ctx->mailbox_count)
+        return FWK_E_BUSY;
+
+    memory->message_header = message_header;
+    if (size != 0)
+        memcpy(memory->payload, payload, size);
+    memory->length = sizeof(memory->message_header) + size;
+
+    /* Hand the mailbox over to the agent */
+    memory->status &= ~(MOD_SMT_MAILBOX_STATUS_FREE_MASK |
+                        MOD_SMT_MAILBOX_STATUS_ERROR_MASK);
+
+    if (memory->flags & MOD_SMT_MAILBOX_FLAGS_IENABLED_MASK)
+        return channel_ctx->driver_api->raise_interrupt(channel_ctx->driver_id);
 
     return FWK_SUCCESS;
 }
@@ -262,37 +395,28 @@ static const struct mod_scmi_to_transport_api smt_mod_scmi_to_transport_api = {
     .get_payload = smt_get_payload,
     .write_payload = smt_write_payload,
     .respond = smt_respond,
+    .transmit = smt_transmit,
 };
 
 /*
  * Driver handler API
  */
-static int smt_slave_handler(struct smt_channel_ctx *channel_ctx)
+static int smt_receive_message(struct smt_channel_ctx *channel_ctx,
+                               unsigned int mailbox_idx)
 {
+    struct smt_mailbox_ctx *mailbox_ctx;
     struct mod_smt_memory *memory, *in, *out;
     size_t payload_size;
+    unsigned int queue_idx;
     int status;
 
-    /* Check if we are already processing */
-    if (channel_ctx->locked)
-        return FWK_E_STATE;
-
-    memory = ((struct mod_smt_memory*)channel_ctx->config->mailbox_address);
-    in = channel_ctx->in;
-    out = channel_ctx->out;
-
-    /* Check we have ownership of the mailbox */
-    if (memory->status & MOD_SMT_MAILBOX_STATUS_FREE_MASK) {
-        smt_ctx.log_api->log(
-            MOD_LOG_GROUP_ERROR,
-            "[SMT] Mailbox ownership error on channel %u\n",
-            fwk_id_get_element_idx(channel_ctx->id));
-
-        return FWK_E_STATE;
-    }
+    mailbox_ctx = &channel_ctx->mailbox_ctx_table[mailbox_idx];
+    memory = mailbox_ctx->memory;
+    in = mailbox_ctx->in;
+    out = mailbox_ctx->out;
 
     /* Commit to sending a response */
-    channel_ctx->locked = true;
+    mailbox_ctx->locked = true;
 
     /* Mirror mailbox contents in read and write buffers (Payload not copied) */
     *in  = *memory;
@@ -314,13 +438,26 @@ static int smt_slave_handler(struct smt_channel_ctx *channel_ctx)
          > channel_ctx->max_payload_size)) {
 
         out->status |= MOD_SMT_MAILBOX_STATUS_ERROR_MASK;
-        return smt_respond(channel_ctx->id, &(int32_t){SCMI_PROTOCOL_ERROR},
-                           sizeof(int32_t));
+        respond_mailbox(channel_ctx, mailbox_ctx,
+                        &(int32_t){SCMI_PROTOCOL_ERROR}, sizeof(int32_t));
+        return FWK_SUCCESS;
     }
 
-    /* Copy payload from shared memory to read buffer */
+    /*
+     * Copy payload from shared memory to read buffer, unless the message is
+     * processed in place.
+     */
     payload_size = in->length - sizeof(in->message_header);
-    memcpy(in->payload, memory->payload, payload_size);
+    if (mailbox_ctx->in_payload != memory->payload)
+        memcpy(mailbox_ctx->in_payload, memory->payload, payload_size);
+
+    /* Queue the message behind the ones awaiting a response */
+    fwk_interrupt_global_disable();
+    queue_idx = (channel_ctx->message_queue_head +
+                 channel_ctx->message_queue_count) % channel_ctx->mailbox_count;
+    channel_ctx->message_queue[queue_idx] = mailbox_idx;
+    channel_ctx->message_queue_count++;
+    fwk_interrupt_global_enable();
 
     /* Let SCMI handle the message */
     status =
@@ -331,6 +468,52 @@ static int smt_slave_handler(struct smt_channel_ctx *channel_ctx)
     return FWK_SUCCESS;
 }
 
+static int smt_slave_handler(struct smt_channel_ctx *channel_ctx)
+{
+    struct smt_mailbox_ctx *mailbox_ctx;
+    unsigned int mailbox_idx, received_count = 0;
+    bool all_locked = true;
+    int status;
+
+    /*
+     * Receive the messages of all the mailboxes the agent has given to the
+     * platform since the last doorbell. Each mailbox holds at most one
+     * message awaiting a response.
+     */
+    for (mailbox_idx = 0; mailbox_idx < channel_ctx->mailbox_count;
+         mailbox_idx++) {
+        mailbox_ctx = &channel_ctx->mailbox_ctx_table[mailbox_idx];
+
+        /* Check if we are already processing */
+        if (mailbox_ctx->locked)
+            continue;
+
+        all_locked = false;
+
+        /* Check we have ownership of the mailbox */
+        if (mailbox_ctx->memory->status & MOD_SMT_MAILBOX_STATUS_FREE_MASK)
+            continue;
+
+        status = smt_receive_message(channel_ctx, mailbox_idx);
+        if (status != FWK_SUCCESS)
+            return status;
+
+        received_count++;
+    }
+
+    if (received_count != 0)
+        return FWK_SUCCESS;
+
+    if (!all_locked) {
+        smt_ctx.log_api->log(
+            MOD_LOG_GROUP_ERROR,
+            "[SMT] Mailbox ownership error on channel %u\n",
+            fwk_id_get_element_idx(channel_ctx->id));
+    }
+
+    return FWK_E_STATE;
+}
+
 static int smt_signal_message(fwk_id_t channel_id)
 {
     int status;
@@ -341,13 +524,15 @@ static int smt_signal_message(fwk_id_t channel_id)
         return status;
 
     channel_ctx =
-        &smt_ctx.channel_ctx_table[fwk_id_get_element_idx(channel_id)];
+        FWK_MODULE_ELEMENT_CTX(smt_ctx.channel_ctx_table, channel_id);
 
     switch (channel_ctx->config->type) {
     case MOD_SMT_CHANNEL_TYPE_MASTER:
-        /* Not supported yet */
-        assert(false);
-        break;
+        /*
+         * The agent has consumed a message and given its mailbox back, which
+         * is checked for when the next message is transmitted.
+         */
+        return FWK_SUCCESS;
     case MOD_SMT_CHANNEL_TYPE_SLAVE:
         return smt_slave_handler(channel_ctx);
         break;
@@ -385,9 +570,12 @@ static int smt_channel_init(fwk_id_t channel_id, unsigned int unused,
                             const void *data)
 {
     struct smt_channel_ctx *channel_ctx;
+    struct smt_mailbox_ctx *mailbox_ctx;
+    unsigned int mailbox_idx;
+    size_t cache_size;
 
     channel_ctx =
-        &smt_ctx.channel_ctx_table[fwk_id_get_element_idx(channel_id)];
+        FWK_MODULE_ELEMENT_CTX(smt_ctx.channel_ctx_table, channel_id);
     channel_ctx->config = (struct mod_smt_channel_config*)data;
 
     /* Validate channel config */
@@ -398,22 +586,65 @@ static int smt_channel_init(fwk_id_t channel_id, unsigned int unused,
         return FWK_E_DATA;
     }
 
-    channel_ctx->id = channel_id;
-    channel_ctx->in = fwk_mm_alloc(1, channel_ctx->config->mailbox_size);
-    channel_ctx->out = fwk_mm_alloc(1, channel_ctx->config->mailbox_size);
+    /*
+     * The agent can modify a message processed in place while the handlers
+     * read it, only a trusted, secure, agent may use a zero-copy channel.
+     */
+    if ((channel_ctx->config->policies & MOD_SMT_POLICY_ZERO_COPY) &&
+        !(channel_ctx->config->policies & MOD_SMT_POLICY_SECURE)) {
+        assert(false);
+        return FWK_E_DATA;
+    }
 
-    if ((channel_ctx->in == NULL) || (channel_ctx->out == NULL))
-        return FWK_E_NOMEM;
+    channel_ctx->id = channel_id;
+    channel_ctx->mailbox_count = FWK_MAX(channel_ctx->config->mailbox_count,
+                                         1u);
 
-    channel_ctx->max_payload_size = channel_ctx->config->mailbox_size -
-        sizeof(struct mod_smt_memory);
+    channel_ctx->mailbox_ctx_table = fwk_mm_calloc(channel_ctx->mailbox_count,
+        sizeof(channel_ctx->mailbox_ctx_table[0]));
+    channel_ctx->message_queue = fwk_mm_calloc(channel_ctx->mailbox_count,
+        sizeof(channel_ctx->message_queue[0]));
 
-    /* Check memory allocations */
-    if ((channel_ctx->in == NULL) || (channel_ctx->out == NULL)) {
+    if ((channel_ctx->mailbox_ctx_table == NULL) ||
+        (channel_ctx->message_queue == NULL)) {
         assert(false);
         return FWK_E_NOMEM;
     }
 
+    /* In zero-copy mode, only the message headers are cached */
+    if (channel_ctx->config->policies & MOD_SMT_POLICY_ZERO_COPY)
+        cache_size = sizeof(struct mod_smt_memory);
+    else
+        cache_size = channel_ctx->config->mailbox_size;
+
+    for (mailbox_idx = 0; mailbox_idx < channel_ctx->mailbox_count;
+         mailbox_idx++) {
+        mailbox_ctx = &channel_ctx->mailbox_ctx_table[mailbox_idx];
+
+        mailbox_ctx->memory = (struct mod_smt_memory *)
+            (channel_ctx->config->mailbox_address +
+             (mailbox_idx * channel_ctx->config->mailbox_size));
+        mailbox_ctx->in = fwk_mm_alloc(1, cache_size);
+        mailbox_ctx->out = fwk_mm_alloc(1, cache_size);
+
+        /* Check memory allocations */
+        if ((mailbox_ctx->in == NULL) || (mailbox_ctx->out == NULL)) {
+            assert(false);
+            return FWK_E_NOMEM;
+        }
+
+        if (channel_ctx->config->policies & MOD_SMT_POLICY_ZERO_COPY) {
+            mailbox_ctx->in_payload = mailbox_ctx->memory->payload;
+            mailbox_ctx->out_payload = mailbox_ctx->memory->payload;
+        } else {
+            mailbox_ctx->in_payload = mailbox_ctx->in->payload;
+            mailbox_ctx->out_payload = mailbox_ctx->out->payload;
+        }
+    }
+
+    channel_ctx->max_payload_size = channel_ctx->config->mailbox_size -
+        sizeof(struct mod_smt_memory);
+
     return FWK_SUCCESS;
 }
 
@@ -429,7 +660,7 @@ static int smt_bind(fwk_id_t id, unsigned int round)
                                    &smt_ctx.log_api);
         }
 
-        channel_ctx = &smt_ctx.channel_ctx_table[fwk_id_get_element_idx(id)];
+        channel_ctx = FWK_MODULE_ELEMENT_CTX(smt_ctx.channel_ctx_table, id);
         status = fwk_module_bind(channel_ctx->config->driver_id,
                                  channel_ctx->config->driver_api_id,
                                  &channel_ctx->driver_api);
@@ -439,7 +670,7 @@ static int smt_bind(fwk_id_t id, unsigned int round)
     }
 
     if ((round == 1) && fwk_id_is_type(id, FWK_ID_TYPE_ELEMENT)) {
-        channel_ctx = &smt_ctx.channel_ctx_table[fwk_id_get_element_idx(id)];
+        channel_ctx = FWK_MODULE_ELEMENT_CTX(smt_ctx.channel_ctx_table, id);
         status = fwk_module_bind(channel_ctx->scmi_service_id,
             FWK_ID_API(FWK_MODULE_IDX_SCMI, MOD_SCMI_API_IDX_TRANSPORT),
             &channel_ctx->scmi_api);
@@ -465,7 +696,7 @@ static int smt_process_bind_request(fwk_id_t source_id,
     }
 
     channel_ctx =
-        &smt_ctx.channel_ctx_table[fwk_id_get_element_idx(target_id)];
+        FWK_MODULE_ELEMENT_CTX(smt_ctx.channel_ctx_table, target_id);
 
     switch (fwk_id_get_api_idx(api_id)) {
     case MOD_SMT_API_IDX_DRIVER_INPUT:
@@ -516,7 +747,7 @@ static int smt_start(fwk_id_t id)
     if (!fwk_id_is_type(id, FWK_ID_TYPE_ELEMENT))
         return FWK_SUCCESS;
 
-    ctx = &smt_ctx.channel_ctx_table[fwk_id_get_element_idx(id)];
+    ctx = FWK_MODULE_ELEMENT_CTX(smt_ctx.channel_ctx_table, id);
 
     /* Register for power domain state transition notifications */
     return fwk_notification_subscribe(
@@ -531,6 +762,7 @@ static int smt_process_notification(
 {
     struct mod_pd_power_state_transition_notification_params *params;
     struct smt_channel_ctx *channel_ctx;
+    unsigned int mailbox_idx;
 
     assert(fwk_id_is_equal(event->id,
         mod_pd_notification_id_power_state_transition));
@@ -543,14 +775,17 @@ static int smt_process_notification(
         return FWK_SUCCESS;
 
     channel_ctx =
-        &smt_ctx.channel_ctx_table[fwk_id_get_element_idx(event->target_id)];
+        FWK_MODULE_ELEMENT_CTX(smt_ctx.channel_ctx_table, event->target_id);
 
     if (channel_ctx->config->policies & MOD_SMT_POLICY_INIT_MAILBOX) {
-        /* Initialize mailbox */
-        *((struct mod_smt_memory *)channel_ctx->config->mailbox_address) =
-            (struct mod_smt_memory) {
-            .status = (1 << MOD_SMT_MAILBOX_STATUS_FREE_POS)
-        };
+        /* Initialize mailboxes */
+        for (mailbox_idx = 0; mailbox_idx < channel_ctx->mailbox_count;
+             mailbox_idx++) {
+            *channel_ctx->mailbox_ctx_table[mailbox_idx].memory =
+                (struct mod_smt_memory) {
+                .status = (1 << MOD_SMT_MAILBOX_STATUS_FREE_POS)
+            };
+        }
     }
 
     return FWK_SUCCESS;
@@ -81,6 +81,15 @@ struct mod_timer_dev_config {
 
     /*! Timer device IRQ number */
     unsigned int timer_irq;
+
+    /*!
+     * \brief Flag indicating whether the device is the time base of the
+     *      delayed and periodic events of the framework.
+     *
+     * \details At most one device of the firmware may have this flag set. The
+     *      device is registered with the framework when the module starts.
+     */
+    bool framework_timer;
 };
 
 /*!
@@ -26,20 +26,6 @@
 #include <mod_timer.h>
 #include <fwk_module_idx.h>
 
-/* Timer device context (element) */
-struct dev_ctx {
-    /* Pointer to the device's configuration */
-    const struct mod_timer_dev_config *config;
-    /* Pointer to an API provided by the driver that controls the device */
-    struct mod_timer_driver_api *driver;
-    /* Identifier of the driver that controls the device */
-    fwk_id_t driver_dev_id;
-    /* Storage for all alarms */
-    struct alarm_ctx *alarm_pool;
-    /* Queue of active alarms */
-    struct fwk_dlist alarms_active;
-};
-
 /* Alarm item context (sub-element) */
 struct alarm_ctx {
     /* List node */
@@ -60,12 +46,31 @@ struct alarm_ctx {
     bool bound;
 };
 
+/* Timer device context (element) */
+struct dev_ctx {
+    /* Pointer to the device's configuration */
+    const struct mod_timer_dev_config *config;
+    /* Pointer to an API provided by the driver that controls the device */
+    struct mod_timer_driver_api *driver;
+    /* Identifier of the driver that controls the device */
+    fwk_id_t driver_dev_id;
+    /* Storage for all alarms */
+    struct alarm_ctx *alarm_pool;
+    /* Queue of active alarms */
+    struct fwk_dlist alarms_active;
+    /* Alarm of the delayed events of the framework */
+    struct alarm_ctx framework_alarm;
+};
+
 /* Table of timer device context structures */
 static struct dev_ctx *ctx_table;
 
 /* Log API */
 static const struct mod_log_api *log_api;
 
+/* Context of the device that is the time base of the framework, if any */
+static struct dev_ctx *framework_timer_ctx;
+
 /*
  * Forward declarations
  */
@@ -198,7 +203,7 @@ static int get_frequency(fwk_id_t dev_id, uint32_t *frequency)
     if (status != FWK_SUCCESS)
         return status;
 
-    ctx = &ctx_table[fwk_id_get_element_idx(dev_id)];
+    ctx = FWK_MODULE_ELEMENT_CTX(ctx_table, dev_id);
 
     if (frequency == NULL)
         return FWK_E_PARAM;
@@ -220,7 +225,7 @@ static int time_to_timestamp(fwk_id_t dev_id,
     if (timestamp == NULL)
         return FWK_E_PARAM;
 
-    ctx = &ctx_table[fwk_id_get_element_idx(dev_id)];
+    ctx = FWK_MODULE_ELEMENT_CTX(ctx_table, dev_id);
 
     return _time_to_timestamp(ctx, microseconds, timestamp);
 }
@@ -234,7 +239,7 @@ static int get_counter(fwk_id_t dev_id, uint64_t *counter)
     if (status != FWK_SUCCESS)
         return status;
 
-    ctx = &ctx_table[fwk_id_get_element_idx(dev_id)];
+    ctx = FWK_MODULE_ELEMENT_CTX(ctx_table, dev_id);
 
     if (counter == NULL)
         return FWK_E_PARAM;
@@ -253,7 +258,7 @@ static int delay(fwk_id_t dev_id, uint32_t microseconds)
     if (status != FWK_SUCCESS)
         return status;
 
-    ctx = &ctx_table[fwk_id_get_element_idx(dev_id)];
+    ctx = FWK_MODULE_ELEMENT_CTX(ctx_table, dev_id);
 
     status = _timestamp_from_now(ctx, microseconds, &counter_limit);
     if (status != FWK_SUCCESS)
@@ -281,7 +286,7 @@ static int wait(fwk_id_t dev_id,
     if (status != FWK_SUCCESS)
         return status;
 
-    ctx = &ctx_table[fwk_id_get_element_idx(dev_id)];
+    ctx = FWK_MODULE_ELEMENT_CTX(ctx_table, dev_id);
 
     status = _timestamp_from_now(ctx, microseconds, &counter_limit);
     if (status != FWK_SUCCESS)
@@ -319,7 +324,7 @@ static int remaining(fwk_id_t dev_id,
     if (status != FWK_SUCCESS)
         return status;
 
-    ctx = &ctx_table[fwk_id_get_element_idx(dev_id)];
+    ctx = FWK_MODULE_ELEMENT_CTX(ctx_table, dev_id);
 
     if (remaining_ticks == NULL)
         return FWK_E_PARAM;
@@ -346,7 +351,7 @@ static int get_next_alarm_remaining(fwk_id_t dev_id,
     if (remaining_ticks == NULL)
         return FWK_E_PARAM;
 
-    ctx = &ctx_table[fwk_id_get_element_idx(dev_id)];
+    ctx = FWK_MODULE_ELEMENT_CTX(ctx_table, dev_id);
 
     /*
      * The timer interrupt is disabled to ensure that the alarm list is not
@@ -394,7 +399,7 @@ static int alarm_stop(fwk_id_t alarm_id)
     if (status != FWK_SUCCESS)
         return status;
 
-    ctx = &ctx_table[fwk_id_get_element_idx(alarm_id)];
+    ctx = FWK_MODULE_ELEMENT_CTX(ctx_table, alarm_id);
     alarm = &ctx->alarm_pool[fwk_id_get_sub_element_idx(alarm_id)];
 
     /* Prevent possible data races with the timer interrupt */
@@ -476,6 +481,50 @@ static const struct mod_timer_alarm_api alarm_api = {
     .stop = alarm_stop,
 };
 
+/*
+ * Functions fulfilling the framework's timer driver interface
+ */
+
+static int framework_timer_get_counter(uint64_t *counter)
+{
+    struct dev_ctx *ctx = framework_timer_ctx;
+
+    return ctx->driver->get_counter(ctx->driver_dev_id, counter);
+}
+
+static int framework_timer_set_alarm(uint64_t timestamp)
+{
+    struct dev_ctx *ctx = framework_timer_ctx;
+    struct alarm_ctx *alarm = &ctx->framework_alarm;
+
+    /* Disable timer interrupts to work with the active queue */
+    ctx->driver->disable(ctx->driver_dev_id);
+
+    if (alarm->started) {
+        /* See alarm_stop() */
+        fwk_interrupt_clear_pending(ctx->config->timer_irq);
+        fwk_list_remove(&ctx->alarms_active, &alarm->node);
+        alarm->started = false;
+    }
+
+    alarm->timestamp = timestamp;
+    _insert_alarm_ctx_into_active_queue(ctx, alarm);
+
+    _configure_timer_with_next_alarm(ctx);
+
+    return FWK_SUCCESS;
+}
+
+static void framework_timer_callback(uintptr_t param)
+{
+    fwk_thread_signal_timer();
+}
+
+static struct fwk_thread_timer_driver framework_timer_driver = {
+    .get_counter = framework_timer_get_counter,
+    .set_alarm = framework_timer_set_alarm,
+};
+
 static void timer_isr(uintptr_t ctx_ptr)
 {
     int status;
@@ -637,6 +686,7 @@ static int timer_process_bind_request(fwk_id_t requester_id,
 
 static int timer_start(fwk_id_t id)
 {
+    int status;
     struct dev_ctx *ctx;
 
     if (!fwk_module_is_valid_element_id(id))
@@ -651,7 +701,27 @@ static int timer_start(fwk_id_t id)
                                 (uintptr_t)ctx);
     fwk_interrupt_enable(ctx->config->timer_irq);
 
-    return FWK_SUCCESS;
+    if (!ctx->config->framework_timer)
+        return FWK_SUCCESS;
+
+    /* Register the device as the time base of the framework */
+    if (framework_timer_ctx != NULL) {
+        assert(false);
+        return FWK_E_STATE;
+    }
+
+    if (ctx->driver->set_timer == NULL)
+        return FWK_E_DEVICE;
+
+    status = ctx->driver->get_frequency(ctx->driver_dev_id,
+                                        &framework_timer_driver.frequency);
+    if (status != FWK_SUCCESS)
+        return status;
+
+    ctx->framework_alarm.callback = framework_timer_callback;
+    framework_timer_ctx = ctx;
+
+    return fwk_thread_set_timer_driver(&framework_timer_driver);
 }
 
 /* Module descriptor */
@@ -0,0 +1,21 @@
+#
+# Arm SCP/MCP Software
+# Copyright (c) 2015-2019, Arm Limited and Contributors. All rights reserved.
+#
+# SPDX-License-Identifier: BSD-3-Clause
+#
+# Host firmware processing the events with a pool of worker threads.
+#
+# The order of the modules in the BS_FIRMWARE_MODULES list is the order in which
+# the modules are initialized, bound, started during the pre-runtime phase.
+#
+
+BS_FIRMWARE_CPU := host
+BS_FIRMWARE_HAS_MULTITHREADING := no
+BS_FIRMWARE_HAS_NOTIFICATION := yes
+BS_FIRMWARE_HAS_WORKER_POOL := yes
+BS_FIRMWARE_SOURCES := config_log.c
+BS_FIRMWARE_MODULES := log \
+                       host_console
+
+include $(BS_DIR)/firmware.mk
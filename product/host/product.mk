@@ -6,4 +6,5 @@
 #
 
 BS_PRODUCT_NAME := Host
-BS_FIRMWARE_LIST := fw
+BS_FIRMWARE_LIST := fw \
+                    fw_worker_pool
@@ -324,7 +324,7 @@ static int n1sdp_pcie_element_init(fwk_id_t element_id, unsigned int unused,
 
     config = (struct n1sdp_pcie_dev_config *)data;
 
-    dev_ctx = &pcie_ctx.device_ctx_table[fwk_id_get_element_idx(element_id)];
+    dev_ctx = FWK_MODULE_ELEMENT_CTX(pcie_ctx.device_ctx_table, element_id);
     if (dev_ctx == NULL)
         return FWK_E_DATA;
 
@@ -377,7 +377,7 @@ static int n1sdp_pcie_start(fwk_id_t id)
         return FWK_SUCCESS;
     }
 
-    dev_ctx = &pcie_ctx.device_ctx_table[fwk_id_get_element_idx(id)];
+    dev_ctx = FWK_MODULE_ELEMENT_CTX(pcie_ctx.device_ctx_table, id);
     if (dev_ctx == NULL)
         return FWK_E_PARAM;
 
@@ -78,7 +78,7 @@ static int smt_get_secure(fwk_id_t channel_id, bool *secure)
     }
 
     channel_ctx =
-        &smt_ctx.channel_ctx_table[fwk_id_get_element_idx(channel_id)];
+        FWK_MODULE_ELEMENT_CTX(smt_ctx.channel_ctx_table, channel_id);
 
     *secure = channel_ctx->config->policies & MOD_SMT_POLICY_SECURE;
 
@@ -102,7 +102,7 @@ static int smt_get_max_payload_size(fwk_id_t channel_id, size_t *size)
     }
 
     channel_ctx =
-        &smt_ctx.channel_ctx_table[fwk_id_get_element_idx(channel_id)];
+        FWK_MODULE_ELEMENT_CTX(smt_ctx.channel_ctx_table, channel_id);
 
     *size = channel_ctx->max_payload_size;
 
@@ -126,7 +126,7 @@ static int smt_get_message_header(fwk_id_t channel_id, uint32_t *header)
     }
 
     channel_ctx =
-        &smt_ctx.channel_ctx_table[fwk_id_get_element_idx(channel_id)];
+        FWK_MODULE_ELEMENT_CTX(smt_ctx.channel_ctx_table, channel_id);
 
     if (!channel_ctx->locked)
         return FWK_E_ACCESS;
@@ -155,7 +155,7 @@ static int smt_get_payload(fwk_id_t channel_id,
     }
 
     channel_ctx =
-        &smt_ctx.channel_ctx_table[fwk_id_get_element_idx(channel_id)];
+        FWK_MODULE_ELEMENT_CTX(smt_ctx.channel_ctx_table, channel_id);
 
     if (!channel_ctx->locked)
         return FWK_E_ACCESS;
@@ -185,7 +185,7 @@ static int smt_write_payload(fwk_id_t channel_id,
     }
 
     channel_ctx =
-        &smt_ctx.channel_ctx_table[fwk_id_get_element_idx(channel_id)];
+        FWK_MODULE_ELEMENT_CTX(smt_ctx.channel_ctx_table, channel_id);
 
     if ((payload == NULL)                         ||
         (offset  > channel_ctx->max_payload_size) ||
@@ -218,7 +218,7 @@ static int smt_respond(fwk_id_t channel_id, const void *payload, size_t size)
     }
 
     channel_ctx =
-        &smt_ctx.channel_ctx_table[fwk_id_get_element_idx(channel_id)];
+        FWK_MODULE_ELEMENT_CTX(smt_ctx.channel_ctx_table, channel_id);
     memory = ((struct mod_smt_memory*)channel_ctx->config->mailbox_address);
 
     /* Copy the header from the write buffer */
@@ -273,7 +273,7 @@ static bool smt_is_channel_free(fwk_id_t channel_id)
     }
 
     channel_ctx =
-        &smt_ctx.channel_ctx_table[fwk_id_get_element_idx(channel_id)];
+        FWK_MODULE_ELEMENT_CTX(smt_ctx.channel_ctx_table, channel_id);
     memory = (struct mod_smt_memory *)channel_ctx->config->mailbox_address;
 
     return ((memory->status & MOD_SMT_MAILBOX_STATUS_FREE_MASK) != 0);
@@ -292,7 +292,7 @@ static int smt_send(fwk_id_t channel_id, struct mod_smt_command_config *cmd)
     }
 
     channel_ctx =
-        &smt_ctx.channel_ctx_table[fwk_id_get_element_idx(channel_id)];
+        FWK_MODULE_ELEMENT_CTX(smt_ctx.channel_ctx_table, channel_id);
 
     if (((cmd->size != 0) && (cmd->payload == NULL)) ||
         (cmd->size > channel_ctx->max_payload_size)) {
@@ -334,7 +334,7 @@ static int smt_put_channel(fwk_id_t channel_id)
     }
 
     channel_ctx =
-        &smt_ctx.channel_ctx_table[fwk_id_get_element_idx(channel_id)];
+        FWK_MODULE_ELEMENT_CTX(smt_ctx.channel_ctx_table, channel_id);
     memory = (struct mod_smt_memory *)channel_ctx->config->mailbox_address;
 
     memory->status |= MOD_SMT_MAILBOX_STATUS_FREE_MASK;
@@ -390,7 +390,7 @@ static int smt_signal_message(fwk_id_t channel_id)
         return status;
 
     channel_ctx =
-        &smt_ctx.channel_ctx_table[fwk_id_get_element_idx(channel_id)];
+        FWK_MODULE_ELEMENT_CTX(smt_ctx.channel_ctx_table, channel_id);
 
     switch (channel_ctx->config->type) {
     case MOD_SMT_CHANNEL_TYPE_MASTER:
@@ -435,7 +435,7 @@ static int smt_channel_init(fwk_id_t channel_id, unsigned int unused,
     struct smt_channel_ctx *channel_ctx;
 
     channel_ctx =
-        &smt_ctx.channel_ctx_table[fwk_id_get_element_idx(channel_id)];
+        FWK_MODULE_ELEMENT_CTX(smt_ctx.channel_ctx_table, channel_id);
     channel_ctx->config = (struct mod_smt_channel_config*)data;
 
     /* Validate channel config */
@@ -477,7 +477,7 @@ static int smt_bind(fwk_id_t id, unsigned int round)
                                    &smt_ctx.log_api);
         }
 
-        channel_ctx = &smt_ctx.channel_ctx_table[fwk_id_get_element_idx(id)];
+        channel_ctx = FWK_MODULE_ELEMENT_CTX(smt_ctx.channel_ctx_table, id);
         status = fwk_module_bind(channel_ctx->config->driver_id,
                                  channel_ctx->config->driver_api_id,
                                  &channel_ctx->driver_api);
@@ -504,7 +504,7 @@ static int smt_process_bind_request(fwk_id_t source_id,
     }
 
     channel_ctx =
-        &smt_ctx.channel_ctx_table[fwk_id_get_element_idx(target_id)];
+        FWK_MODULE_ELEMENT_CTX(smt_ctx.channel_ctx_table, target_id);
 
     switch (fwk_id_get_api_idx(api_id)) {
     case MOD_SMT_API_IDX_DRIVER_INPUT:
@@ -561,7 +561,7 @@ static int smt_start(fwk_id_t id)
     if (!fwk_id_is_type(id, FWK_ID_TYPE_ELEMENT))
         return FWK_SUCCESS;
 
-    ctx = &smt_ctx.channel_ctx_table[fwk_id_get_element_idx(id)];
+    ctx = FWK_MODULE_ELEMENT_CTX(smt_ctx.channel_ctx_table, id);
 
 #if BUILD_HAS_MOD_POWER_DOMAIN
     /* Register for power domain state transition notifications */
@@ -600,7 +600,7 @@ static int smt_process_notification(
         return FWK_SUCCESS;
 
     channel_ctx =
-        &smt_ctx.channel_ctx_table[fwk_id_get_element_idx(event->target_id)];
+        FWK_MODULE_ELEMENT_CTX(smt_ctx.channel_ctx_table, event->target_id);
 
     if (channel_ctx->config->policies & MOD_SMT_POLICY_INIT_MAILBOX) {
         /* Initialize mailbox */
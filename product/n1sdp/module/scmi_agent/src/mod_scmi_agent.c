@@ -56,7 +56,7 @@ static int _scmi_agent_transact(fwk_id_t agent_id,
     struct scmi_agent_ctx *agent_ctx;
     int status;
 
-    agent_ctx = &ctx.agent_ctx_table[fwk_id_get_element_idx(agent_id)];
+    agent_ctx = FWK_MODULE_ELEMENT_CTX(ctx.agent_ctx_table, agent_id);
 
     /* Check if channel is free */
     if (!ctx.smt_api->is_channel_free(agent_ctx->config->transport_id)) {
@@ -111,7 +111,7 @@ static int agent_get_protocol_version(fwk_id_t agent_id, uint32_t *version)
     if (status != FWK_SUCCESS)
         return status;
 
-    agent_ctx = &ctx.agent_ctx_table[fwk_id_get_element_idx(agent_id)];
+    agent_ctx = FWK_MODULE_ELEMENT_CTX(ctx.agent_ctx_table, agent_id);
     *version = *(((uint32_t *)agent_ctx->payload) + 1);
 
     return FWK_SUCCESS;
@@ -135,7 +135,7 @@ static int agent_get_clock_status(fwk_id_t agent_id, uint32_t *clock_status)
     if (status != FWK_SUCCESS)
         return status;
 
-    agent_ctx = &ctx.agent_ctx_table[fwk_id_get_element_idx(agent_id)];
+    agent_ctx = FWK_MODULE_ELEMENT_CTX(ctx.agent_ctx_table, agent_id);
     *clock_status = *(((uint32_t *)agent_ctx->payload) + 1);
 
     return FWK_SUCCESS;
@@ -161,7 +161,7 @@ static int agent_get_chipid_info(fwk_id_t agent_id,
     if (status != FWK_SUCCESS)
         return status;
 
-    agent_ctx = &ctx.agent_ctx_table[fwk_id_get_element_idx(agent_id)];
+    agent_ctx = FWK_MODULE_ELEMENT_CTX(ctx.agent_ctx_table, agent_id);
     *multichip_mode = (uint8_t)(*(((uint32_t *)agent_ctx->payload) + 1));
     *chipid = (uint8_t)(*(((uint32_t *)agent_ctx->payload) + 2));
 
@@ -199,7 +199,7 @@ static int scmi_agent_element_init(fwk_id_t agent_id, unsigned int unused,
     if (config == NULL)
         return FWK_E_PARAM;
 
-    agent_ctx = &ctx.agent_ctx_table[fwk_id_get_element_idx(agent_id)];
+    agent_ctx = FWK_MODULE_ELEMENT_CTX(ctx.agent_ctx_table, agent_id);
     agent_ctx->config = config;
 
     return FWK_SUCCESS;
@@ -215,7 +215,7 @@ static int scmi_agent_bind(fwk_id_t id, unsigned int round)
                                    FWK_ID_API(FWK_MODULE_IDX_LOG, 0),
                                    &ctx.log_api);
         }
-        agent_ctx = &ctx.agent_ctx_table[fwk_id_get_element_idx(id)];
+        agent_ctx = FWK_MODULE_ELEMENT_CTX(ctx.agent_ctx_table, id);
         return fwk_module_bind(agent_ctx->config->transport_id,
                                agent_ctx->config->transport_api_id,
                                &ctx.smt_api);
@@ -44,6 +44,45 @@ ifneq ($(filter-out yes no,$(BS_FIRMWARE_HAS_NOTIFICATION)),)
              Aborting...")
 endif
 
+#
+# Validate the optional definitions
+#
+ifneq ($(filter-out yes no,$(BS_FIRMWARE_HAS_MM_ACCOUNTING)),)
+    $(error "Invalid parameter for BS_FIRMWARE_HAS_MM_ACCOUNTING. \
+             Valid options are: 'yes' and 'no'. \
+             Aborting...")
+endif
+
+ifneq ($(filter-out yes no,$(BS_FIRMWARE_HAS_EVENT_PROFILING)),)
+    $(error "Invalid parameter for BS_FIRMWARE_HAS_EVENT_PROFILING. \
+             Valid options are: 'yes' and 'no'. \
+             Aborting...")
+endif
+
+ifneq ($(filter-out yes no,$(BS_FIRMWARE_HAS_BOOT_PROFILING)),)
+    $(error "Invalid parameter for BS_FIRMWARE_HAS_BOOT_PROFILING. \
+             Valid options are: 'yes' and 'no'. \
+             Aborting...")
+endif
+
+ifneq ($(filter-out yes no,$(BS_FIRMWARE_HAS_WORKER_POOL)),)
+    $(error "Invalid parameter for BS_FIRMWARE_HAS_WORKER_POOL. \
+             Valid options are: 'yes' and 'no'. \
+             Aborting...")
+endif
+
+ifeq ($(BS_FIRMWARE_HAS_WORKER_POOL),yes)
+    ifneq ($(BS_FIRMWARE_CPU),host)
+        $(error "BS_FIRMWARE_HAS_WORKER_POOL is only supported by the \
+                 host builds. Aborting...")
+    endif
+    ifeq ($(BS_FIRMWARE_HAS_MULTITHREADING),yes)
+        $(error "BS_FIRMWARE_HAS_WORKER_POOL and \
+                 BS_FIRMWARE_HAS_MULTITHREADING are mutually exclusive. \
+                 Aborting...")
+    endif
+endif
+
 export BS_FIRMWARE_CPU
 export BS_FIRMWARE_HAS_MULTITHREADING
 export BS_FIRMWARE_HAS_NOTIFICATION
@@ -204,6 +243,34 @@ else
 endif
 export BUILD_HAS_NOTIFICATION
 
+ifeq ($(BS_FIRMWARE_HAS_MM_ACCOUNTING),yes)
+    DEFINES += BUILD_HAS_MM_ACCOUNTING
+endif
+
+ifeq ($(BS_FIRMWARE_HAS_EVENT_PROFILING),yes)
+    DEFINES += BUILD_HAS_EVENT_PROFILING
+endif
+
+ifeq ($(BS_FIRMWARE_HAS_BOOT_PROFILING),yes)
+    DEFINES += BUILD_HAS_BOOT_PROFILING
+endif
+
+ifeq ($(BS_FIRMWARE_HAS_WORKER_POOL),yes)
+    BUILD_HAS_WORKER_POOL := yes
+    DEFINES += BUILD_HAS_WORKER_POOL
+else
+    BUILD_HAS_WORKER_POOL := no
+endif
+export BUILD_HAS_WORKER_POOL
+
+ifneq ($(BS_FIRMWARE_EVENT_EXT_PARAMS_COUNT),)
+    DEFINES += BUILD_EVENT_EXT_PARAMS_COUNT=$(BS_FIRMWARE_EVENT_EXT_PARAMS_COUNT)
+endif
+
+ifneq ($(BS_FIRMWARE_ISR_EVENT_COUNT),)
+    DEFINES += BUILD_ISR_EVENT_COUNT=$(BS_FIRMWARE_ISR_EVENT_COUNT)
+endif
+
 # Add directories to the list of targets to build
 LIB_TARGETS_y += $(patsubst %,$(MODULES_DIR)/%/src, \
                             $(BUILD_STANDARD_MODULES))
@@ -54,6 +54,11 @@ ifeq ($(BS_ARCH_ARCH),host)
         LDFLAGS_GCC += -pthread
     endif
 
+    ifeq ($(BUILD_HAS_WORKER_POOL),yes)
+        CFLAGS_GCC  += -pthread
+        LDFLAGS_GCC += -pthread
+    endif
+
     DEFINES += BUILD_HOST
 
 #
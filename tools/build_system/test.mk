@@ -38,6 +38,15 @@ TEST_DIR := $(BUILD_DIR)/test
 # Create list of test targets
 TEST_TARGETS = $(addprefix $(TEST_DIR)/, $(TESTS))
 
+# Define benchmark directory
+BENCH_DIR := $(BUILD_DIR)/bench
+
+# Create list of benchmark targets
+BENCH_TARGETS = $(addprefix $(BENCH_DIR)/, $(BENCHMARKS))
+
+# File collecting the results of the benchmarks
+BENCH_RESULTS := $(BENCH_DIR)/results.jsonl
+
 # Import utilities
 include $(BS_DIR)/defs.mk
 
@@ -54,13 +63,33 @@ $(TEST_DIR)/$(1): $$($(1)_OBJ) | $(TEST_DIR)
 	$$@
 endef
 
+# Template for the benchmark rule
+define BENCH_template
+$(1)_LDFLAGS := $(addprefix -Wl$(comma)-wrap=, $($(1)_WRAP))
+$(1)_OBJ := $(patsubst %.c, $(BENCH_DIR)/%.o, $(COMMON_SRC) $($(1)_SRC))
+
+$(BENCH_DIR)/$(1): $$($(1)_OBJ) | $(BENCH_DIR)
+	$$(call show-action,LD,$$@)
+	$$(CC) -o $$@ $$^ $$($(1)_LDFLAGS)
+endef
+
 # Create rules for each test
 $(foreach test,$(TESTS),$(eval $(call TEST_template,$(test))))
 
+# Create rules for each benchmark
+$(foreach bench,$(BENCHMARKS),$(eval $(call BENCH_template,$(bench))))
+
 all: $(TEST_TARGETS)
 
-# Create output directory
-$(TEST_DIR):
+# The benchmarks are run one at a time so that they do not disturb each other
+.PHONY: bench
+bench: $(BENCH_TARGETS)
+	$(call show-action,RUN,$(BENCH_RESULTS))
+	for bench in $^; do $$bench || exit 1; done > $(BENCH_RESULTS)
+	cat $(BENCH_RESULTS)
+
+# Create output directories
+$(TEST_DIR) $(BENCH_DIR):
 	$(call show-action,MD,$@)
 	$(MD) $@
 
@@ -69,4 +98,9 @@ $(TEST_DIR)/%.o: %.c | $(TEST_DIR)
 	$(call show-action,CC,$@)
 	$(CC) $(CFLAGS) $^ -c -o $@
 
+# Build C files of the benchmarks with optimizations
+$(BENCH_DIR)/%.o: %.c | $(BENCH_DIR)
+	$(call show-action,CC,$@)
+	$(CC) $(CFLAGS) -O2 $^ -c -o $@
+
 endif
@@ -7,19 +7,28 @@
 #
 # Description:
 #   This tool takes a list of module names and generates two files:
-#   * fwk_modules_idx.h: Contains an enumeration giving the modules' indices.
+#   * fwk_modules_idx.h: Contains an enumeration giving the modules' indices
+#     and the number of modules as a compile-time constant.
 #   * fwk_modules_list.c: Contains a table of pointers to a module descriptor.
 #
+#   The module names are checked when the files are generated: a name that is
+#   not a valid C identifier or that appears twice in the list, and a list with
+#   more modules than the module identifiers can index, are reported as errors.
+#
 # Note: The files are updated only if their contents will differ, relative to
 #   the last time the tool was run.
 #
 
 import argparse
 import os
+import re
 import sys
 
 DEFAULT_PATH = 'build/'
 
+# Number of modules the module index of an identifier can represent
+MODULE_COUNT_MAX = 256
+
 FILENAME_H = "fwk_module_idx.h"
 TEMPLATE_H = "/* This file was auto generated using {} */\n" \
              "#ifndef FWK_MODULE_IDX_H\n" \
@@ -29,6 +38,7 @@ TEMPLATE_H = "/* This file was auto generated using {} */\n" \
              "\n" \
              "enum fwk_module_idx {{\n" \
              "{}" \
+             "    FWK_MODULE_IDX_COUNT\n" \
              "}};\n" \
              "\n" \
              "{}" \
@@ -64,6 +74,26 @@ def generate_file(path, filename, content):
             f.write(content)
 
 
+def check_modules(modules):
+    errors = []
+    seen = set()
+    for module in modules:
+        if not re.match(r'^[A-Za-z_][A-Za-z0-9_]*$', module):
+            errors.append("invalid module name '{}'".format(module))
+        elif module.lower() in seen:
+            errors.append("module '{}' listed more than once".format(module))
+        seen.add(module.lower())
+
+    if len(modules) > MODULE_COUNT_MAX:
+        errors.append("{} modules listed, at most {} are supported"
+                      .format(len(modules), MODULE_COUNT_MAX))
+
+    for error in errors:
+        print("[GEN] Error: {}".format(error), file=sys.stderr)
+
+    return not errors
+
+
 def generate_header(path, modules):
     enum = ""
     const = ""
@@ -115,6 +145,8 @@ def main():
     args = parser.parse_args()
 
     modules = args.modules
+    if not check_modules(modules):
+        sys.exit(1)
 
     generate_header(args.path, modules)
     generate_c(args.path, modules)